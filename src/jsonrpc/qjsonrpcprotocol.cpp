@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include "qjsonrpcprotocol_p_p.h"
+#include "qtypedjsontextreader_p.h"
 
 #include <QtCore/qjsonarray.h>
 #include <QtCore/qstring.h>
@@ -13,8 +14,24 @@ QT_BEGIN_NAMESPACE
 
 using namespace Qt::StringLiterals;
 
+// compact JSON text of a single value
+static QByteArray jsonText(const QJsonValue &value)
+{
+    const QByteArray array = QJsonDocument(QJsonArray({ value })).toJson(QJsonDocument::Compact);
+    return array.mid(1, array.size() - 2);
+}
+
+static QJsonValue fromJsonText(const QByteArray &text)
+{
+    if (text.isNull())
+        return QJsonValue::Undefined;
+    return QJsonDocument::fromJson('[' + text + ']').array().at(0);
+}
+
 static QJsonObject createResponse(const QJsonValue &id, const QJsonRpcProtocol::Response &response)
 {
+    const QJsonValue data =
+            (response.rawData.isNull() ? response.data : fromJsonText(response.rawData));
     QJsonObject object;
     object.insert(u"jsonrpc", u"2.0"_s);
     object.insert(u"id", id);
@@ -22,15 +39,45 @@ static QJsonObject createResponse(const QJsonValue &id, const QJsonRpcProtocol::
         QJsonObject error;
         error.insert(u"code", response.errorCode);
         error.insert(u"message", response.errorMessage);
-        if (!response.data.isUndefined())
-            error.insert(u"data", response.data);
+        if (!data.isUndefined())
+            error.insert(u"data", data);
         object.insert(u"error", error);
     } else {
-        object.insert(u"result", response.data);
+        object.insert(u"result", data);
     }
     return object;
 }
 
+// Text version of createResponse for responses with rawData, members are written in the
+// same order as in the QJsonDocument of createResponse.
+static QByteArray createRawResponse(const QJsonValue &id,
+                                    const QJsonRpcProtocol::Response &response)
+{
+    QByteArray message;
+    message.reserve(response.rawData.size() + 64);
+    if (response.errorCode.isDouble()) {
+        message.append(R"({"error":{"code":)");
+        message.append(jsonText(response.errorCode));
+        // like an undefined data in createResponse, an empty rawData has no member
+        if (!response.rawData.isEmpty()) {
+            message.append(R"(,"data":)");
+            message.append(response.rawData);
+        }
+        message.append(R"(,"message":)");
+        message.append(jsonText(response.errorMessage));
+        message.append(R"(},"id":)");
+        message.append(jsonText(id));
+        message.append(R"(,"jsonrpc":"2.0"})");
+    } else {
+        message.append(R"({"id":)");
+        message.append(jsonText(id));
+        message.append(R"(,"jsonrpc":"2.0","result":)");
+        message.append(response.rawData);
+        message.append('}');
+    }
+    return message;
+}
+
 static QJsonRpcProtocol::Response
 createPredefinedError(QJsonRpcProtocol::ErrorCode code,
                       const QJsonValue &id = QJsonValue::Undefined)
@@ -84,6 +131,18 @@ static QJsonObject createNotification(const Notification &notification)
     return object;
 }
 
+static QByteArray createRawNotification(const QString &method, const QByteArray &rawParams)
+{
+    QByteArray message;
+    message.reserve(rawParams.size() + 64);
+    message.append(R"({"jsonrpc":"2.0","method":)");
+    message.append(jsonText(method));
+    message.append(R"(,"params":)");
+    message.append(rawParams);
+    message.append('}');
+    return message;
+}
+
 class RequestBatchHandler
 {
     Q_DISABLE_COPY(RequestBatchHandler)
@@ -139,6 +198,20 @@ static QJsonObject createRequest(const Request &request)
     return object;
 }
 
+static QByteArray createRawRequest(const QJsonRpcProtocol::Request &request)
+{
+    QByteArray message;
+    message.reserve(request.rawParams.size() + 64);
+    message.append(R"({"id":)");
+    message.append(jsonText(request.id));
+    message.append(R"(,"jsonrpc":"2.0","method":)");
+    message.append(jsonText(request.method));
+    message.append(R"(,"params":)");
+    message.append(request.rawParams);
+    message.append('}');
+    return message;
+}
+
 void QJsonRpcProtocol::sendRequest(const Request &request,
                                    const QJsonRpcProtocol::Handler<Response> &handler)
 {
@@ -147,7 +220,10 @@ void QJsonRpcProtocol::sendRequest(const Request &request,
     case QJsonValue::Double:
     case QJsonValue::String:
         if (d->addPendingRequest(request.id, handler)) {
-            d->sendMessage(createRequest(request));
+            if (request.rawParams.isNull())
+                d->sendMessage(createRequest(request));
+            else
+                d->sendRawMessage(createRawRequest(request));
             return;
         }
     default:
@@ -159,7 +235,10 @@ void QJsonRpcProtocol::sendRequest(const Request &request,
 
 void QJsonRpcProtocol::sendNotification(const QJsonRpcProtocol::Notification &notification)
 {
-    d->sendMessage(createNotification(notification));
+    if (notification.rawParams.isNull())
+        d->sendMessage(createNotification(notification));
+    else
+        d->sendRawMessage(createRawNotification(notification.method, notification.rawParams));
 }
 
 void QJsonRpcProtocol::sendBatch(
@@ -242,8 +321,10 @@ void QJsonRpcProtocolPrivate::setTransport(QJsonRpcTransport *newTransport)
     if (newTransport == m_transport)
         return;
 
-    if (m_transport)
+    if (m_transport) {
         m_transport->setMessageHandler(nullptr);
+        m_transport->setRawMessageHandler(nullptr);
+    }
 
     m_transport = newTransport;
 
@@ -252,6 +333,8 @@ void QJsonRpcProtocolPrivate::setTransport(QJsonRpcTransport *newTransport)
                 [this](const QJsonDocument &message, const QJsonParseError &error) {
                     processMessage(message, error);
                 });
+        m_transport->setRawMessageHandler(
+                [this](const QByteArray &message) { return processRawMessage(message); });
     }
 }
 
@@ -345,7 +428,7 @@ void QJsonRpcProtocolPrivate::processRequest(const QJsonObject &object)
     if (auto handler = messageHandler(request.method)) {
         const QJsonValue id = request.id;
         handler->handleRequest(request, [id, this](const QJsonRpcProtocol::Response &response) {
-            sendMessage(createResponse(id, response));
+            sendResponse(id, response);
         });
     } else {
         sendMessage(createMethodNotFoundResponse(request.id));
@@ -394,7 +477,7 @@ void QJsonRpcProtocolPrivate::processMessage(const QJsonDocument &message,
         && m_messagePreprocessor(message, error,
                                  [message, this](const QJsonRpcProtocol::Response &r) {
                                      Q_ASSERT(message.object().contains(u"id"));
-                                     this->sendMessage(createResponse(message.object()[u"id"], r));
+                                     this->sendResponse(message.object()[u"id"], r);
                                  })
                 != QJsonRpcProtocol::Processing::Continue) {
         return;
@@ -455,6 +538,66 @@ void QJsonRpcProtocolPrivate::processMessage(const QJsonDocument &message,
     }
 }
 
+/*!
+ * \internal
+ * Dispatches single requests and notifications whose handler accepts raw params without
+ * building a QJsonDocument: only the envelope is tokenized, and the handler receives the
+ * JSON text of the params.
+ * Returns false if the message has to go through processMessage instead.
+ */
+bool QJsonRpcProtocolPrivate::processRawMessage(const QByteArray &message)
+{
+    // the preprocessor works on the parsed document
+    if (m_messagePreprocessor)
+        return false;
+
+    using QTypedJson::JsonTape;
+    const JsonTape envelope(message, 1);
+    if (!envelope.isValid() || envelope.at(0).type != JsonTape::TokenType::Object)
+        return false;
+    const qint32 methodToken = envelope.findMember(0, "method");
+    if (methodToken < 0 || envelope.at(methodToken).type != JsonTape::TokenType::String)
+        return false;
+    const QString method = QString::fromUtf8(envelope.string(methodToken));
+    MessageHandler *handler = messageHandler(method);
+    if (!handler || !handler->acceptsRawParams())
+        return false;
+
+    QByteArray rawParams;
+    if (const qint32 paramsToken = envelope.findMember(0, "params"); paramsToken >= 0)
+        rawParams = envelope.rawValue(paramsToken).toByteArray();
+
+    const qint32 idToken = envelope.findMember(0, "id");
+    if (idToken < 0) {
+        handler->handleNotification(
+                QJsonRpcProtocol::Notification { method, QJsonValue::Undefined, rawParams });
+        return true;
+    }
+    switch (envelope.at(idToken).type) {
+    case JsonTape::TokenType::Null:
+    case JsonTape::TokenType::Number:
+    case JsonTape::TokenType::String:
+        break;
+    default:
+        return false;
+    }
+    const QJsonValue id = envelope.toJsonValue(idToken);
+    const QJsonRpcProtocol::Request request { id, method, QJsonValue::Undefined, rawParams };
+    handler->handleRequest(request, [id, this](const QJsonRpcProtocol::Response &response) {
+        sendResponse(id, response);
+    });
+    return true;
+}
+
+void QJsonRpcProtocolPrivate::sendResponse(const QJsonValue &id,
+                                           const QJsonRpcProtocol::Response &response)
+{
+    if (response.rawData.isNull())
+        sendMessage(createResponse(id, response));
+    else
+        sendRawMessage(createRawResponse(id, response));
+}
+
 QJsonRpcProtocol::MessageHandler::MessageHandler() = default;
 QJsonRpcProtocol::MessageHandler::~MessageHandler() = default;
 
@@ -471,6 +614,11 @@ void QJsonRpcProtocol::MessageHandler::handleNotification(
     Q_UNUSED(notification);
 }
 
+bool QJsonRpcProtocol::MessageHandler::acceptsRawParams() const
+{
+    return false;
+}
+
 QJsonRpcProtocol::Response QJsonRpcProtocol::MessageHandler::error(QJsonRpcProtocol::ErrorCode code)
 {
     return createPredefinedError(code);
@@ -503,7 +651,8 @@ void QJsonRpcProtocol::Batch::addNotification(const Notification &notification)
 {
     BatchPrivate::Item item;
     item.method = notification.method;
-    item.params = notification.params;
+    item.params = (notification.rawParams.isNull() ? notification.params
+                                                   : fromJsonText(notification.rawParams));
     d->m_items.push_back(std::move(item));
 }
 
@@ -512,7 +661,7 @@ void QJsonRpcProtocol::Batch::addRequest(const Request &request)
     BatchPrivate::Item item;
     item.id = request.id;
     item.method = request.method;
-    item.params = request.params;
+    item.params = (request.rawParams.isNull() ? request.params : fromJsonText(request.rawParams));
     d->m_items.push_back(std::move(item));
 }
 
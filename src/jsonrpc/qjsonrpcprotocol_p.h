@@ -49,6 +49,8 @@ public:
         QJsonValue id = QJsonValue::Undefined;
         QString method;
         QJsonValue params = QJsonValue::Undefined;
+        // JSON text of the params, set instead of params for handlers accepting raw params
+        QByteArray rawParams = QByteArray();
     };
 
     struct Response
@@ -66,6 +68,9 @@ public:
         QJsonValue errorCode = QJsonValue::Undefined;
 
         QString errorMessage = QString();
+
+        // JSON text of data, if not null it is sent instead of data
+        QByteArray rawData = QByteArray();
     };
 
     template<typename T>
@@ -75,6 +80,8 @@ public:
     {
         QString method;
         QJsonValue params = QJsonValue::Undefined;
+        // JSON text of the params, set instead of params for handlers accepting raw params
+        QByteArray rawParams = QByteArray();
     };
 
     class Q_JSONRPC_EXPORT MessageHandler
@@ -87,6 +94,7 @@ public:
         virtual ~MessageHandler();
         virtual void handleRequest(const Request &request, const ResponseHandler &handler);
         virtual void handleNotification(const Notification &notification);
+        virtual bool acceptsRawParams() const;
 
         static Response error(ErrorCode code);
         static Response error(int code, const QString &message,
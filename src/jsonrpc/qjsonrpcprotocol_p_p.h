@@ -47,6 +47,7 @@ public:
     using ResponseMap = Map<QJsonValue, QJsonRpcProtocol::Handler<QJsonRpcProtocol::Response>>;
 
     void processMessage(const QJsonDocument &message, const QJsonParseError &error);
+    bool processRawMessage(const QByteArray &message);
     void processError(const QString &error);
 
     template<typename JSON>
@@ -54,6 +55,8 @@ public:
     {
         m_transport->sendMessage(QJsonDocument(value));
     }
+    void sendRawMessage(const QByteArray &json) { m_transport->sendRawMessage(json); }
+    void sendResponse(const QJsonValue &id, const QJsonRpcProtocol::Response &response);
 
     void processRequest(const QJsonObject &object);
     void processResponse(const QJsonObject &object);
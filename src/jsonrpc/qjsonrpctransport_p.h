@@ -30,6 +30,9 @@ public:
     using MessageHandler = std::function<void(const QJsonDocument &, const QJsonParseError &)>;
     using DataHandler = std::function<void(const QByteArray &)>;
     using DiagnosticHandler = std::function<void(DiagnosticLevel, const QString &)>;
+    // Receives the unparsed body of a message, returns true if it did handle it, in which case
+    // the message is not parsed and messageHandler is not called.
+    using RawMessageHandler = std::function<bool(const QByteArray &)>;
 
     QJsonRpcTransport() = default;
     virtual ~QJsonRpcTransport() = default;
@@ -41,9 +44,19 @@ public:
     // Needs to be guarded by a mutex if called  by different threads
     virtual void sendMessage(const QJsonDocument &packet) = 0;
 
+    // Send a message that is already serialized as UTF-8 JSON text.
+    // Transports able to send the text directly should override this.
+    virtual void sendRawMessage(const QByteArray &json)
+    {
+        sendMessage(QJsonDocument::fromJson(json));
+    }
+
     void setMessageHandler(const MessageHandler &handler) { m_messageHandler = handler; }
     MessageHandler messageHandler() const { return m_messageHandler; }
 
+    void setRawMessageHandler(const RawMessageHandler &handler) { m_rawMessageHandler = handler; }
+    RawMessageHandler rawMessageHandler() const { return m_rawMessageHandler; }
+
     void setDataHandler(const DataHandler &handler) { m_dataHandler = handler; }
     DataHandler dataHandler() const { return m_dataHandler; }
 
@@ -52,6 +65,7 @@ public:
 
 private:
     MessageHandler m_messageHandler;
+    RawMessageHandler m_rawMessageHandler;
     DataHandler m_dataHandler;
     DiagnosticHandler m_diagnosticHandler;
 };
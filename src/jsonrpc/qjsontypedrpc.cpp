@@ -33,11 +33,39 @@ void TypedResponse::doOnCloseActions()
     m_onCloseActions.clear();
 }
 
+void TypedResponse::sendSuccessfullResponseText(const QByteArray &text)
+{
+    if (m_status == Status::Started) {
+        m_status = Status::SentSuccess;
+        const QByteArray resultText = m_resultTextFilter ? m_resultTextFilter(text) : text;
+        if (m_resultTextObserver)
+            m_resultTextObserver(resultText);
+        m_responseHandler(QJsonRpcProtocol::Response { QTypedJson::toJsonValue(m_id),
+                                                       QJsonValue::Undefined, QJsonValue::Undefined,
+                                                       QString(), resultText });
+        doOnCloseActions();
+    } else {
+        qCWarning(QTypedJson::jsonRpcLog)
+                << "Ignoring response in already answered request" << idStr();
+    }
+}
+
 void TypedResponse::sendErrorResponse(int code, const QByteArray &message)
 {
     sendErrorResponse<std::optional<int>>(code, message, std::optional<int>());
 }
 
+void TypedResponse::sendNotificationText(const QByteArray &method, const QByteArray &paramsText)
+{
+    m_typedRpc->sendNotificationText(method, paramsText);
+}
+
+void TypedRpc::sendNotificationText(const QByteArray &method, const QByteArray &paramsText)
+{
+    QJsonRpcProtocol::sendNotification(
+            Notification { QString::fromUtf8(method), QJsonValue::Undefined, paramsText });
+}
+
 void TypedRpc::installOnCloseAction(const TypedResponse::OnCloseAction &closeAction)
 {
     m_onCloseAction = closeAction;
@@ -18,6 +18,8 @@
 #include <QtJsonRpc/private/qjsonrpcprotocol_p.h>
 #include <QtJsonRpc/private/qjsonrpctransport_p.h>
 #include <QtJsonRpc/private/qtypedjson_p.h>
+#include <QtJsonRpc/private/qtypedjsontextreader_p.h>
+#include <QtJsonRpc/private/qtypedjsontextwriter_p.h>
 #include <QtCore/qjsondocument.h>
 #include <functional>
 #include <variant>
@@ -43,6 +45,27 @@ QString idToString(const std::variant<T...> &v)
     return std::visit(toStr, v);
 }
 
+// Decodes params into value with a reader R, and returns the errors found. Errors are rare, so
+// the params are decoded without collecting errors, and decoded again only to report them.
+template<typename R, typename P, typename T>
+QStringList decodeParams(const P &params, T &value)
+{
+    {
+        R r(params);
+        r.setCollectErrors(false);
+        QTypedJson::doWalk(r, value);
+        if (!r.failed())
+            return {};
+        r.clearErrorMessages();
+    }
+    value = T();
+    R r(params);
+    QTypedJson::doWalk(r, value);
+    const QStringList errors = r.errorMessages();
+    r.clearErrorMessages();
+    return errors;
+}
+
 // concurrent usage by multiple threads not supported, the user should take care
 class Q_JSONRPC_EXPORT TypedResponse
 {
@@ -61,7 +84,9 @@ public:
         : m_status(o.m_status),
           m_id(o.m_id),
           m_typedRpc(o.m_typedRpc),
-          m_responseHandler(std::move(o.m_responseHandler))
+          m_responseHandler(std::move(o.m_responseHandler)),
+          m_resultTextFilter(std::move(o.m_resultTextFilter)),
+          m_resultTextObserver(std::move(o.m_resultTextObserver))
     {
         o.m_status = Status::Invalid;
     }
@@ -71,6 +96,8 @@ public:
         m_id = o.m_id;
         m_typedRpc = o.m_typedRpc;
         m_responseHandler = std::move(o.m_responseHandler);
+        m_resultTextFilter = std::move(o.m_resultTextFilter);
+        m_resultTextObserver = std::move(o.m_resultTextObserver);
         o.m_status = Status::Invalid;
         return *this;
     }
@@ -84,11 +111,14 @@ public:
 
     template<typename T>
     void sendSuccessfullResponse(const T &result);
+    // sends a result that was already written as json text
+    void sendSuccessfullResponseText(const QByteArray &resultText);
     template<typename T>
     void sendErrorResponse(int code, const QByteArray &message, const T &data);
     void sendErrorResponse(int code, const QByteArray &message);
     template<typename... Params>
     void sendNotification(const QByteArray &method, const Params &...params);
+    void sendNotificationText(const QByteArray &method, const QByteArray &paramsText);
 
     IdType id() const { return m_id; }
     QString idStr()
@@ -102,6 +132,15 @@ public:
     }
     using OnCloseAction = std::function<void(Status, const IdType &, TypedRpc &)>;
     void addOnCloseAction(const OnCloseAction &act);
+    // called with the json text of the result when a successful response is sent
+    using ResultTextObserver = std::function<void(const QByteArray &)>;
+    void setResultTextObserver(const ResultTextObserver &observer)
+    {
+        m_resultTextObserver = observer;
+    }
+    // rewrites the json text of the result before it is sent
+    using ResultTextFilter = std::function<QByteArray(const QByteArray &)>;
+    void setResultTextFilter(const ResultTextFilter &filter) { m_resultTextFilter = filter; }
 
 private:
     void doOnCloseActions();
@@ -110,6 +149,8 @@ private:
     TypedRpc *m_typedRpc = nullptr;
     QJsonRpcProtocol::ResponseHandler m_responseHandler;
     QList<OnCloseAction> m_onCloseActions;
+    ResultTextFilter m_resultTextFilter;
+    ResultTextObserver m_resultTextObserver;
 };
 
 class Q_JSONRPC_EXPORT TypedHandler : public QJsonRpcProtocol::MessageHandler
@@ -160,6 +201,9 @@ public:
 
     QByteArray method() const { return m_method; }
 
+    bool acceptsRawParams() const override { return m_acceptsRawParams; }
+    void setAcceptsRawParams(bool accepts) { m_acceptsRawParams = accepts; }
+
     void handleNotification(const QJsonRpcProtocol::Notification &notification) override
     {
         if (m_notificationHandler) {
@@ -180,6 +224,20 @@ private:
                        const QJsonRpcProtocol::ResponseHandler &)>
             m_requestHandler;
     std::function<void(const QJsonRpcProtocol::Notification &)> m_notificationHandler;
+    bool m_acceptsRawParams = false;
+};
+
+// responses may take information from their request, like the token for partial results
+template<typename Resp, typename Req, typename = void>
+struct HasInitFromRequest : std::false_type
+{
+};
+
+template<typename Resp, typename Req>
+struct HasInitFromRequest<Resp, Req,
+                          std::void_t<decltype(std::declval<Resp &>().initFromRequest(
+                                  std::declval<const Req &>()))>> : std::true_type
+{
 };
 
 class Q_JSONRPC_EXPORT TypedRpc : public QJsonRpcProtocol
@@ -194,8 +252,8 @@ public:
                        const Params &...params)
     {
         QJsonRpcProtocol::sendRequest(Request { QTypedJson::toJsonValue(id),
-                                                QString::fromUtf8(method),
-                                                QTypedJson::toJsonValue(params...) },
+                                                QString::fromUtf8(method), QJsonValue::Undefined,
+                                                QTypedJson::toJsonText(params...) },
                                       rHandler);
     }
 
@@ -210,14 +268,20 @@ public:
     template<typename... Params>
     void sendNotification(const QByteArray &method, const Params &...params)
     {
-        QJsonRpcProtocol::sendNotification(
-                Notification { QString::fromUtf8(method), QTypedJson::toJsonValue(params...) });
+        QJsonRpcProtocol::sendNotification(Notification { QString::fromUtf8(method),
+                                                          QJsonValue::Undefined,
+                                                          QTypedJson::toJsonText(params...) });
     }
 
+    // sends a notification whose params were already written as json text
+    void sendNotificationText(const QByteArray &method, const QByteArray &paramsText);
+
+    // the decoded parameters are moved into the handler, which can take them as const Req &,
+    // Req or Req &&
     template<typename Req, typename Resp>
     void registerRequestHandler(
             const QByteArray &method,
-            const std::function<void(const QByteArray &, const Req &, Resp &&)> &handler)
+            const std::function<void(const QByteArray &, Req, Resp &&)> &handler)
     {
         if (m_handlers.contains(method) && handler) {
             qCWarning(QTypedJson::jsonRpcLog)
@@ -236,30 +300,34 @@ public:
                             id = req.id.toString().toUtf8();
                         TypedResponse typedResponse(id, this, rH);
                         Req tReq;
-                        {
-                            QTypedJson::Reader r(req.params);
-                            QTypedJson::doWalk(r, tReq);
-                            if (!r.errorMessages().isEmpty()) {
+                        auto warn = [&](const auto &params, const QStringList &errors) {
+                            if (!errors.isEmpty()) {
                                 qCWarning(QTypedJson::jsonRpcLog)
                                         << "Warnings decoding parameters for Request" << method
-                                        << idToString(id) << "from" << req.params << ":\n    "
-                                        << r.errorMessages().join(u"\n    ");
-                                r.clearErrorMessages();
+                                        << idToString(id) << "from" << params << ":\n    "
+                                        << errors.join(u"\n    ");
                             }
-                        }
+                        };
+                        if (req.rawParams.isNull())
+                            warn(req.params, decodeParams<QTypedJson::Reader>(req.params, tReq));
+                        else
+                            warn(req.rawParams,
+                                 decodeParams<QTypedJson::TextReader>(req.rawParams, tReq));
                         Resp myResponse(std::move(typedResponse));
-                        handler(method, tReq, std::move(myResponse));
+                        if constexpr (HasInitFromRequest<Resp, Req>::value)
+                            myResponse.initFromRequest(tReq);
+                        handler(method, std::move(tReq), std::move(myResponse));
                     });
         else
             h = new TypedHandler;
+        h->setAcceptsRawParams(bool(handler));
         m_handlers[method] = h;
         setMessageHandler(QString::fromUtf8(method), h);
     }
 
     template<typename N>
     void registerNotificationHandler(
-            const QByteArray &method,
-            const std::function<void(const QByteArray &, const N &)> &handler)
+            const QByteArray &method, const std::function<void(const QByteArray &, N)> &handler)
     {
         if (m_handlers.contains(method) && handler) {
             qCWarning(QTypedJson::jsonRpcLog)
@@ -272,21 +340,24 @@ public:
             h = new TypedHandler(
                     method, [handler, method](const QJsonRpcProtocol::Notification &notif) {
                         N tNotif;
-                        {
-                            QTypedJson::Reader r(notif.params);
-                            QTypedJson::doWalk(r, tNotif);
-                            if (!r.errorMessages().isEmpty()) {
+                        auto warn = [&](const auto &params, const QStringList &errors) {
+                            if (!errors.isEmpty()) {
                                 qCWarning(QTypedJson::jsonRpcLog)
                                         << "Warnings decoding parameters for Notification" << method
-                                        << "from" << notif.params << ":\n    "
-                                        << r.errorMessages().join(u"\n    ");
-                                r.clearErrorMessages();
+                                        << "from" << params << ":\n    " << errors.join(u"\n    ");
                             }
-                        }
-                        handler(method, tNotif);
+                        };
+                        if (notif.rawParams.isNull())
+                            warn(notif.params,
+                                 decodeParams<QTypedJson::Reader>(notif.params, tNotif));
+                        else
+                            warn(notif.rawParams,
+                                 decodeParams<QTypedJson::TextReader>(notif.rawParams, tNotif));
+                        handler(method, std::move(tNotif));
                     });
         else
             h = new TypedHandler;
+        h->setAcceptsRawParams(bool(handler));
         setMessageHandler(QString::fromUtf8(method), h);
         m_handlers[method] = h;
     }
@@ -309,12 +380,9 @@ template<typename T>
 void TypedResponse::sendSuccessfullResponse(const T &result)
 {
     if (m_status == Status::Started) {
-        m_status = Status::SentSuccess;
-        m_responseHandler(QJsonRpcProtocol::Response {
-            QTypedJson::toJsonValue(m_id),
-            QTypedJson::toJsonValue(result)
-        });
-        doOnCloseActions();
+        const QByteArray resultText = QTypedJson::toJsonText(result);
+        // a successful response always has a result member
+        sendSuccessfullResponseText(resultText.isNull() ? QByteArrayLiteral("null") : resultText);
     } else {
         qCWarning(QTypedJson::jsonRpcLog)
                 << "Ignoring response in already answered request" << idStr();
@@ -0,0 +1,894 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qtypedcbor_p.h"
+#include <QtCore/qcborarray.h>
+#include <QtCore/qcbormap.h>
+#include <QtCore/qcborvalue.h>
+#include <QtCore/qjsonarray.h>
+#include <QtCore/qjsonobject.h>
+#include <QtCore/qutf8stringview.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+namespace QTypedJson {
+
+/*!
+ * \internal
+ * \class QTypedJson::CborWriter
+ * \brief Walker that writes typed values as CBOR
+ *
+ * The data model is the one of JSON: objects become maps with text keys (written in walk
+ * order), QByteArray fields text strings, and doubles without fractional part integers.
+ * So toCbor(v) decodes to QCborValue::fromJsonValue(toJsonValue(v)), but is much smaller and
+ * cheaper to produce and to parse than the JSON text, which makes it suitable to store values
+ * or pass them to other processes.
+ */
+
+QByteArray CborWriter::takeData()
+{
+    Q_ASSERT(!m_hasPendingKey);
+    QByteArray res = std::move(m_data);
+    m_data = QByteArray();
+    if (res.isEmpty())
+        return QByteArray();
+    return res;
+}
+
+void CborWriter::startValue()
+{
+    if (m_hasPendingKey) {
+        m_writer.appendTextString(m_pendingKey.constData(), m_pendingKey.size());
+        m_hasPendingKey = false;
+    }
+}
+
+void CborWriter::handleBasic(const bool &v)
+{
+    startValue();
+    m_writer.append(v);
+}
+
+void CborWriter::handleBasic(const QByteArray &v)
+{
+    startValue();
+    // invalid sequences are replaced like QString::fromUtf8 would do
+    if (!QUtf8StringView(v.constData(), v.size()).isValidUtf8()) {
+        const QByteArray valid = QString::fromUtf8(v).toUtf8();
+        m_writer.appendTextString(valid.constData(), valid.size());
+    } else {
+        m_writer.appendTextString(v.constData(), v.size());
+    }
+}
+
+void CborWriter::handleBasic(const int &v)
+{
+    startValue();
+    m_writer.append(qint64(v));
+}
+
+void CborWriter::handleBasic(const double &v)
+{
+    startValue();
+    if (!std::isfinite(v))
+        m_writer.append(nullptr); // like QJsonValue
+    else if (v == std::floor(v) && std::abs(v) < (1LL << std::numeric_limits<double>::digits))
+        m_writer.append(qint64(v));
+    else
+        m_writer.append(v);
+}
+
+void CborWriter::handleNullType()
+{
+    startValue();
+    m_writer.append(nullptr);
+}
+
+void CborWriter::handleMissingOptional()
+{
+    // missing fields are skipped, missing elements written as null
+    if (m_hasPendingKey)
+        m_hasPendingKey = false;
+    else
+        handleNullType();
+}
+
+void CborWriter::handleJson(QJsonValue &v)
+{
+    if (v.isUndefined()) {
+        handleMissingOptional();
+        return;
+    }
+    startValue();
+    QCborValue::fromJsonValue(v).toCbor(m_writer);
+}
+
+void CborWriter::handleJson(QJsonObject &v)
+{
+    startValue();
+    QCborMap::fromJsonObject(v).toCborValue().toCbor(m_writer);
+}
+
+void CborWriter::handleJson(QJsonArray &v)
+{
+    startValue();
+    QCborArray::fromJsonArray(v).toCborValue().toCbor(m_writer);
+}
+
+bool CborWriter::startField(const QString &fieldName)
+{
+    m_pendingKey = fieldName.toUtf8();
+    m_hasPendingKey = true;
+    return true;
+}
+
+bool CborWriter::startField(const char *fieldName)
+{
+    m_pendingKey = QByteArray::fromRawData(fieldName, qstrlen(fieldName));
+    m_hasPendingKey = true;
+    return true;
+}
+
+bool CborWriter::startField(const FieldName &fieldName)
+{
+    m_pendingKey = QByteArray::fromRawData(fieldName.name.data(), fieldName.name.size());
+    m_hasPendingKey = true;
+    return true;
+}
+
+void CborWriter::endField(const QString &)
+{
+    m_hasPendingKey = false;
+}
+
+void CborWriter::endField(const char *)
+{
+    m_hasPendingKey = false;
+}
+
+void CborWriter::endField(const FieldName &)
+{
+    m_hasPendingKey = false;
+}
+
+bool CborWriter::startObjectF(const char *, ObjectOptions, quintptr)
+{
+    startValue();
+    // the number of members is not known in advance, as missing optional fields are skipped
+    m_writer.startMap();
+    return true;
+}
+
+void CborWriter::endObjectF(const char *, ObjectOptions, quintptr)
+{
+    m_writer.endMap();
+}
+
+bool CborWriter::startArrayF(qint32 &size)
+{
+    startValue();
+    m_writer.startArray(quint64(size));
+    return true;
+}
+
+void CborWriter::endArrayF(qint32 &)
+{
+    m_writer.endArray();
+}
+
+bool CborWriter::startElement(qint32)
+{
+    return true;
+}
+
+void CborWriter::endElement(qint32) { }
+
+bool CborWriter::startTuple(qint32 size)
+{
+    return startArrayF(size);
+}
+
+void CborWriter::endTuple(qint32 size)
+{
+    endArrayF(size);
+}
+
+/*!
+ * \internal
+ * \class QTypedJson::CborTape
+ * \brief Reads CBOR data in a single pass into a flat list of tokens
+ *
+ * Works like JsonTape: the data is streamed once with QCborStreamReader, each value gets a
+ * token, containers are followed by the tokens of their children (key and value alternating
+ * for maps), and Token::next allows skipping a whole subtree. Numbers are decoded in their
+ * token, and the UTF-8 content of all strings is appended to a single buffer, so reading a
+ * message allocates the token list and that buffer, instead of a QCborValue tree.
+ *
+ * The data model is the one of QCborValue::toJsonValue(): map keys must be text strings, tags
+ * are dropped, byte arrays become base64url strings, and integers outside of the qint64 range
+ * doubles.
+ */
+
+namespace {
+constexpr int MaxNesting = 1024;
+} // namespace
+
+CborTape::CborTape(const QByteArray &data)
+{
+    QCborStreamReader reader(data);
+    if (!parseValue(reader, 0))
+        return;
+    if (reader.currentOffset() != data.size())
+        fail(QStringLiteral(u"Garbage at the end of the data"), reader.currentOffset());
+}
+
+bool CborTape::fail(QCborStreamReader &reader)
+{
+    return fail(reader.lastError().toString(), reader.currentOffset());
+}
+
+bool CborTape::fail(const QString &msg, qint64 offset)
+{
+    m_error = msg;
+    m_errorOffset = offset;
+    m_tokens.clear();
+    return false;
+}
+
+qint32 CborTape::addToken(TokenType type)
+{
+    const qint32 index = qint32(m_tokens.size());
+    m_tokens.append(Token { type, index + 1 });
+    return index;
+}
+
+void CborTape::addString(QByteArrayView string)
+{
+    Token &t = m_tokens[addToken(TokenType::String)];
+    t.begin = m_strings.size();
+    m_strings.append(string);
+    t.end = m_strings.size();
+    t.hash = fieldNameHash(string.data(), string.size());
+}
+
+bool CborTape::parseString(QCborStreamReader &reader)
+{
+    const qsizetype begin = m_strings.size();
+    if (!reader.readAndAppendToUtf8String(m_strings))
+        return fail(reader);
+    Token &t = m_tokens[addToken(TokenType::String)];
+    t.begin = begin;
+    t.end = m_strings.size();
+    t.hash = fieldNameHash(m_strings.constData() + begin, t.end - begin);
+    return true;
+}
+
+bool CborTape::parseValue(QCborStreamReader &reader, int depth)
+{
+    switch (reader.type()) {
+    case QCborStreamReader::UnsignedInteger: {
+        const quint64 v = reader.toUnsignedInteger();
+        if (v > quint64(std::numeric_limits<qint64>::max()))
+            m_tokens[addToken(TokenType::Double)].number = double(v);
+        else
+            m_tokens[addToken(TokenType::Integer)].integer = qint64(v);
+        break;
+    }
+    case QCborStreamReader::NegativeInteger: {
+        // the value is -v, and 0 stands for -2^64
+        const quint64 v = quint64(reader.toNegativeInteger());
+        if (v == 0)
+            m_tokens[addToken(TokenType::Double)].number = -18446744073709551616.0;
+        else if (v > quint64(std::numeric_limits<qint64>::max()) + 1)
+            m_tokens[addToken(TokenType::Double)].number = -double(v);
+        else
+            m_tokens[addToken(TokenType::Integer)].integer = -qint64(v - 1) - 1;
+        break;
+    }
+    case QCborStreamReader::Float16:
+        m_tokens[addToken(TokenType::Double)].number = double(float(reader.toFloat16()));
+        break;
+    case QCborStreamReader::Float:
+        m_tokens[addToken(TokenType::Double)].number = double(reader.toFloat());
+        break;
+    case QCborStreamReader::Double:
+        m_tokens[addToken(TokenType::Double)].number = reader.toDouble();
+        break;
+    case QCborStreamReader::String:
+        // reading the string moves to the next value
+        return parseString(reader);
+    case QCborStreamReader::ByteArray: {
+        QByteArray bytes;
+        if (!reader.readAndAppendToByteArray(bytes))
+            return fail(reader);
+        addString(bytes.toBase64(QByteArray::Base64UrlEncoding | QByteArray::OmitTrailingEquals));
+        return true;
+    }
+    case QCborStreamReader::Map:
+        return parseContainer(reader, depth, TokenType::Map);
+    case QCborStreamReader::Array:
+        return parseContainer(reader, depth, TokenType::Array);
+    case QCborStreamReader::Tag:
+        if (!reader.next())
+            return fail(reader);
+        return parseValue(reader, depth);
+    case QCborStreamReader::SimpleType:
+        switch (reader.toSimpleType()) {
+        case QCborSimpleType::False:
+            addToken(TokenType::False);
+            break;
+        case QCborSimpleType::True:
+            addToken(TokenType::True);
+            break;
+        case QCborSimpleType::Null:
+            addToken(TokenType::Null);
+            break;
+        case QCborSimpleType::Undefined:
+            addToken(TokenType::Undefined);
+            break;
+        default:
+            addString(QByteArray("simple(")
+                      + QByteArray::number(int(reader.toSimpleType())) + ')');
+            break;
+        }
+        break;
+    case QCborStreamReader::Invalid:
+        return fail(reader);
+    }
+    if (!reader.next())
+        return fail(reader);
+    return true;
+}
+
+bool CborTape::parseContainer(QCborStreamReader &reader, int depth, TokenType type)
+{
+    if (depth >= MaxNesting)
+        return fail(QStringLiteral(u"Data too deeply nested"), reader.currentOffset());
+    const qint32 index = addToken(type);
+    if (!reader.enterContainer())
+        return fail(reader);
+    qint32 count = 0;
+    while (reader.hasNext()) {
+        if (type == TokenType::Map) {
+            if (!reader.isString())
+                return fail(QStringLiteral(u"Map key is not a string"), reader.currentOffset());
+            if (!parseString(reader))
+                return false;
+        }
+        if (!parseValue(reader, depth + 1))
+            return false;
+        ++count;
+    }
+    if (reader.lastError() != QCborError::NoError || !reader.leaveContainer())
+        return fail(reader);
+    m_tokens[index].count = count;
+    m_tokens[index].next = qint32(m_tokens.size());
+    return true;
+}
+
+// the UTF-8 content of a string token
+QByteArrayView CborTape::stringView(qint32 index) const
+{
+    const Token &t = m_tokens.at(index);
+    if (t.type != TokenType::String)
+        return QByteArrayView();
+    return QByteArrayView(m_strings.constData() + t.begin, t.end - t.begin);
+}
+
+bool CborTape::keyEquals(qint32 keyIndex, QByteArrayView key) const
+{
+    return stringView(keyIndex) == key;
+}
+
+bool CborTape::keyEquals(qint32 keyIndex, const FieldName &key) const
+{
+    return m_tokens.at(keyIndex).hash == key.hash
+            && stringView(keyIndex) == QByteArrayView(key.name.data(), key.name.size());
+}
+
+qint32 CborTape::findMember(qint32 mapIndex, const FieldName &key) const
+{
+    const Token &m = m_tokens.at(mapIndex);
+    if (m.type != TokenType::Map)
+        return -1;
+    qint32 keyIndex = mapIndex + 1;
+    for (qint32 i = 0; i < m.count; ++i) {
+        if (keyEquals(keyIndex, key))
+            return keyIndex + 1;
+        keyIndex = m_tokens.at(keyIndex + 1).next;
+    }
+    return -1;
+}
+
+// the same conversion as QCborValue::toJsonValue()
+QJsonValue CborTape::toJsonValue(qint32 index) const
+{
+    const Token &t = m_tokens.at(index);
+    switch (t.type) {
+    case TokenType::Null:
+    case TokenType::Undefined:
+        return QJsonValue(QJsonValue::Null);
+    case TokenType::True:
+        return QJsonValue(true);
+    case TokenType::False:
+        return QJsonValue(false);
+    case TokenType::Integer:
+        return QJsonValue(t.integer);
+    case TokenType::Double:
+        if (!std::isfinite(t.number))
+            return QJsonValue(QJsonValue::Null);
+        return QJsonValue(t.number);
+    case TokenType::String:
+        return QJsonValue(QString::fromUtf8(stringView(index)));
+    case TokenType::Map: {
+        QJsonObject res;
+        qint32 keyIndex = index + 1;
+        for (qint32 i = 0; i < t.count; ++i) {
+            res.insert(QString::fromUtf8(stringView(keyIndex)), toJsonValue(keyIndex + 1));
+            keyIndex = m_tokens.at(keyIndex + 1).next;
+        }
+        return res;
+    }
+    case TokenType::Array: {
+        QJsonArray res;
+        qint32 elIndex = index + 1;
+        for (qint32 i = 0; i < t.count; ++i) {
+            res.append(toJsonValue(elIndex));
+            elIndex = m_tokens.at(elIndex).next;
+        }
+        return res;
+    }
+    }
+    return QJsonValue(QJsonValue::Undefined);
+}
+
+/*!
+ * \internal
+ * \class QTypedJson::CborReader
+ * \brief Walker that decodes typed values from CBOR
+ *
+ * Reads what CborWriter writes, reporting errors like Reader. Integers and doubles are
+ * interchangeable, as they are in JSON. Like TextReader, it walks a CborTape built by streaming
+ * the data once, instead of building a QCborValue first.
+ */
+
+CborReader::CborReader(const QByteArray &cbor) : m_tape(cbor), m_p(new CborReaderPrivate)
+{
+    m_p->valuesStack.append(CborReaderPrivate::ValueStack { m_tape.isValid() ? 0 : -1 });
+    if (!m_tape.isValid()) {
+        ReaderError error;
+        error.kind = ReaderError::Kind::InvalidCbor;
+        error.value = m_tape.errorString();
+        error.size = qint32(m_tape.errorOffset());
+        warn(std::move(error));
+    }
+}
+
+CborReader::~CborReader()
+{
+    for (const ReaderError &error : std::as_const(m_p->errors))
+        qCWarning(jsonRpcLog) << error.toString();
+    delete m_p;
+}
+
+QStringList CborReader::errorMessages()
+{
+    QStringList res;
+    res.reserve(m_p->errors.size());
+    for (const ReaderError &error : std::as_const(m_p->errors))
+        res.append(error.toString());
+    return res;
+}
+
+bool CborReader::hasErrors() const
+{
+    return !m_p->errors.isEmpty();
+}
+
+void CborReader::clearErrorMessages()
+{
+    m_p->errors.clear();
+}
+
+bool CborReader::failed() const
+{
+    return m_p->parseStatus == ParseStatus::Failed;
+}
+
+bool CborReader::collectErrors() const
+{
+    return m_p->collectErrors;
+}
+
+void CborReader::setCollectErrors(bool collectErrors)
+{
+    m_p->collectErrors = collectErrors;
+}
+
+QByteArrayView CborReader::currentString() const
+{
+    const qint32 token = currentToken();
+    return (token < 0 ? QByteArrayView() : m_tape.stringView(token));
+}
+
+void CborReader::handleBasic(bool &el)
+{
+    if (isCurrent(CborTape::TokenType::True))
+        el = true;
+    else if (isCurrent(CborTape::TokenType::False))
+        el = false;
+    else
+        warnMissing(u"bool");
+}
+
+void CborReader::handleBasic(QByteArray &el)
+{
+    if (isCurrent(CborTape::TokenType::String))
+        el = m_tape.string(currentToken());
+    else
+        warnMissing(u"string");
+}
+
+void CborReader::handleBasic(int &el)
+{
+    if (isCurrent(CborTape::TokenType::Integer)) {
+        const qint64 v = m_tape.at(currentToken()).integer;
+        if (v >= std::numeric_limits<int>::min() && v <= std::numeric_limits<int>::max())
+            el = int(v);
+    } else if (isCurrent(CborTape::TokenType::Double)) {
+        el = QJsonValue(m_tape.at(currentToken()).number).toInt(el);
+    } else {
+        warnMissing(u"int");
+    }
+}
+
+void CborReader::handleBasic(double &el)
+{
+    if (isCurrent(CborTape::TokenType::Integer))
+        el = double(m_tape.at(currentToken()).integer);
+    else if (isCurrent(CborTape::TokenType::Double))
+        el = m_tape.at(currentToken()).number;
+    else
+        warnMissing(u"double");
+}
+
+void CborReader::handleNullType()
+{
+    if (!isNullOrMissing())
+        warnNonNull();
+}
+
+template<typename Key>
+qint32 CborReader::findField(const Key &fieldName)
+{
+    CborReaderPrivate::ObjectStack &o = m_p->objectsStack.last();
+    if (o.token < 0)
+        return -1;
+    const qint32 count = m_tape.at(o.token).count;
+    qint32 member = o.nextMember;
+    qint32 key = o.nextKey;
+    for (qint32 i = 0; i < count; ++i) {
+        const qint32 value = key + 1;
+        const qint32 nextMember = member + 1;
+        const qint32 nextKey = m_tape.at(value).next;
+        if (nextMember < count) {
+            o.nextMember = nextMember;
+            o.nextKey = nextKey;
+        } else {
+            o.nextMember = 0;
+            o.nextKey = o.token + 1;
+        }
+        if (m_tape.keyEquals(key, fieldName)) {
+            o.visitedMembers.setBit(member);
+            return value;
+        }
+        member = o.nextMember;
+        key = o.nextKey;
+    }
+    // not found, the next search starts where this one did
+    o.nextMember = member;
+    o.nextKey = key;
+    return -1;
+}
+
+bool CborReader::startField(const QString &fieldName)
+{
+    const qint32 token = findField(QByteArrayView(fieldName.toUtf8()));
+    m_p->valuesStack.append(
+            CborReaderPrivate::ValueStack { token, QLatin1StringView(), fieldName });
+    return true;
+}
+
+bool CborReader::startField(const char *fieldName)
+{
+    const qint32 token = findField(QByteArrayView(fieldName));
+    m_p->valuesStack.append(CborReaderPrivate::ValueStack { token, QLatin1StringView(fieldName) });
+    return true;
+}
+
+bool CborReader::startField(const FieldName &fieldName)
+{
+    const qint32 token = findField(fieldName);
+    m_p->valuesStack.append(CborReaderPrivate::ValueStack { token, fieldName.name });
+    return true;
+}
+
+void CborReader::endField(const QString &fieldName)
+{
+    Q_ASSERT(m_p->valuesStack.last().fieldPath == fieldName);
+    Q_UNUSED(fieldName);
+    m_p->valuesStack.removeLast();
+}
+
+void CborReader::endField(const char *fieldName)
+{
+    Q_ASSERT(m_p->valuesStack.last().fieldName == QLatin1StringView(fieldName));
+    Q_UNUSED(fieldName);
+    m_p->valuesStack.removeLast();
+}
+
+void CborReader::endField(const FieldName &fieldName)
+{
+    Q_ASSERT(m_p->valuesStack.last().fieldName == fieldName.name);
+    Q_UNUSED(fieldName);
+    m_p->valuesStack.removeLast();
+}
+
+bool CborReader::startObjectF(const char *type, ObjectOptions options, quintptr)
+{
+    if (m_p->parseStatus != ParseStatus::Normal)
+        return false;
+    const qint32 token = currentToken();
+    if (token < 0 || isCurrent(CborTape::TokenType::Undefined)) {
+        m_p->parseStatus = ParseStatus::Failed;
+        return false;
+    }
+    CborReaderPrivate::ObjectStack o { type, options };
+    if (m_tape.at(token).type == CborTape::TokenType::Map) {
+        o.token = token;
+        o.visitedMembers = VisitedMembers(m_tape.at(token).count);
+        o.nextKey = token + 1;
+    }
+    m_p->objectsStack.append(o);
+    return true;
+}
+
+void CborReader::endObjectF(const char *type, ObjectOptions, quintptr)
+{
+    Q_ASSERT(std::strcmp(m_p->objectsStack.last().type, type) == 0);
+    Q_UNUSED(type);
+    m_p->objectsStack.removeLast();
+}
+
+QJsonObject CborReader::getExtraFields() const
+{
+    QJsonObject extraFields;
+    const CborReaderPrivate::ObjectStack &o = m_p->objectsStack.last();
+    if (o.token < 0)
+        return extraFields;
+    const qint32 count = m_tape.at(o.token).count;
+    qint32 key = o.token + 1;
+    for (qint32 i = 0; i < count; ++i) {
+        if (!o.visitedMembers.testBit(i)) {
+            extraFields.insert(QString::fromUtf8(m_tape.stringView(key)),
+                               m_tape.toJsonValue(key + 1));
+        }
+        key = m_tape.at(key + 1).next;
+    }
+    return extraFields;
+}
+
+QJsonValue::Type CborReader::currentType() const
+{
+    const qint32 token = currentToken();
+    if (token < 0)
+        return QJsonValue::Undefined;
+    switch (m_tape.at(token).type) {
+    case CborTape::TokenType::Null:
+        return QJsonValue::Null;
+    case CborTape::TokenType::Undefined:
+        return QJsonValue::Undefined;
+    case CborTape::TokenType::True:
+    case CborTape::TokenType::False:
+        return QJsonValue::Bool;
+    case CborTape::TokenType::Integer:
+    case CborTape::TokenType::Double:
+        return QJsonValue::Double;
+    case CborTape::TokenType::String:
+        return QJsonValue::String;
+    case CborTape::TokenType::Map:
+        return QJsonValue::Object;
+    case CborTape::TokenType::Array:
+        return QJsonValue::Array;
+    }
+    return QJsonValue::Undefined;
+}
+
+bool CborReader::hasCurrentField(const FieldName &fieldName) const
+{
+    const qint32 token = currentToken();
+    return token >= 0 && m_tape.findMember(token, fieldName) >= 0;
+}
+
+bool CborReader::currentFieldEquals(const FieldName &fieldName, QLatin1StringView value) const
+{
+    const qint32 token = currentToken();
+    const qint32 member = (token < 0 ? -1 : m_tape.findMember(token, fieldName));
+    return member >= 0 && m_tape.at(member).type == CborTape::TokenType::String
+            && m_tape.stringView(member) == QByteArrayView(value.data(), value.size());
+}
+
+bool CborReader::failSilently()
+{
+    if (!m_p->suppressErrors && m_p->collectErrors)
+        return false;
+    m_p->parseStatus = ParseStatus::Failed;
+    return true;
+}
+
+void CborReader::warnExtra(const QJsonObject &e)
+{
+    if (e.constBegin() == e.constEnd())
+        return;
+    ReaderError error;
+    error.kind = ReaderError::Kind::Extra;
+    error.value = e;
+    warn(std::move(error));
+}
+
+void CborReader::warnInvalidSize(qint32 size, qint32 expectedSize)
+{
+    if (size == expectedSize)
+        return;
+    ReaderError error;
+    error.kind = ReaderError::Kind::InvalidSize;
+    error.size = size;
+    error.expectedSize = expectedSize;
+    warn(std::move(error));
+}
+
+void CborReader::warnMissing(QStringView s)
+{
+    ReaderError error;
+    error.kind = ReaderError::Kind::Missing;
+    error.expectedType = s;
+    warn(std::move(error));
+}
+
+void CborReader::warnNonNull()
+{
+    // the value is only converted if the error is recorded
+    if (failSilently())
+        return;
+    ReaderError error;
+    error.kind = ReaderError::Kind::NonNull;
+    error.value = currentValue();
+    warn(std::move(error));
+}
+
+// records error at the current path like Reader::warn, the message is built only by
+// errorMessages()
+void CborReader::warn(ReaderError &&error)
+{
+    if (failSilently())
+        return;
+    error.path.reserve(m_p->valuesStack.size());
+    for (const CborReaderPrivate::ValueStack &v : std::as_const(m_p->valuesStack))
+        error.path.append(PathSegment { v.fieldName, v.fieldPath, v.indexPath });
+    m_p->errors.append(std::move(error));
+    m_p->parseStatus = ParseStatus::Failed;
+}
+
+QJsonValue CborReader::currentValue() const
+{
+    const qint32 token = currentToken();
+    if (token < 0 || isCurrent(CborTape::TokenType::Undefined))
+        return QJsonValue(QJsonValue::Undefined);
+    return m_tape.toJsonValue(token);
+}
+
+void CborReader::handleJson(QJsonValue &v)
+{
+    v = currentValue();
+}
+
+void CborReader::handleJson(QJsonObject &v)
+{
+    if (isCurrent(CborTape::TokenType::Map)) {
+        v = m_tape.toJsonValue(currentToken()).toObject();
+        return;
+    }
+    if (!isNullOrMissing() && !failSilently()) {
+        ReaderError error;
+        error.kind = ReaderError::Kind::NotObject;
+        error.value = currentValue();
+        warn(std::move(error));
+    }
+    v = QJsonObject();
+}
+
+void CborReader::handleJson(QJsonArray &v)
+{
+    if (isCurrent(CborTape::TokenType::Array)) {
+        v = m_tape.toJsonValue(currentToken()).toArray();
+        return;
+    }
+    if (!isNullOrMissing() && !failSilently()) {
+        ReaderError error;
+        error.kind = ReaderError::Kind::NotArray;
+        error.value = currentValue();
+        warn(std::move(error));
+    }
+    v = QJsonArray();
+}
+
+void CborReader::startArrayF(qint32 &size)
+{
+    size = currentCount(CborTape::TokenType::Array);
+}
+
+bool CborReader::startElement(qint32 index)
+{
+    CborReaderPrivate::ValueStack &array = m_p->valuesStack.last();
+    qint32 element = -1;
+    if (index >= 0 && index < currentCount(CborTape::TokenType::Array)) {
+        qint32 i = 0;
+        element = array.token + 1;
+        if (array.lastIndex >= 0 && array.lastIndex <= index) {
+            i = array.lastIndex;
+            element = array.lastElement;
+        }
+        for (; i < index; ++i)
+            element = m_tape.at(element).next;
+        array.lastIndex = index;
+        array.lastElement = element;
+    }
+    m_p->valuesStack.append(
+            CborReaderPrivate::ValueStack { element, QLatin1StringView(), QString(), index });
+    return true;
+}
+
+void CborReader::endElement(qint32 index)
+{
+    Q_ASSERT(m_p->valuesStack.last().indexPath == index);
+    Q_UNUSED(index);
+    m_p->valuesStack.removeLast();
+}
+
+void CborReader::endArrayF(qint32 &) { }
+
+QStringList CborReader::currentKeys() const
+{
+    QStringList keys;
+    const CborReaderPrivate::ObjectStack &o = m_p->objectsStack.last();
+    if (o.token < 0)
+        return keys;
+    const qint32 count = m_tape.at(o.token).count;
+    keys.reserve(count);
+    qint32 key = o.token + 1;
+    for (qint32 i = 0; i < count; ++i) {
+        keys.append(QString::fromUtf8(m_tape.stringView(key)));
+        key = m_tape.at(key + 1).next;
+    }
+    return keys;
+}
+
+bool CborReader::startTuple(qint32 size)
+{
+    const qint32 expected = currentCount(CborTape::TokenType::Array);
+    if (size != expected) {
+        warnInvalidSize(size, expected);
+        return false;
+    }
+    return true;
+}
+
+void CborReader::endTuple(qint32) { }
+
+} // namespace QTypedJson
+
+QT_END_NAMESPACE
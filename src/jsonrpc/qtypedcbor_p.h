@@ -0,0 +1,464 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QTYPEDCBOR_P_H
+#define QTYPEDCBOR_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtJsonRpc/private/qtypedjson_p.h>
+#include <QtCore/qbytearray.h>
+#include <QtCore/qbytearrayview.h>
+#include <QtCore/qcborstreamreader.h>
+#include <QtCore/qcborstreamwriter.h>
+#include <QtCore/qlist.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace QTypedJson {
+
+class Q_JSONRPC_EXPORT CborWriter
+{
+    Q_DISABLE_COPY_MOVE(CborWriter)
+public:
+    CborWriter() : m_writer(&m_data) { }
+
+    // public api
+    QByteArray takeData();
+
+    // serialization templates
+    template<typename T>
+    bool handleOptional(T &el)
+    {
+        if (el)
+            return true;
+        this->handleMissingOptional();
+        return false;
+    }
+
+    template<typename T>
+    bool handlePointer(T &el)
+    {
+        if (el)
+            return true;
+        this->handleMissingOptional();
+        return false;
+    }
+
+    template<typename T>
+    bool startObject(const char *type, ObjectOptions options, quintptr id, T &)
+    {
+        return this->startObjectF(type, options, id);
+    }
+
+    template<typename T>
+    void endObject(const char *type, ObjectOptions options, quintptr id, T &)
+    {
+        this->endObjectF(type, options, id);
+    }
+
+    template<typename T>
+    bool startArray(qint32 &size, T &el)
+    {
+        using BaseT = std::decay_t<T>;
+        if constexpr (IsResizableList<BaseT>::value) {
+            size = qint32(el.size());
+        } else {
+            assert(false); // currently unsupported
+        }
+        return startArrayF(size);
+    }
+
+    template<typename T>
+    void endArray(qint32 &size, T &)
+    {
+        this->endArrayF(size);
+    }
+
+    template<typename T>
+    bool startMap(QStringList &keys, T &el)
+    {
+        keys = mapKeys(el);
+        return this->startObjectF("map", ObjectOption::None, quintptr(&el));
+    }
+
+    template<typename T>
+    void endMap(QStringList &, T &el)
+    {
+        this->endObjectF("map", ObjectOption::None, quintptr(&el));
+    }
+
+    template<typename T>
+    void handleVariant(T &el)
+    {
+        std::visit([this](auto &v) { doWalk(*this, v); }, el);
+    }
+
+    template<typename T>
+    void handleLazy(T &el)
+    {
+        if (el.hasRawJson()) {
+            QJsonValue v = el.rawJsonValue();
+            this->handleJson(v);
+        } else {
+            doWalk(*this, el.value());
+        }
+    }
+
+    template<typename T>
+    void handleEnum(T &el)
+    {
+        writeEnum(*this, el);
+    }
+
+    // serialization callbacks
+    void handleBasic(const bool &v);
+    void handleBasic(const QByteArray &v);
+    void handleBasic(const int &v);
+    void handleBasic(const double &v);
+    void handleNullType();
+    void handleJson(QJsonValue &v);
+    void handleJson(QJsonObject &v);
+    void handleJson(QJsonArray &v);
+    bool startField(const QString &fieldName);
+    bool startField(const char *fieldName);
+    bool startField(const FieldName &fieldName);
+    void endField(const QString &);
+    void endField(const char *);
+    void endField(const FieldName &);
+    bool startElement(qint32 index);
+    void endElement(qint32);
+    bool startTuple(qint32 size);
+    void endTuple(qint32 size);
+
+private:
+    void handleMissingOptional();
+    bool startObjectF(const char *, ObjectOptions, quintptr);
+    void endObjectF(const char *, ObjectOptions, quintptr);
+    bool startArrayF(qint32 &);
+    void endArrayF(qint32 &);
+    void startValue();
+
+    QByteArray m_data;
+    QCborStreamWriter m_writer;
+    QByteArray m_pendingKey; // name of the field whose value was not written yet
+    bool m_hasPendingKey = false;
+};
+
+class Q_JSONRPC_EXPORT CborTape
+{
+public:
+    enum class TokenType : quint8 {
+        Null,
+        Undefined,
+        True,
+        False,
+        Integer,
+        Double,
+        String,
+        Map,
+        Array
+    };
+
+    struct Token
+    {
+        TokenType type = TokenType::Null;
+        qint32 next = 0; // index of the first token after this value and its children
+        qint32 count = 0; // number of members of a map, or elements of an array
+        quint32 hash = 0; // fieldNameHash of strings
+        qsizetype begin = 0; // offset of a string in the string pool
+        qsizetype end = 0; // offset one past the end of a string
+        qint64 integer = 0;
+        double number = 0;
+    };
+
+    CborTape() = default;
+    explicit CborTape(const QByteArray &data);
+
+    bool isValid() const { return m_error.isEmpty(); }
+    QString errorString() const { return m_error; }
+    qint64 errorOffset() const { return m_errorOffset; }
+    qint32 size() const { return qint32(m_tokens.size()); }
+    const Token &at(qint32 index) const { return m_tokens.at(index); }
+
+    QByteArrayView stringView(qint32 index) const;
+    QByteArray string(qint32 index) const { return stringView(index).toByteArray(); }
+    bool keyEquals(qint32 keyIndex, QByteArrayView key) const;
+    bool keyEquals(qint32 keyIndex, const FieldName &key) const;
+    qint32 findMember(qint32 mapIndex, const FieldName &key) const;
+    QJsonValue toJsonValue(qint32 index) const;
+
+private:
+    bool parseValue(QCborStreamReader &reader, int depth);
+    bool parseContainer(QCborStreamReader &reader, int depth, TokenType type);
+    bool parseString(QCborStreamReader &reader);
+    void addString(QByteArrayView string);
+    qint32 addToken(TokenType type);
+    bool fail(QCborStreamReader &reader);
+    bool fail(const QString &msg, qint64 offset);
+
+    QByteArray m_strings; // the UTF-8 content of all strings, one after the other
+    QList<Token> m_tokens;
+    QString m_error;
+    qint64 m_errorOffset = 0;
+};
+
+class CborReaderPrivate
+{
+public:
+    class ValueStack
+    {
+    public:
+        qint32 token = -1; // -1 for a missing value
+        QLatin1StringView fieldName = {}; // static field names, fieldPath is used otherwise
+        QString fieldPath = {};
+        qint32 indexPath = -1;
+        // last element visited, elements are normally accessed sequentially
+        qint32 lastIndex = -1;
+        qint32 lastElement = -1;
+    };
+
+    class ObjectStack
+    {
+    public:
+        const char *type;
+        ObjectOptions options;
+        qint32 token = -1;
+        VisitedMembers visitedMembers = {};
+        // member after the last one found, fields tend to be sent in declaration order
+        qint32 nextMember = 0;
+        qint32 nextKey = -1;
+    };
+
+    QVarLengthArray<ValueStack, 16> valuesStack = {};
+    QVarLengthArray<ObjectStack, 8> objectsStack = {};
+    ParseStatus parseStatus = ParseStatus::Normal;
+    bool suppressErrors = false; // set while trying the alternatives of a variant
+    bool collectErrors = true;
+    QList<ReaderError> errors = {};
+};
+
+class Q_JSONRPC_EXPORT CborReader
+{
+    Q_DISABLE_COPY_MOVE(CborReader)
+public:
+    CborReader(const QByteArray &cbor);
+    ~CborReader();
+
+    QStringList errorMessages();
+    bool hasErrors() const;
+    void clearErrorMessages();
+    // decoding stopped on an error, also without error collection
+    bool failed() const;
+
+    // without error collection failures only stop the decoding, which is faster
+    bool collectErrors() const;
+    void setCollectErrors(bool collectErrors);
+
+    // serialization templates
+
+    template<typename T>
+    bool startObject(const char *type, ObjectOptions options, quintptr id, T &)
+    {
+        return this->startObjectF(type, options, id);
+    }
+    template<typename T>
+    void endObject(const char *type, ObjectOptions options, quintptr id, T &obj);
+
+    template<typename T>
+    bool startArray(qint32 &size, T &el)
+    {
+        startArrayF(size);
+        using BaseT = std::decay_t<T>;
+        if constexpr (IsResizableList<BaseT>::value) {
+            el.resize(size);
+        } else {
+            assert(false); // currently unsupported
+        }
+        return true;
+    }
+
+    template<typename T>
+    bool handleOptional(T &el)
+    {
+        if (isNullOrMissing())
+            el.reset();
+        else
+            el.emplace();
+        return bool(el);
+    }
+
+    template<typename T>
+    bool handlePointer(T &el)
+    {
+        if (isNullOrMissing())
+            el = nullptr;
+        else
+            allocatePointer(el);
+        return bool(el);
+    }
+
+    template<typename... T>
+    void handleVariant(std::variant<T...> &el)
+    {
+        readVariant(*this, *m_p, el, std::index_sequence_for<T...>());
+    }
+
+    template<typename T>
+    void handleLazy(T &el)
+    {
+        el.setRawJson(currentValue());
+    }
+
+    template<typename T>
+    void handleEnum(T &e)
+    {
+        if (isCurrent(CborTape::TokenType::Integer))
+            e = T(int(m_tape.at(currentToken()).integer));
+        else if (isCurrent(CborTape::TokenType::Double))
+            e = T(int(m_tape.at(currentToken()).number));
+        else
+            e = enumFromUtf8<T>(currentString());
+    }
+
+    template<typename T>
+    void endArray(qint32 &size, T &)
+    {
+        this->endArrayF(size);
+    }
+
+    template<typename T>
+    bool startMap(QStringList &keys, T &el)
+    {
+        el.clear();
+        if (isNullOrMissing())
+            return false;
+        if (!this->startObjectF("map", ObjectOption::None, quintptr(&el)))
+            return false;
+        keys = this->currentKeys();
+        return true;
+    }
+
+    template<typename T>
+    void endMap(QStringList &, T &el)
+    {
+        this->endObjectF("map", ObjectOption::None, quintptr(&el));
+    }
+
+    //  serialization callbacks
+    void handleBasic(bool &);
+    void handleBasic(QByteArray &);
+    void handleBasic(int &);
+    void handleBasic(double &);
+    void handleNullType();
+    void handleJson(QJsonValue &v);
+    void handleJson(QJsonObject &v);
+    void handleJson(QJsonArray &v);
+    bool startField(const QString &fieldName);
+    bool startField(const char *fieldName);
+    bool startField(const FieldName &fieldName);
+    void endField(const QString &fieldName);
+    void endField(const char *fieldName);
+    void endField(const FieldName &fieldName);
+    bool startElement(qint32 index);
+    void endElement(qint32 index);
+    bool startTuple(qint32 size);
+    void endTuple(qint32 size);
+
+    // cheap checks on the current value, used to select the alternatives of a variant
+    QJsonValue::Type currentType() const;
+    bool hasCurrentField(const FieldName &fieldName) const;
+    bool currentFieldEquals(const FieldName &fieldName, QLatin1StringView value) const;
+
+private:
+    bool failSilently();
+    void warnExtra(const QJsonObject &e);
+    void warnMissing(QStringView s);
+    void warnNonNull();
+    void warnInvalidSize(qint32 size, qint32 expectedSize);
+    void warn(ReaderError &&error);
+    QJsonObject getExtraFields() const;
+    bool startObjectF(const char *type, ObjectOptions options, quintptr id);
+    void endObjectF(const char *type, ObjectOptions options, quintptr id);
+    void startArrayF(qint32 &size);
+    void endArrayF(qint32 &size);
+    template<typename Key>
+    qint32 findField(const Key &fieldName);
+    QStringList currentKeys() const;
+    QByteArrayView currentString() const;
+    QJsonValue currentValue() const;
+    qint32 currentToken() const { return m_p->valuesStack.last().token; }
+    bool isCurrent(CborTape::TokenType type) const
+    {
+        const qint32 token = currentToken();
+        return token >= 0 && m_tape.at(token).type == type;
+    }
+    qint32 currentCount(CborTape::TokenType type) const
+    {
+        return isCurrent(type) ? m_tape.at(currentToken()).count : 0;
+    }
+    bool isNullOrMissing() const
+    {
+        return currentToken() < 0 || isCurrent(CborTape::TokenType::Null)
+                || isCurrent(CborTape::TokenType::Undefined);
+    }
+
+    CborTape m_tape;
+    CborReaderPrivate *m_p;
+};
+
+template<typename T>
+inline void CborReader::endObject(const char *type, ObjectOptions options, quintptr id, T &obj)
+{
+    using BaseT = std::decay_t<T>;
+    QJsonObject extra;
+    if (SetExtraFields<BaseT>::value
+        || (options & (ObjectOption::KeepExtraFields | ObjectOption::WarnExtra)))
+        extra = this->getExtraFields();
+    this->endObjectF(type, options, id);
+    if constexpr (SetExtraFields<BaseT>::value)
+        obj.setExtraFields(extra);
+    else if (extra.constBegin() != extra.constEnd())
+        warnExtra(extra);
+}
+
+/*!
+ * \internal
+ * Serializes params to CBOR, representing the same value as toJsonValue(params...).
+ * Returns a null QByteArray when nothing is written (toJsonValue would return undefined).
+ */
+template<typename... Params>
+QByteArray toCbor(const Params &...params)
+{
+    if constexpr (sizeof...(Params) == 0)
+        return QByteArray();
+
+    CborWriter w;
+    if constexpr (sizeof...(Params) == 1) {
+        (doWalk(w, const_cast<Params &>(params)), ...);
+    } else if (w.startTuple(sizeof...(Params))) {
+        qint32 i = 0;
+        auto writeElement = [&i, &w](auto &el) {
+            w.startElement(i);
+            doWalk(w, el);
+            w.endElement(i++);
+        };
+        (writeElement(const_cast<Params &>(params)), ...);
+        w.endTuple(sizeof...(Params));
+    }
+    return w.takeData();
+}
+
+} // namespace QTypedJson
+QT_END_NAMESPACE
+
+#endif // QTYPEDCBOR_P_H
@@ -14,58 +14,92 @@ namespace QTypedJson {
 
 Q_LOGGING_CATEGORY(jsonRpcLog, "qt.jsonrpc");
 
-Reader::Reader(const QJsonValue &v)
-    : m_p(new ReaderPrivate { QList({ ValueStack { v, QString(), -1, 0 } }) })
+Reader::Reader(const QJsonValue &v) : m_p(new ReaderPrivate)
 {
+    m_p->valuesStack.append(ValueStack { v });
 }
 
 Reader::~Reader()
 {
-    for (const QString &msg : m_p->errorMessages)
-        qCWarning(jsonRpcLog) << msg;
+    for (const ReaderError &error : std::as_const(m_p->errors))
+        qCWarning(jsonRpcLog) << error.toString();
     delete m_p;
 }
 
 QStringList Reader::errorMessages()
 {
-    return m_p->errorMessages;
+    QStringList res;
+    res.reserve(m_p->errors.size());
+    for (const ReaderError &error : std::as_const(m_p->errors))
+        res.append(error.toString());
+    return res;
+}
+
+bool Reader::hasErrors() const
+{
+    return !m_p->errors.isEmpty();
 }
 
 void Reader::clearErrorMessages()
 {
-    m_p->errorMessages.clear();
+    m_p->errors.clear();
+}
+
+bool Reader::failed() const
+{
+    return m_p->parseStatus == ParseStatus::Failed;
+}
+
+bool Reader::collectErrors() const
+{
+    return m_p->collectErrors;
+}
+
+void Reader::setCollectErrors(bool collectErrors)
+{
+    m_p->collectErrors = collectErrors;
+}
+
+bool Reader::validateOnly() const
+{
+    return m_p->validateOnly;
+}
+
+void Reader::setValidateOnly(bool validateOnly)
+{
+    m_p->validateOnly = validateOnly;
 }
 
 void Reader::handleBasic(bool &el)
 {
-    if (currentValue().isBool())
-        el = currentValue().toBool();
-    else
+    if (!currentValue().isBool())
         warnMissing(u"bool");
+    else if (!m_p->validateOnly)
+        el = currentValue().toBool();
 }
 
 void Reader::handleBasic(QByteArray &el)
 {
-    if (currentValue().isString())
-        el = currentValue().toString().toUtf8();
-    else
+    if (!currentValue().isString())
         warnMissing(u"string");
+    else if (!m_p->validateOnly)
+        el = currentValue().toString().toUtf8();
 }
 
 void Reader::handleBasic(int &el)
 {
-    if (currentValue().isDouble())
-        el = currentValue().toInt(el);
-    else
+    if (!currentValue().isDouble())
         warnMissing(u"int");
+    else if (!m_p->validateOnly)
+        el = currentValue().toInt(el);
 }
 
 void Reader::handleBasic(double &el)
 {
-    if (currentValue().isDouble())
-        el = currentValue().toDouble();
-    else
+    if (!currentValue().isDouble())
         warnMissing(u"double");
+    else if (!m_p->validateOnly)
+        el = currentValue().toDouble();
 }
 
 void Reader::handleNullType()
@@ -75,31 +109,59 @@ void Reader::handleNullType()
     }
 }
 
-bool Reader::startField(const QString &fieldName)
+template<typename Key>
+void Reader::pushField(Key fieldName, QLatin1StringView staticName, const QString &fieldPath)
 {
     int oldWarnLevel = (m_p->valuesStack.isEmpty() ? 0 : m_p->valuesStack.last().warnLevel);
-    m_p->objectsStack.last().visitedFields.insert(fieldName);
-    m_p->valuesStack.append(ValueStack { currentValue()[fieldName], fieldName, -1,
+    ObjectStack &o = m_p->objectsStack.last();
+    QJsonValue value(QJsonValue::Undefined);
+    const auto it = o.object.constFind(fieldName);
+    if (it != o.object.constEnd()) {
+        o.visitedFields.setBit(it - o.object.constBegin());
+        value = it.value();
+    }
+    m_p->valuesStack.append(ValueStack { value, staticName, fieldPath, -1,
                                          (oldWarnLevel ? oldWarnLevel + 1 : 0) });
+}
+
+bool Reader::startField(const QString &fieldName)
+{
+    pushField(fieldName, QLatin1StringView(), fieldName);
     return true;
 }
 
 bool Reader::startField(const char *fieldName)
 {
-    QString f = QString::fromUtf8(fieldName); // conversion needed just to set the fieldPath
-    return startField(f);
+    const QLatin1StringView name(fieldName);
+    pushField(name, name, QString());
+    return true;
+}
+
+bool Reader::startField(const FieldName &fieldName)
+{
+    pushField(fieldName.name, fieldName.name, QString());
+    return true;
 }
 
 void Reader::endField(const QString &fieldName)
 {
     Q_ASSERT(m_p->valuesStack.last().fieldPath == fieldName);
+    Q_UNUSED(fieldName);
     m_p->valuesStack.removeLast();
 }
 
 void Reader::endField(const char *fieldName)
 {
-    QString f = QString::fromUtf8(fieldName);
-    endField(f);
+    Q_ASSERT(m_p->valuesStack.last().fieldName == QLatin1StringView(fieldName));
+    Q_UNUSED(fieldName);
+    m_p->valuesStack.removeLast();
+}
+
+void Reader::endField(const FieldName &fieldName)
+{
+    Q_ASSERT(m_p->valuesStack.last().fieldName == fieldName.name);
+    Q_UNUSED(fieldName);
+    m_p->valuesStack.removeLast();
 }
 
 bool Reader::startObjectF(const char *type, ObjectOptions options, quintptr)
@@ -107,10 +169,14 @@ bool Reader::startObjectF(const char *type, ObjectOptions options, quintptr)
     if (m_p->parseStatus != ParseStatus::Normal)
         return false;
     if (currentValue().isUndefined()) {
+        if (m_p->validateOnly && m_p->valuesStack.size() > 1)
+            warnMissing(u"object");
         m_p->parseStatus = ParseStatus::Failed;
         return false;
     }
-    m_p->objectsStack.append(ObjectStack { type, options, {} });
+    QJsonObject object = currentValue().toObject();
+    VisitedMembers visited(object.size());
+    m_p->objectsStack.append(ObjectStack { type, options, std::move(object), std::move(visited) });
     return true;
 }
 
@@ -120,75 +186,159 @@ void Reader::endObjectF(const char *type, ObjectOptions, quintptr)
     m_p->objectsStack.removeLast();
 }
 
+bool Reader::hasCurrentField(const FieldName &fieldName) const
+{
+    return !currentValue()[fieldName.name].isUndefined();
+}
+
+bool Reader::currentFieldEquals(const FieldName &fieldName, QLatin1StringView value) const
+{
+    const QJsonValue v = currentValue()[fieldName.name];
+    return v.isString() && v.toString() == value;
+}
+
+bool Reader::failSilently()
+{
+    if (!m_p->suppressErrors && m_p->collectErrors)
+        return false;
+    m_p->parseStatus = ParseStatus::Failed;
+    return true;
+}
+
 void Reader::warnExtra(const QJsonObject &e)
 {
-    if (e.constBegin() != e.constEnd())
-        warn(QStringLiteral(u"%1 has extra fields %2")
-                     .arg(currentPath(), QString::fromUtf8(QJsonDocument(e).toJson())));
+    if (e.constBegin() == e.constEnd())
+        return;
+    ReaderError error;
+    error.kind = ReaderError::Kind::Extra;
+    error.value = e;
+    warn(std::move(error));
 }
 
 void Reader::warnInvalidSize(qint32 size, qint32 expectedSize)
 {
-    if (size != expectedSize)
-        warn(QStringLiteral(u"%1 expected %1 elements, not %2.")
-                     .arg(currentPath(), QString::number(expectedSize), QString::number(size)));
+    if (size == expectedSize)
+        return;
+    ReaderError error;
+    error.kind = ReaderError::Kind::InvalidSize;
+    error.size = size;
+    error.expectedSize = expectedSize;
+    warn(std::move(error));
 }
 
 void Reader::warnMissing(QStringView s)
 {
-    warn(QStringLiteral(u"%1 misses value of type %2").arg(currentPath(), s));
+    ReaderError error;
+    error.kind = ReaderError::Kind::Missing;
+    error.expectedType = s;
+    warn(std::move(error));
 }
 
 void Reader::warnNonNull()
 {
-    QByteArray val = QJsonDocument(QJsonArray({ currentValue() })).toJson();
-    warn(QStringLiteral(u"%1 is supposed to be null, but is %2")
-                 .arg(currentPath(), QString::fromUtf8(val.mid(1, val.size() - 2))));
+    ReaderError error;
+    error.kind = ReaderError::Kind::NonNull;
+    error.value = currentValue();
+    warn(std::move(error));
 }
 
-void Reader::warn(const QString &msg)
+// records error at the current path, the message is built only by errorMessages()
+void Reader::warn(ReaderError &&error)
 {
-    m_p->errorMessages.append(msg);
+    if (failSilently())
+        return;
+    error.path.reserve(m_p->valuesStack.size());
+    for (const ValueStack &v : std::as_const(m_p->valuesStack))
+        error.path.append(PathSegment { v.fieldName, v.fieldPath, v.indexPath });
+    m_p->errors.append(std::move(error));
     m_p->parseStatus = ParseStatus::Failed;
 }
 
+static QString jsonToString(const QJsonValue &v)
+{
+    QByteArray val = QJsonDocument(QJsonArray({ v })).toJson();
+    return QString::fromUtf8(val.mid(1, val.size() - 2));
+}
+
+QString ReaderError::toString() const
+{
+    QStringList segments;
+    for (const PathSegment &segment : path) {
+        if (segment.indexPath != -1)
+            segments.append(QString::number(segment.indexPath));
+        else if (!segment.fieldName.isNull())
+            segments.append(segment.fieldName.toString());
+        else
+            segments.append(segment.fieldPath);
+    }
+    const QString p = segments.join(u".");
+    switch (kind) {
+    case Kind::Missing:
+        return QStringLiteral(u"%1 misses value of type %2").arg(p, expectedType);
+    case Kind::NonNull:
+        return QStringLiteral(u"%1 is supposed to be null, but is %2").arg(p, jsonToString(value));
+    case Kind::Extra:
+        return QStringLiteral(u"%1 has extra fields %2")
+                .arg(p, QString::fromUtf8(QJsonDocument(value.toObject()).toJson()));
+    case Kind::InvalidSize:
+        return QStringLiteral(u"%1 expected %2 elements, not %3.")
+                .arg(p, QString::number(expectedSize), QString::number(size));
+    case Kind::NotObject:
+        return QStringLiteral(u"Error: expected an object at %1, not %2")
+                .arg(p, jsonToString(value));
+    case Kind::NotArray:
+        return QStringLiteral(u"Error: expected an array at %1, not %2")
+                .arg(p, jsonToString(value));
+    case Kind::VariantFailed:
+        return QStringLiteral(u"All options of variant failed:");
+    case Kind::AlternativeFailed:
+        return QStringLiteral(u"Type %1 failed with errors:").arg(QLatin1String(typeName));
+    case Kind::InvalidJson:
+        return QStringLiteral(u"Invalid json: %1").arg(value.toString());
+    case Kind::InvalidCbor:
+        return QStringLiteral(u"Invalid cbor at offset %1: %2").arg(size).arg(value.toString());
+    }
+    return QString();
+}
+
 void Reader::handleJson(QJsonValue &v)
 {
-    v = currentValue();
+    if (!m_p->validateOnly)
+        v = currentValue();
 }
 
 void Reader::handleJson(QJsonObject &v)
 {
     if (!currentValue().isObject() && !currentValue().isNull() && !currentValue().isUndefined()) {
-        QByteArray val = QJsonDocument(QJsonArray({ currentValue() })).toJson();
-        warn(QStringLiteral(u"Error: expected an object at %1, not %2")
-                     .arg(currentPath(), QString::fromUtf8(val.mid(1, val.size() - 2))));
+        ReaderError error;
+        error.kind = ReaderError::Kind::NotObject;
+        error.value = currentValue();
+        warn(std::move(error));
     }
-    v = currentValue().toObject();
+    if (!m_p->validateOnly)
+        v = currentValue().toObject();
 }
 
 void Reader::handleJson(QJsonArray &v)
 {
     if (!currentValue().isArray() && !currentValue().isNull() && !currentValue().isUndefined()) {
-        QByteArray val = QJsonDocument(QJsonArray({ currentValue() })).toJson();
-        warn(QStringLiteral(u"Error: expected an array at %1, not %2")
-                     .arg(currentPath(), QString::fromUtf8(val.mid(1, val.size() - 2))));
+        ReaderError error;
+        error.kind = ReaderError::Kind::NotArray;
+        error.value = currentValue();
+        warn(std::move(error));
     }
-    v = currentValue().toArray();
+    if (!m_p->validateOnly)
+        v = currentValue().toArray();
 }
 
 QJsonObject Reader::getExtraFields() const
 {
     QJsonObject extraFields;
-    QJsonObject v = currentValue().toObject();
-    auto it = v.constBegin();
-    auto end = v.constEnd();
-    auto &vField = m_p->objectsStack.last().visitedFields;
-    while (it != end) {
-        if (!vField.contains(it.key())) {
+    const ObjectStack &o = m_p->objectsStack.last();
+    qsizetype i = 0;
+    for (auto it = o.object.constBegin(), end = o.object.constEnd(); it != end; ++it, ++i) {
+        if (!o.visitedFields.testBit(i))
             extraFields.insert(it.key(), it.value());
-        }
-        ++it;
     }
     return extraFields;
 }
@@ -201,7 +351,8 @@ void Reader::startArrayF(qint32 &size)
 bool Reader::startElement(qint32 index)
 {
     int oldWarnLevel = (m_p->valuesStack.isEmpty() ? 0 : m_p->valuesStack.last().warnLevel);
-    m_p->valuesStack.append(ValueStack { currentValue().toArray().at(index), QString(), index,
+    m_p->valuesStack.append(ValueStack { currentValue().toArray().at(index), QLatin1StringView(),
+                                         QString(), index,
                                          (oldWarnLevel ? oldWarnLevel + 1 : 0) });
     return true;
 }
@@ -214,16 +365,9 @@ void Reader::endElement(qint32 index)
 
 void Reader::endArrayF(qint32 &) { }
 
-QString Reader::currentPath() const
+QStringList Reader::currentKeys() const
 {
-    QStringList res;
-    for (const auto &el : std::as_const(m_p->valuesStack)) {
-        if (el.indexPath != -1)
-            res.append(QString::number(el.indexPath));
-        else
-            res.append(el.fieldPath);
-    }
-    return res.join(u".");
+    return m_p->objectsStack.last().object.keys();
 }
 
 bool Reader::startTuple(qint32 size)
@@ -281,13 +425,20 @@ bool JsonBuilder::startField(const char *)
     return true;
 }
 
-void JsonBuilder::endField(const QString &v)
+bool JsonBuilder::startField(const FieldName &)
+{
+    m_fieldLevel.append(m_values.size());
+    return true;
+}
+
+template<typename Key>
+void JsonBuilder::insertField(Key key)
 {
     Q_ASSERT(!m_fieldLevel.isEmpty());
     if (m_fieldLevel.last() < m_values.size()) {
         Q_ASSERT(m_values.size() > 1);
         if (QJsonObject *o = std::get_if<QJsonObject>(&m_values[m_values.size() - 2])) {
-            o->insert(v, popLastValue());
+            o->insert(key, popLastValue());
         } else {
             Q_ASSERT(false);
         }
@@ -296,9 +447,19 @@ void JsonBuilder::endField(const QString &v)
     m_fieldLevel.removeLast();
 }
 
+void JsonBuilder::endField(const QString &v)
+{
+    insertField(v);
+}
+
 void JsonBuilder::endField(const char *v)
 {
-    endField(QString::fromUtf8(v));
+    insertField(QString::fromUtf8(v));
+}
+
+void JsonBuilder::endField(const FieldName &v)
+{
+    insertField(v.name);
 }
 
 bool JsonBuilder::startObjectF(const char *, ObjectOptions, quintptr)
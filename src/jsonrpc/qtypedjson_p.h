@@ -20,18 +20,27 @@
 #include <QtCore/QJsonObject>
 #include <QtCore/QScopeGuard>
 #include <QtCore/QSet>
+#include <QtCore/QStringView>
+#include <QtCore/QBitArray>
 #include <QtCore/QByteArray>
+#include <QtCore/QByteArrayView>
 #include <QtCore/QMetaEnum>
+#include <QtCore/QVarLengthArray>
 #include <QtCore/QLoggingCategory>
 #include <QtCore/qjsonvalue.h>
 #include <QtCore/qjsonarray.h>
 #include <QtCore/qjsonobject.h>
 #include <QtJsonRpc/qtjsonrpcglobal.h>
 
+#include <algorithm>
+#include <array>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <typeinfo>
 #include <optional>
+#include <utility>
+#include <variant>
 
 QT_BEGIN_NAMESPACE
 
@@ -127,6 +136,91 @@ struct IsList<T, void_t<typename T::value_type>> : std::true_type
 {
 };
 
+// contiguous containers decoded after a resize: QList, std::vector, QVarLengthArray
+template<typename T, typename = void>
+struct IsResizableList : std::false_type
+{
+};
+
+template<typename T>
+struct IsResizableList<T,
+                       void_t<typename T::value_type, decltype(std::declval<T &>().resize(0)),
+                              decltype(std::declval<T &>().size())>> : std::true_type
+{
+};
+
+// fixed size arrays, walked as tuples
+template<typename T>
+struct IsStdArray : std::false_type
+{
+};
+
+template<typename T, std::size_t N>
+struct IsStdArray<std::array<T, N>> : std::true_type
+{
+};
+
+// maps with string keys (QMap, QHash, std::map...), walked as objects
+template<typename T, typename = void>
+struct IsMap : std::false_type
+{
+};
+
+template<typename T>
+struct IsMap<T, void_t<typename T::key_type, typename T::mapped_type>> : std::true_type
+{
+};
+
+template<typename Key>
+Key mapKeyFromString(const QString &key)
+{
+    if constexpr (std::is_same_v<Key, QByteArray>)
+        return key.toUtf8();
+    else if constexpr (std::is_same_v<Key, std::string>)
+        return key.toStdString();
+    else
+        return key;
+}
+
+template<typename Key>
+QString mapKeyToString(const Key &key)
+{
+    if constexpr (std::is_same_v<Key, QByteArray>)
+        return QString::fromUtf8(key);
+    else if constexpr (std::is_same_v<Key, std::string>)
+        return QString::fromStdString(key);
+    else
+        return key;
+}
+
+template<typename T, typename = void>
+struct HasIteratorKey : std::false_type
+{
+};
+
+template<typename T>
+struct HasIteratorKey<T, void_t<decltype(std::declval<const T &>().begin().key())>>
+    : std::true_type
+{
+};
+
+// keys of a map in sorted order, so that the output does not depend on the hashing
+template<typename T>
+QStringList mapKeys(const T &map)
+{
+    QStringList keys;
+    keys.reserve(qsizetype(map.size()));
+    if constexpr (HasIteratorKey<T>::value) {
+        for (auto it = map.begin(), end = map.end(); it != end; ++it)
+            keys.append(mapKeyToString(it.key()));
+    } else {
+        for (const auto &entry : map)
+            keys.append(mapKeyToString(entry.first));
+    }
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
 template<typename T>
 struct IsPointer : std::is_pointer<T>
 {
@@ -152,11 +246,166 @@ struct IsVariant<std::variant<Args...>> : std::true_type
 {
 };
 
+template<typename T>
+class Lazy;
+
+template<typename T>
+struct IsLazy : std::false_type
+{
+};
+
+template<typename T>
+struct IsLazy<Lazy<T>> : std::true_type
+{
+};
+
+constexpr quint32 fieldNameHash(const char *name, qsizetype size)
+{
+    quint32 h = 2166136261u; // FNV-1a
+    for (qsizetype i = 0; i < size; ++i) {
+        h ^= uchar(name[i]);
+        h *= 16777619u;
+    }
+    return h;
+}
+
+// Name of a field with its hash, meant to be built at compile time in walk methods
+class FieldName
+{
+public:
+    template<std::size_t N>
+    constexpr FieldName(const char (&fieldName)[N])
+        : name(fieldName, qsizetype(N - 1)), hash(fieldNameHash(fieldName, qsizetype(N - 1)))
+    {
+    }
+
+    constexpr explicit FieldName(QLatin1StringView fieldName)
+        : name(fieldName), hash(fieldNameHash(fieldName.data(), fieldName.size()))
+    {
+    }
+
+    QLatin1StringView name;
+    quint32 hash;
+};
+
+// Literal value of a field that identifies a type among the alternatives of a variant
+class Discriminator
+{
+public:
+    template<std::size_t N, std::size_t M>
+    constexpr Discriminator(const char (&fieldName)[N], const char (&fieldValue)[M])
+        : field(fieldName), value(fieldValue, qsizetype(M - 1))
+    {
+    }
+
+    FieldName field;
+    QLatin1StringView value;
+};
+
+template<typename T, typename = void>
+struct HasDiscriminator : std::false_type
+{
+};
+
+template<typename T>
+struct HasDiscriminator<T, void_t<decltype(T::jsonDiscriminator)>> : std::true_type
+{
+};
+
+template<typename T>
+struct EnumEntry
+{
+    QByteArrayView name;
+    T value;
+};
+
+/*!
+ * \internal
+ * Describes how an enum is represented in json, without going through QMetaEnum.
+ *
+ * Specializations define isNumber, which is true if the enum is written as a number.
+ * Enums written as strings must use the values 0, 1, 2,... and also define names, the name of
+ * each value, and sortedEntries, the same names sorted by their bytes. generate.ts emits a
+ * specialization for each enum of the specification.
+ */
+template<typename T>
+struct EnumTraits
+{
+};
+
+template<typename T, typename = void>
+struct IsNumberEnum : std::false_type
+{
+};
+
+template<typename T>
+struct IsNumberEnum<T, std::enable_if_t<EnumTraits<T>::isNumber>> : std::true_type
+{
+};
+
+template<typename T, typename = void>
+struct HasEnumNames : std::false_type
+{
+};
+
+template<typename T>
+struct HasEnumNames<T, void_t<decltype(EnumTraits<T>::sortedEntries)>> : std::true_type
+{
+};
+
+inline int compareEnumName(QByteArrayView entry, QByteArrayView name, Qt::CaseSensitivity cs)
+{
+    return QLatin1StringView(entry).compare(QLatin1StringView(name), cs);
+}
+
+inline int compareEnumName(QByteArrayView entry, QStringView name, Qt::CaseSensitivity cs)
+{
+    return -name.compare(QLatin1StringView(entry), cs);
+}
+
+// returns the name of value, or a null view if value has no name
+template<typename T>
+constexpr QByteArrayView enumName(T value)
+{
+    if constexpr (HasEnumNames<T>::value) {
+        const auto &names = EnumTraits<T>::names;
+        const int iValue = int(value);
+        if (iValue >= 0 && iValue < int(std::size(names)))
+            return names[iValue];
+    } else {
+        Q_UNUSED(value);
+    }
+    return QByteArrayView();
+}
+
+// binary search of name in the sorted names, falling back to a case insensitive scan
+template<typename T, typename S>
+inline std::optional<T> enumFromName(S name)
+{
+    const auto &entries = EnumTraits<T>::sortedEntries;
+    const auto end = std::end(entries);
+    const auto less = [](const EnumEntry<T> &entry, S n) {
+        return compareEnumName(entry.name, n, Qt::CaseSensitive) < 0;
+    };
+    const auto it = std::lower_bound(std::begin(entries), end, name, less);
+    if (it != end && compareEnumName(it->name, name, Qt::CaseSensitive) == 0)
+        return it->value;
+    for (const EnumEntry<T> &entry : entries) {
+        if (compareEnumName(entry.name, name, Qt::CaseInsensitive) == 0)
+            return entry.value;
+    }
+    return std::nullopt;
+}
+
 template<typename T>
 inline QString enumToString(T value)
 {
     int iValue = int(value);
-    if constexpr (HasMetaEnum<T>::value) {
+    if constexpr (HasEnumNames<T>::value) {
+        const QByteArrayView name = enumName(value);
+        if (!name.isNull())
+            return QString::fromLatin1(name);
+    } else if constexpr (HasMetaEnum<T>::value && !IsNumberEnum<T>::value) {
         QMetaEnum metaEnum = QMetaEnum::fromType<T>();
         for (int i = 0; i < metaEnum.keyCount(); ++i) {
             if (iValue == metaEnum.value(i))
@@ -166,21 +415,70 @@ inline QString enumToString(T value)
     return QString::number(iValue);
 }
 
+// the enum value with the name (or number) value, if there is one
 template<typename T>
-inline T enumFromString(const QString &value)
+inline std::optional<T> lookupEnum(const QString &value)
 {
+    if constexpr (HasEnumNames<T>::value) {
+        if (const std::optional<T> e = enumFromName<T>(QStringView(value)))
+            return e;
+    }
     bool ok;
     int v = value.toInt(&ok);
     if (ok)
         return T(v);
-    if constexpr (HasMetaEnum<T>::value) {
+    if constexpr (HasMetaEnum<T>::value && !HasEnumNames<T>::value) {
         QMetaEnum metaEnum = QMetaEnum::fromType<T>();
         for (int i = 0; i < metaEnum.keyCount(); ++i) {
             if (value.compare(QLatin1String(metaEnum.key(i)), Qt::CaseInsensitive) == 0)
                 return T { metaEnum.value(i) };
         }
     }
-    return T {};
+    return std::nullopt;
+}
+
+// like lookupEnum, with the default value for unknown names
+template<typename T>
+inline T enumFromString(const QString &value)
+{
+    return lookupEnum<T>(value).value_or(T {});
+}
+
+// like enumFromString, but looks up utf8 text without converting it to a QString
+template<typename T>
+inline T enumFromUtf8(QByteArrayView value)
+{
+    if constexpr (HasEnumNames<T>::value) {
+        if (const std::optional<T> e = enumFromName<T>(value))
+            return *e;
+    }
+    return enumFromString<T>(QString::fromUtf8(value));
+}
+
+/*!
+ * \internal
+ * Passes the json representation of value, an int or a string, to w.handleBasic().
+ */
+template<typename W, typename T>
+inline void writeEnum(W &w, T value)
+{
+    if constexpr (IsNumberEnum<T>::value) {
+        w.handleBasic(int(value));
+        return;
+    } else if constexpr (HasEnumNames<T>::value) {
+        const QByteArrayView name = enumName(value);
+        if (!name.isNull()) {
+            w.handleBasic(QByteArray::fromRawData(name.data(), name.size()));
+            return;
+        }
+    }
+    QString eVal = enumToString(value);
+    bool ok;
+    int iValue = eVal.toInt(&ok);
+    if (ok)
+        w.handleBasic(iValue);
+    else
+        w.handleBasic(eVal.toUtf8());
 }
 
 template<typename T>
@@ -199,34 +497,133 @@ inline T enumFromIntString(const QString &value)
     return T {};
 }
 
+// Bitset of the visited members of an object, kept inline unless the object is large
+class VisitedMembers
+{
+public:
+    VisitedMembers() = default;
+    explicit VisitedMembers(qsizetype size)
+    {
+        if (size > InlineSize)
+            m_bitArray.resize(size);
+    }
+
+    void setBit(qsizetype i)
+    {
+        if (m_bitArray.isEmpty())
+            m_bits |= quint64(1) << i;
+        else
+            m_bitArray.setBit(i);
+    }
+
+    bool testBit(qsizetype i) const
+    {
+        if (m_bitArray.isEmpty())
+            return (m_bits >> i) & 1;
+        return m_bitArray.testBit(i);
+    }
+
+private:
+    static constexpr qsizetype InlineSize = 64;
+    quint64 m_bits = 0;
+    QBitArray m_bitArray; // only used for objects with more than InlineSize members
+};
+
+// Allocates a decoded pointer, make_shared allocates the object and its control block at once
+template<typename T>
+void allocatePointer(T &el)
+{
+    using ElementT = std::decay_t<decltype(*el)>;
+    if constexpr (std::is_same_v<T, std::shared_ptr<ElementT>>)
+        el = std::make_shared<ElementT>();
+    else
+        el = T(new ElementT);
+}
+
 class Q_JSONRPC_EXPORT ValueStack
 {
 public:
     QJsonValue value;
-    QString fieldPath;
+    QLatin1StringView fieldName = {}; // static field names, fieldPath is used otherwise
+    QString fieldPath = {};
     int indexPath = -1;
     int warnLevel = 0;
 };
 
+// an element of the path of a Reader error
+class PathSegment
+{
+public:
+    QLatin1StringView fieldName = {};
+    QString fieldPath = {};
+    int indexPath = -1;
+};
+
+/*!
+ * \internal
+ * An error found by Reader, TextReader or CborReader, recorded without formatting anything:
+ * the text is built only when errorMessages() is called.
+ */
+class Q_JSONRPC_EXPORT ReaderError
+{
+public:
+    enum class Kind {
+        Missing, // no value of type expectedType
+        NonNull, // value is not null
+        Extra, // value holds the extra fields
+        InvalidSize, // size elements instead of expectedSize
+        NotObject, // value is not an object
+        NotArray, // value is not an array
+        VariantFailed, // header of the errors of the alternatives of a variant
+        AlternativeFailed, // header of the errors of the alternative typeName
+        InvalidJson, // the text could not be parsed, value holds the parser error (TextReader)
+        InvalidCbor // the data could not be parsed at offset size, value holds the parser error
+    };
+
+    QString toString() const;
+
+    Kind kind = Kind::Missing;
+    QList<PathSegment> path = {};
+    QJsonValue value = {};
+    QStringView expectedType = {}; // always a literal
+    const char *typeName = nullptr;
+    qint32 size = 0;
+    qint32 expectedSize = 0;
+};
+
 class ObjectStack
 {
 public:
     const char *type;
     ObjectOptions options;
-    QSet<QString> visitedFields;
+    QJsonObject object;
+    VisitedMembers visitedFields; // indexes of the visited members of object
 };
 
 class ReaderPrivate
 {
 public:
-    QList<ValueStack> valuesStack = {};
-    QList<ObjectStack> objectsStack = {};
+    // inline capacity covers the usual nesting, so walking allocates no stack entries
+    QVarLengthArray<ValueStack, 16> valuesStack = {};
+    QVarLengthArray<ObjectStack, 8> objectsStack = {};
     ObjectOptions baseOptions = {};
     ParseMode parseMode = ParseMode::StopOnError;
     ParseStatus parseStatus = ParseStatus::Normal;
-    QStringList errorMessages = {};
+    bool suppressErrors = false; // set while trying the alternatives of a variant
+    bool collectErrors = true;
+    bool validateOnly = false;
+    QList<ReaderError> errors = {};
 };
 
+template<typename T, typename R>
+bool mayDecodeAs(const R &reader);
+
+template<typename R, typename P, typename... T, std::size_t... I>
+void readVariant(R &reader, P &p, std::variant<T...> &el, std::index_sequence<I...>);
+
+template<typename W, typename T>
+inline void doWalk(W &w, T &el);
+
 class Q_JSONRPC_EXPORT Reader
 {
 public:
@@ -234,7 +631,18 @@ public:
     ~Reader();
 
     QStringList errorMessages();
+    bool hasErrors() const;
     void clearErrorMessages();
+    // decoding stopped on an error, also without error collection
+    bool failed() const;
+
+    // without error collection failures only stop the decoding, which is faster
+    bool collectErrors() const;
+    void setCollectErrors(bool collectErrors);
+
+    // only checks the json against the walked type, see validate()
+    bool validateOnly() const;
+    void setValidateOnly(bool validateOnly);
 
     // serialization templates
 
@@ -251,7 +659,22 @@ public:
     {
         startArrayF(size);
         using BaseT = std::decay_t<T>;
-        if constexpr (std::is_base_of_v<QList<typename BaseT::value_type>, BaseT>) {
+        if constexpr (IsResizableList<BaseT>::value) {
+            if (validateOnly()) {
+                if (!currentValue().isArray() && !currentValue().isUndefined()
+                    && !currentValue().isNull())
+                    warnMissing(u"array");
+                // all the elements are checked against a single scratch element
+                el.resize(size ? 1 : 0);
+                for (qint32 i = 0; i < size; ++i) {
+                    if (!startElement(i))
+                        break;
+                    doWalk(*this, el[0]);
+                    endElement(i);
+                }
+                endArrayF(size);
+                return false;
+            }
             el.resize(size);
         } else {
             assert(false); // currently unsupported
@@ -277,45 +700,36 @@ public:
         if (isMissing)
             el = nullptr;
         else
-            el = T(new std::decay_t<decltype(*el)>);
+            allocatePointer(el);
         return bool(el);
     }
 
     template<typename... T>
     void handleVariant(std::variant<T...> &el)
     {
-        std::tuple<T...> options;
-        int status = 0;
-        ReaderPrivate origStatus = *m_p;
-        QStringList err;
-        auto tryRead = [this, &origStatus, &status, &el, &err](auto &x) {
-            if (status == 2)
-                return;
-            if (status == 1)
-                *this->m_p = origStatus;
-            else
-                status = 1;
-            doWalk(*this, x);
-            if (m_p->parseStatus == ParseStatus::Normal) {
-                status = 2;
-                el = x;
-                return;
-            }
-            err.append(QStringLiteral(u"Type %1 failed with errors:")
-                               .arg(QLatin1String(typeid(decltype(x)).name())));
-            err += m_p->errorMessages;
-        };
-        std::apply([&tryRead](auto &...x) { (..., tryRead(x)); }, options);
-        if (status == 1) {
-            m_p->errorMessages.clear();
-            m_p->errorMessages.append(QStringLiteral(u"All options of variant failed:"));
-            m_p->errorMessages += err;
-        }
+        readVariant(*this, *m_p, el, std::index_sequence_for<T...>());
+    }
+
+    template<typename T>
+    void handleLazy(T &el)
+    {
+        if (validateOnly())
+            doWalk(*this, el.value());
+        else
+            el.setRawJson(currentValue());
     }
 
     template<typename T>
     void handleEnum(T &e)
     {
+        if (validateOnly()) {
+            // unknown names would silently decode to the default value
+            if (currentValue().isString() ? !lookupEnum<T>(currentValue().toString())
+                                          : !currentValue().isDouble()) {
+                warnMissing(u"enum");
+            }
+            return;
+        }
         if (currentValue().isDouble()) {
             e = T(currentValue().toInt());
         } else {
@@ -329,6 +743,24 @@ public:
         this->endArrayF(size);
     }
 
+    template<typename T>
+    bool startMap(QStringList &keys, T &el)
+    {
+        el.clear();
+        if (currentValue().isUndefined() || currentValue().isNull())
+            return false;
+        if (!this->startObjectF("map", ObjectOption::None, quintptr(&el)))
+            return false;
+        keys = this->currentKeys();
+        return true;
+    }
+
+    template<typename T>
+    void endMap(QStringList &, T &el)
+    {
+        this->endObjectF("map", ObjectOption::None, quintptr(&el));
+    }
+
     //  serialization callbacks
     void handleBasic(bool &);
     void handleBasic(QByteArray &);
@@ -340,26 +772,36 @@ public:
     void handleJson(QJsonArray &v);
     bool startField(const QString &fieldName);
     bool startField(const char *fieldName);
+    bool startField(const FieldName &fieldName);
     void endField(const QString &fieldName);
     void endField(const char *fieldName);
+    void endField(const FieldName &fieldName);
     bool startElement(qint32 index);
     void endElement(qint32 index);
     bool startTuple(qint32 size);
     void endTuple(qint32 size);
 
+    // cheap checks on the current value, used to select the alternatives of a variant
+    QJsonValue::Type currentType() const { return currentValue().type(); }
+    bool hasCurrentField(const FieldName &fieldName) const;
+    bool currentFieldEquals(const FieldName &fieldName, QLatin1StringView value) const;
+
 private:
+    template<typename Key>
+    void pushField(Key fieldName, QLatin1StringView staticName, const QString &fieldPath);
+    bool failSilently();
     void warnExtra(const QJsonObject &e);
     void warnMissing(QStringView s);
     void warnNonNull();
     void warnInvalidSize(qint32 size, qint32 expectedSize);
-    void warn(const QString &msg);
+    void warn(ReaderError &&error);
     QJsonObject getExtraFields() const;
     bool startObjectF(const char *type, ObjectOptions options, quintptr id);
     void endObjectF(const char *type, ObjectOptions options, quintptr id);
     void startArrayF(qint32 &size);
     void endArrayF(qint32 &size);
     bool hasElement();
-    QString currentPath() const;
+    QStringList currentKeys() const;
     const QJsonValue &currentValue() const { return m_p->valuesStack.last().value; }
     ReaderPrivate *m_p;
 };
@@ -414,6 +856,26 @@ inline void doWalk(W &w, T &el)
             doWalk(w, *el);
     } else if constexpr (IsVariant<BaseT>::value) {
         w.handleVariant(el);
+    } else if constexpr (IsLazy<BaseT>::value) {
+        w.handleLazy(el);
+    } else if constexpr (IsMap<BaseT>::value) {
+        QStringList keys;
+        if (!w.startMap(keys, el))
+            return;
+        for (const QString &key : std::as_const(keys))
+            field(w, key, el[mapKeyFromString<typename BaseT::key_type>(key)]);
+        w.endMap(keys, el);
+    } else if constexpr (IsStdArray<BaseT>::value) {
+        constexpr qint32 size = qint32(std::tuple_size_v<BaseT>);
+        if (!w.startTuple(size))
+            return;
+        for (qint32 i = 0; i < size; ++i) {
+            if (!w.startElement(i))
+                break;
+            doWalk(w, el[i]);
+            w.endElement(i);
+        }
+        w.endTuple(size);
     } else if constexpr (IsList<BaseT>::value) {
         if constexpr (std::is_same_v<std::optional<typename BaseT::value_type>, BaseT>) {
             if (w.handleOptional(el) && el)
@@ -422,7 +884,7 @@ inline void doWalk(W &w, T &el)
             // broken gcc warns about optional being uninitialized, QTBUG-128574
             QT_WARNING_PUSH
             QT_WARNING_DISABLE_GCC("-Wmaybe-uninitialized")
-            int size = el.size();
+            int size = int(el.size());
             QT_WARNING_POP
             if (!w.startArray(size, el))
                 return;
@@ -446,17 +908,266 @@ template<typename T>
 inline void Reader::endObject(const char *type, ObjectOptions options, quintptr id, T &obj)
 {
     using BaseT = std::decay_t<T>;
+    const bool keepExtra = SetExtraFields<BaseT>::value && !validateOnly();
     QJsonObject extra;
-    if (SetExtraFields<BaseT>::value
-        || (options & (ObjectOption::KeepExtraFields | ObjectOption::WarnExtra)))
+    if (keepExtra || (options & (ObjectOption::KeepExtraFields | ObjectOption::WarnExtra)))
         extra = this->getExtraFields();
     this->endObjectF(type, options, id);
-    if constexpr (SetExtraFields<BaseT>::value)
-        obj.setExtraFields(extra);
-    else if (extra.constBegin() != extra.constEnd())
+    if constexpr (SetExtraFields<BaseT>::value) {
+        if (keepExtra)
+            obj.setExtraFields(extra);
+        return;
+    }
+    if (extra.constBegin() != extra.constEnd())
         warnExtra(extra);
 }
 
+// Walker collecting the fields that an object needs to be decoded without errors
+class RequiredFieldsCollector
+{
+public:
+    template<typename T>
+    bool startObject(const char *, ObjectOptions, quintptr, T &)
+    {
+        markRequired();
+        return false;
+    }
+    template<typename T>
+    void endObject(const char *, ObjectOptions, quintptr, T &)
+    {
+    }
+    template<typename T>
+    bool startArray(qint32 &, T &)
+    {
+        return false;
+    }
+    template<typename T>
+    void endArray(qint32 &, T &)
+    {
+    }
+    template<typename T>
+    bool startMap(QStringList &, T &)
+    {
+        return false;
+    }
+    template<typename T>
+    void endMap(QStringList &, T &)
+    {
+    }
+    template<typename T>
+    bool handleOptional(T &)
+    {
+        return false;
+    }
+    template<typename T>
+    bool handlePointer(T &)
+    {
+        return false;
+    }
+    template<typename T>
+    void handleVariant(T &)
+    {
+    }
+    template<typename T>
+    void handleEnum(T &)
+    {
+    }
+    template<typename T>
+    void handleLazy(T &)
+    {
+    }
+    template<typename T>
+    void handleBasic(T &)
+    {
+        markRequired();
+    }
+    template<typename T>
+    void handleJson(T &)
+    {
+    }
+    void handleNullType() { }
+    bool startField(const QString &)
+    {
+        m_current.reset();
+        return true;
+    }
+    bool startField(const char *fieldName)
+    {
+        m_current = FieldName(QLatin1StringView(fieldName));
+        return true;
+    }
+    bool startField(const FieldName &fieldName)
+    {
+        m_current = fieldName;
+        return true;
+    }
+    template<typename C>
+    void endField(const C &)
+    {
+        m_current.reset();
+    }
+    bool startElement(qint32) { return false; }
+    void endElement(qint32) { }
+    bool startTuple(qint32) { return false; }
+    void endTuple(qint32) { }
+
+    QList<FieldName> fields;
+
+private:
+    void markRequired()
+    {
+        if (m_current)
+            fields.append(*m_current);
+        m_current.reset();
+    }
+
+    std::optional<FieldName> m_current;
+};
+
+template<typename T>
+const QList<FieldName> &requiredFields()
+{
+    static const QList<FieldName> fields = []() {
+        RequiredFieldsCollector collector;
+        T el {};
+        el.walk(collector);
+        return collector.fields;
+    }();
+    return fields;
+}
+
+template<typename R, typename... T>
+bool mayDecodeAsAnyOf(const R &reader, const std::variant<T...> *)
+{
+    return (... || mayDecodeAs<T>(reader));
+}
+
+// Returns false if the current value of reader cannot be decoded as T without errors.
+// Only the json type, the required fields and the discriminator of objects are checked.
+template<typename T, typename R>
+bool mayDecodeAs(const R &reader)
+{
+    using BaseT = std::decay_t<T>;
+    const QJsonValue::Type type = reader.currentType();
+    const bool isNullOrMissing = (type == QJsonValue::Null || type == QJsonValue::Undefined);
+    if constexpr (std::is_same_v<BaseT, int> || std::is_same_v<BaseT, double>) {
+        return type == QJsonValue::Double;
+    } else if constexpr (std::is_same_v<BaseT, bool>) {
+        return type == QJsonValue::Bool;
+    } else if constexpr (std::is_same_v<BaseT, QByteArray>) {
+        return type == QJsonValue::String;
+    } else if constexpr (HasWalk<BaseT>::value) {
+        if (type != QJsonValue::Object)
+            return false;
+        if constexpr (HasDiscriminator<BaseT>::value) {
+            if (!reader.currentFieldEquals(BaseT::jsonDiscriminator.field,
+                                           BaseT::jsonDiscriminator.value))
+                return false;
+        }
+        for (const FieldName &fieldName : requiredFields<BaseT>()) {
+            if (!reader.hasCurrentField(fieldName))
+                return false;
+        }
+        return true;
+    } else if constexpr (std::is_same_v<BaseT, QJsonValue>) {
+        return true;
+    } else if constexpr (std::is_same_v<BaseT, QJsonObject>) {
+        return type == QJsonValue::Object || isNullOrMissing;
+    } else if constexpr (std::is_same_v<BaseT, QJsonArray>) {
+        return type == QJsonValue::Array || isNullOrMissing;
+    } else if constexpr (std::is_enum_v<BaseT>) {
+        return type == QJsonValue::Double || type == QJsonValue::String;
+    } else if constexpr (std::is_same_v<std::nullptr_t, BaseT>) {
+        return isNullOrMissing;
+    } else if constexpr (IsPointer<BaseT>::value) {
+        return isNullOrMissing || mayDecodeAs<decltype(*std::declval<BaseT>())>(reader);
+    } else if constexpr (IsVariant<BaseT>::value) {
+        return mayDecodeAsAnyOf(reader, static_cast<const BaseT *>(nullptr));
+    } else if constexpr (IsLazy<BaseT>::value) {
+        return mayDecodeAs<typename BaseT::Type>(reader);
+    } else if constexpr (IsMap<BaseT>::value) {
+        return type == QJsonValue::Object;
+    } else if constexpr (IsList<BaseT>::value) {
+        if constexpr (std::is_same_v<std::optional<typename BaseT::value_type>, BaseT>)
+            return isNullOrMissing || mayDecodeAs<typename BaseT::value_type>(reader);
+        else
+            return type == QJsonValue::Array;
+    } else {
+        return true;
+    }
+}
+
+/*!
+ * \internal
+ * Decodes the current value of reader into the variant el, p is the private data of reader.
+ *
+ * Shared by Reader, TextReader and CborReader, so they select the alternatives in the same way.
+ */
+template<typename R, typename P, typename... T, std::size_t... I>
+void readVariant(R &reader, P &p, std::variant<T...> &el, std::index_sequence<I...>)
+{
+    // normally the json type, the required fields or the discriminator leave a single
+    // alternative, which is then decoded directly into el
+    const bool candidates[] = { mayDecodeAs<T>(reader)... };
+    const int nCandidates = (0 + ... + int(candidates[I]));
+    if (nCandidates == 1) {
+        (void)(... || (candidates[I] && (doWalk(reader, el.template emplace<I>()), true)));
+        return;
+    }
+    if (nCandidates > 1) {
+        const ParseStatus origStatus = p.parseStatus;
+        const bool origSuppressErrors = p.suppressErrors;
+        p.suppressErrors = true;
+        auto tryRead = [&reader, &p, &el, &candidates, origStatus](auto index) {
+            constexpr std::size_t idx = decltype(index)::value;
+            if (!candidates[idx])
+                return false;
+            p.parseStatus = origStatus;
+            doWalk(reader, el.template emplace<idx>());
+            return p.parseStatus == ParseStatus::Normal;
+        };
+        const bool found = (... || tryRead(std::integral_constant<std::size_t, I>()));
+        p.suppressErrors = origSuppressErrors;
+        if (found)
+            return;
+        p.parseStatus = origStatus;
+    }
+    // no alternative fits: try all of them again to report their errors
+    std::tuple<T...> options;
+    int status = 0;
+    const P origStatus = p;
+    QList<ReaderError> err;
+    auto tryRead = [&reader, &p, &origStatus, &status, &el, &err](auto &x) {
+        if (status == 2)
+            return;
+        if (status == 1)
+            p = origStatus;
+        else
+            status = 1;
+        doWalk(reader, x);
+        if (p.parseStatus == ParseStatus::Normal) {
+            status = 2;
+            el = std::move(x);
+            return;
+        }
+        if (!p.collectErrors)
+            return;
+        ReaderError header;
+        header.kind = ReaderError::Kind::AlternativeFailed;
+        header.typeName = typeid(decltype(x)).name();
+        err.append(std::move(header));
+        err += p.errors;
+    };
+    std::apply([&tryRead](auto &...x) { (..., tryRead(x)); }, options);
+    if (status == 1 && p.collectErrors) {
+        ReaderError header;
+        header.kind = ReaderError::Kind::VariantFailed;
+        p.errors.clear();
+        p.errors.append(std::move(header));
+        p.errors += err;
+    }
+}
+
 class Q_JSONRPC_EXPORT JsonBuilder
 {
 public:
@@ -497,8 +1208,8 @@ public:
     bool startArray(qint32 &size, T &el)
     {
         using BaseT = std::decay_t<T>;
-        if constexpr (std::is_base_of_v<QList<typename BaseT::value_type>, BaseT>) {
-            size = el.size();
+        if constexpr (IsResizableList<BaseT>::value) {
+            size = qint32(el.size());
         } else {
             assert(false); // currently unsupported
         }
@@ -511,22 +1222,40 @@ public:
         this->endArrayF(size);
     }
 
+    template<typename T>
+    bool startMap(QStringList &keys, T &el)
+    {
+        keys = mapKeys(el);
+        return this->startObjectF("map", ObjectOption::None, quintptr(&el));
+    }
+
+    template<typename T>
+    void endMap(QStringList &, T &el)
+    {
+        this->endObjectF("map", ObjectOption::None, quintptr(&el));
+    }
+
     template<typename T>
     void handleVariant(T &el)
     {
         std::visit([this](auto &v) { doWalk(*this, v); }, el);
     }
 
+    template<typename T>
+    void handleLazy(T &el)
+    {
+        if (el.hasRawJson()) {
+            QJsonValue v = el.rawJsonValue();
+            this->handleJson(v);
+        } else {
+            doWalk(*this, el.value());
+        }
+    }
+
     template<typename T>
     void handleEnum(T &el)
     {
-        QString eVal = enumToString(el);
-        bool ok;
-        int value = eVal.toInt(&ok);
-        if (ok)
-            this->handleBasic(value);
-        else
-            this->handleBasic(eVal.toUtf8());
+        writeEnum(*this, el);
     }
 
     // serialization callbacks
@@ -540,14 +1269,18 @@ public:
     void handleJson(QJsonArray &v);
     bool startField(const QString &fieldName);
     bool startField(const char *fieldName);
+    bool startField(const FieldName &fieldName);
     void endField(const QString &);
     void endField(const char *);
+    void endField(const FieldName &);
     bool startElement(qint32 index);
     void endElement(qint32);
     bool startTuple(qint32 size);
     void endTuple(qint32 size);
 
 private:
+    template<typename Key>
+    void insertField(Key key);
     void handleMissingOptional();
     bool startObjectF(const char *, ObjectOptions, quintptr);
     void endObjectF(const char *, ObjectOptions, quintptr);
@@ -559,6 +1292,30 @@ private:
     QList<std::variant<QJsonObject, QJsonArray, QJsonValue>> m_values;
 };
 
+/*!
+ * \internal
+ * Checks that value can be decoded as a T, without building the decoded object.
+ *
+ * Missing and mistyped fields are reported like when decoding, and extra fields of objects
+ * using ObjectOption::WarnExtra too. Returns true if no error was found, and stores the errors
+ * in errorMessages if it is not null. Lists are checked against a single scratch element,
+ * strings and json values are not copied, and lazy fields are checked too. Enums have to be
+ * numbers or known names, which decoding would silently turn into the default value otherwise.
+ */
+template<typename T>
+bool validate(const QJsonValue &value, QStringList *errorMessages = nullptr)
+{
+    Reader r(value);
+    r.setValidateOnly(true);
+    T scratch;
+    doWalk(r, scratch);
+    const QStringList errors = r.errorMessages();
+    r.clearErrorMessages();
+    if (errorMessages)
+        *errorMessages = errors;
+    return errors.isEmpty();
+}
+
 template<typename... Params>
 QJsonValue toJsonValue(Params ...params)
 {
@@ -0,0 +1,235 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qtypedjsonhash_p.h"
+#include <QtCore/qcborarray.h>
+#include <QtCore/qcbormap.h>
+#include <QtCore/qcborvalue.h>
+#include <QtCore/qendian.h>
+#include <QtCore/qjsonarray.h>
+#include <QtCore/qjsonobject.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+namespace QTypedJson {
+
+/*!
+ * \internal
+ * \class QTypedJson::ContentHasher
+ * \brief Walker that feeds a canonical encoding of a value to a hash, or compares it
+ *
+ * The encoding follows the json data model (doubles without fractional part are encoded like
+ * ints, missing optional fields are skipped), with object members in walk order and integers
+ * in little endian, so that hashes are stable and can be used as cache keys. Json fields are
+ * fed as a tag followed by their CBOR encoding, so the encoding depends on the walked type.
+ *
+ * In Compare mode the encoding is compared with a recorded one instead, and the walk skips
+ * everything after the first difference.
+ */
+
+void ContentHasher::feed(QByteArrayView data)
+{
+    if (m_mode == Mode::Compare) {
+        if (m_differs)
+            return;
+        if (m_pos + data.size() > m_data->size()
+            || std::memcmp(m_data->constData() + m_pos, data.data(), data.size()) != 0) {
+            m_differs = true;
+            return;
+        }
+        m_pos += data.size();
+        return;
+    }
+    if (m_mode == Mode::Record)
+        m_data->append(data);
+    quint64 h = m_hash;
+    for (char c : data) {
+        h ^= uchar(c);
+        h *= 1099511628211ull;
+    }
+    m_hash = h;
+}
+
+void ContentHasher::feedSize(qsizetype size)
+{
+    const quint64 v = qToLittleEndian(quint64(size));
+    feed(QByteArrayView(reinterpret_cast<const char *>(&v), sizeof(v)));
+}
+
+void ContentHasher::startValue(char tag)
+{
+    if (m_hasPendingKey) {
+        feed("f");
+        feedSize(m_pendingKey.size());
+        feed(m_pendingKey);
+        m_hasPendingKey = false;
+    }
+    feed(QByteArrayView(&tag, 1));
+}
+
+void ContentHasher::handleBasic(const bool &v)
+{
+    startValue('b');
+    feed(v ? "1" : "0");
+}
+
+void ContentHasher::handleBasic(const QByteArray &v)
+{
+    startValue('s');
+    feedSize(v.size());
+    feed(v);
+}
+
+void ContentHasher::handleBasic(const int &v)
+{
+    startValue('i');
+    const qint64 le = qToLittleEndian(qint64(v));
+    feed(QByteArrayView(reinterpret_cast<const char *>(&le), sizeof(le)));
+}
+
+void ContentHasher::handleBasic(const double &v)
+{
+    if (!std::isfinite(v)) {
+        handleNullType(); // like QJsonValue
+    } else if (v == std::floor(v) && std::abs(v) < (1LL << std::numeric_limits<double>::digits)) {
+        startValue('i');
+        const qint64 le = qToLittleEndian(qint64(v));
+        feed(QByteArrayView(reinterpret_cast<const char *>(&le), sizeof(le)));
+    } else {
+        startValue('d');
+        quint64 bits;
+        std::memcpy(&bits, &v, sizeof(bits));
+        const quint64 le = qToLittleEndian(bits);
+        feed(QByteArrayView(reinterpret_cast<const char *>(&le), sizeof(le)));
+    }
+}
+
+void ContentHasher::handleNullType()
+{
+    startValue('n');
+}
+
+void ContentHasher::handleMissingOptional()
+{
+    // missing fields are skipped, missing elements fed as null
+    if (m_hasPendingKey)
+        m_hasPendingKey = false;
+    else
+        handleNullType();
+}
+
+void ContentHasher::handleJson(QJsonValue &v)
+{
+    if (v.isUndefined()) {
+        handleMissingOptional();
+        return;
+    }
+    startValue('j');
+    const QByteArray cbor = QCborValue::fromJsonValue(v).toCbor();
+    feedSize(cbor.size());
+    feed(cbor);
+}
+
+void ContentHasher::handleJson(QJsonObject &v)
+{
+    startValue('j');
+    const QByteArray cbor = QCborMap::fromJsonObject(v).toCborValue().toCbor();
+    feedSize(cbor.size());
+    feed(cbor);
+}
+
+void ContentHasher::handleJson(QJsonArray &v)
+{
+    startValue('j');
+    const QByteArray cbor = QCborArray::fromJsonArray(v).toCborValue().toCbor();
+    feedSize(cbor.size());
+    feed(cbor);
+}
+
+bool ContentHasher::startField(const QString &fieldName)
+{
+    m_pendingKey = fieldName.toUtf8();
+    m_hasPendingKey = true;
+    return !m_differs;
+}
+
+bool ContentHasher::startField(const char *fieldName)
+{
+    m_pendingKey = QByteArray::fromRawData(fieldName, qstrlen(fieldName));
+    m_hasPendingKey = true;
+    return !m_differs;
+}
+
+bool ContentHasher::startField(const FieldName &fieldName)
+{
+    m_pendingKey = QByteArray::fromRawData(fieldName.name.data(), fieldName.name.size());
+    m_hasPendingKey = true;
+    return !m_differs;
+}
+
+void ContentHasher::endField(const QString &)
+{
+    m_hasPendingKey = false;
+}
+
+void ContentHasher::endField(const char *)
+{
+    m_hasPendingKey = false;
+}
+
+void ContentHasher::endField(const FieldName &)
+{
+    m_hasPendingKey = false;
+}
+
+bool ContentHasher::startObjectF()
+{
+    if (m_differs)
+        return false;
+    startValue('{');
+    return true;
+}
+
+void ContentHasher::endObjectF()
+{
+    feed("}");
+}
+
+bool ContentHasher::startArrayF(qint32 &size)
+{
+    if (m_differs)
+        return false;
+    startValue('[');
+    feedSize(size);
+    return true;
+}
+
+void ContentHasher::endArrayF(qint32 &)
+{
+    feed("]");
+}
+
+bool ContentHasher::startElement(qint32)
+{
+    return !m_differs;
+}
+
+void ContentHasher::endElement(qint32) { }
+
+bool ContentHasher::startTuple(qint32 size)
+{
+    return startArrayF(size);
+}
+
+void ContentHasher::endTuple(qint32 size)
+{
+    endArrayF(size);
+}
+
+} // namespace QTypedJson
+
+QT_END_NAMESPACE
@@ -0,0 +1,202 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QTYPEDJSONHASH_P_H
+#define QTYPEDJSONHASH_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtJsonRpc/private/qtypedjson_p.h>
+#include <QtCore/qbytearray.h>
+#include <QtCore/qbytearrayview.h>
+#include <QtCore/qlist.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace QTypedJson {
+
+class Q_JSONRPC_EXPORT ContentHasher
+{
+    Q_DISABLE_COPY_MOVE(ContentHasher)
+public:
+    enum class Mode {
+        Hash, // computes hash()
+        Record, // computes hash() and appends the encoding to data
+        Compare // compares the encoding with data, see matches()
+    };
+
+    explicit ContentHasher(Mode mode = Mode::Hash, QByteArray *data = nullptr)
+        : m_mode(mode), m_data(data)
+    {
+        Q_ASSERT(mode == Mode::Hash || data);
+    }
+
+    // public api
+    quint64 hash() const { return m_hash; }
+    bool matches() const { return !m_differs && m_pos == m_data->size(); }
+
+    // serialization templates
+    template<typename T>
+    bool handleOptional(T &el)
+    {
+        if (el)
+            return true;
+        this->handleMissingOptional();
+        return false;
+    }
+
+    template<typename T>
+    bool handlePointer(T &el)
+    {
+        if (el)
+            return true;
+        this->handleMissingOptional();
+        return false;
+    }
+
+    template<typename T>
+    bool startObject(const char *, ObjectOptions, quintptr, T &)
+    {
+        return this->startObjectF();
+    }
+
+    template<typename T>
+    void endObject(const char *, ObjectOptions, quintptr, T &)
+    {
+        this->endObjectF();
+    }
+
+    template<typename T>
+    bool startArray(qint32 &size, T &el)
+    {
+        using BaseT = std::decay_t<T>;
+        if constexpr (IsResizableList<BaseT>::value) {
+            size = qint32(el.size());
+        } else {
+            assert(false); // currently unsupported
+        }
+        return startArrayF(size);
+    }
+
+    template<typename T>
+    void endArray(qint32 &size, T &)
+    {
+        this->endArrayF(size);
+    }
+
+    template<typename T>
+    bool startMap(QStringList &keys, T &el)
+    {
+        keys = mapKeys(el);
+        return this->startObjectF();
+    }
+
+    template<typename T>
+    void endMap(QStringList &, T &)
+    {
+        this->endObjectF();
+    }
+
+    template<typename T>
+    void handleVariant(T &el)
+    {
+        std::visit([this](auto &v) { doWalk(*this, v); }, el);
+    }
+
+    template<typename T>
+    void handleLazy(T &el)
+    {
+        doWalk(*this, el.value());
+    }
+
+    template<typename T>
+    void handleEnum(T &el)
+    {
+        writeEnum(*this, el);
+    }
+
+    // serialization callbacks
+    void handleBasic(const bool &v);
+    void handleBasic(const QByteArray &v);
+    void handleBasic(const int &v);
+    void handleBasic(const double &v);
+    void handleNullType();
+    void handleJson(QJsonValue &v);
+    void handleJson(QJsonObject &v);
+    void handleJson(QJsonArray &v);
+    bool startField(const QString &fieldName);
+    bool startField(const char *fieldName);
+    bool startField(const FieldName &fieldName);
+    void endField(const QString &);
+    void endField(const char *);
+    void endField(const FieldName &);
+    bool startElement(qint32 index);
+    void endElement(qint32);
+    bool startTuple(qint32 size);
+    void endTuple(qint32 size);
+
+private:
+    void handleMissingOptional();
+    bool startObjectF();
+    void endObjectF();
+    bool startArrayF(qint32 &);
+    void endArrayF(qint32 &);
+    void startValue(char tag);
+    void feed(QByteArrayView data);
+    void feedSize(qsizetype size);
+
+    Mode m_mode;
+    QByteArray *m_data;
+    quint64 m_hash = 14695981039346656037ull; // FNV-1a
+    qsizetype m_pos = 0; // compared bytes of m_data
+    bool m_differs = false;
+    QByteArray m_pendingKey; // name of the field whose value was not fed yet
+    bool m_hasPendingKey = false;
+};
+
+/*!
+ * \internal
+ * Returns a 64 bit hash of the content of value, which is stable across runs and platforms.
+ * Values of type T with the same json representation have the same hash. Hashes of different
+ * types should not be compared: json fields (QJsonValue, QJsonObject, QJsonArray) are hashed
+ * through their CBOR encoding, so they do not hash like a struct with the same json.
+ */
+template<typename T>
+quint64 contentHash(const T &value)
+{
+    ContentHasher h;
+    doWalk(h, const_cast<T &>(value));
+    return h.hash();
+}
+
+/*!
+ * \internal
+ * Returns true if a and b have the same content, without converting them to json.
+ * The walk of b stops at the first difference.
+ */
+template<typename T>
+bool contentEquals(const T &a, const T &b)
+{
+    QByteArray encoding;
+    {
+        ContentHasher h(ContentHasher::Mode::Record, &encoding);
+        doWalk(h, const_cast<T &>(a));
+    }
+    ContentHasher h(ContentHasher::Mode::Compare, &encoding);
+    doWalk(h, const_cast<T &>(b));
+    return h.matches();
+}
+
+} // namespace QTypedJson
+QT_END_NAMESPACE
+
+#endif // QTYPEDJSONHASH_P_H
@@ -0,0 +1,120 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QTYPEDJSONLAZY_P_H
+#define QTYPEDJSONLAZY_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtJsonRpc/private/qtypedjson_p.h>
+#include <QtJsonRpc/private/qtypedjsontextreader_p.h>
+#include <QtCore/qbytearray.h>
+#include <QtCore/qjsonvalue.h>
+
+#include <optional>
+#include <variant>
+
+QT_BEGIN_NAMESPACE
+
+namespace QTypedJson {
+
+/*!
+ * \internal
+ * \class QTypedJson::Lazy
+ * \brief Field whose value is decoded only when it is first accessed
+ *
+ * The readers store the json of the field (the QJsonValue, or the text for TextReader) instead
+ * of decoding it. Writers copy that json as it is, as long as the value was not accessed.
+ * Accessing the value through a const Lazy decodes it too, so like for implicitly shared
+ * containers a const Lazy should not be used from several threads at once.
+ */
+template<typename T>
+class Lazy
+{
+public:
+    using Type = T;
+
+    Lazy() = default;
+    Lazy(const T &value) : m_value(value) { }
+    Lazy(T &&value) : m_value(std::move(value)) { }
+
+    const T &value() const
+    {
+        if (!m_value)
+            decode();
+        return *m_value;
+    }
+    T &value()
+    {
+        if (!m_value)
+            decode();
+        return *m_value;
+    }
+    const T &operator*() const { return value(); }
+    T &operator*() { return value(); }
+    const T *operator->() const { return &value(); }
+    T *operator->() { return &value(); }
+
+    bool isDecoded() const { return m_value.has_value(); }
+
+    // undecoded json, used by the walkers
+    bool hasRawJson() const { return !m_value && !std::holds_alternative<std::monostate>(m_raw); }
+    bool hasRawJsonText() const { return !m_value && std::holds_alternative<QByteArray>(m_raw); }
+    const QByteArray &rawJsonText() const { return std::get<QByteArray>(m_raw); }
+    QJsonValue rawJsonValue() const
+    {
+        if (const QJsonValue *v = std::get_if<QJsonValue>(&m_raw))
+            return *v;
+        if (const QByteArray *text = std::get_if<QByteArray>(&m_raw)) {
+            const JsonTape tape(*text);
+            if (tape.isValid())
+                return tape.toJsonValue(0);
+        }
+        return QJsonValue(QJsonValue::Undefined);
+    }
+
+    void setRawJson(const QJsonValue &v)
+    {
+        m_value.reset();
+        if (v.isUndefined())
+            m_raw = std::monostate();
+        else
+            m_raw = v;
+    }
+    void setRawJsonText(const QByteArray &text)
+    {
+        m_value.reset();
+        m_raw = text;
+    }
+
+private:
+    void decode() const
+    {
+        m_value.emplace();
+        if (const QJsonValue *v = std::get_if<QJsonValue>(&m_raw)) {
+            Reader r(*v);
+            doWalk(r, *m_value);
+        } else if (const QByteArray *text = std::get_if<QByteArray>(&m_raw)) {
+            TextReader r(*text);
+            doWalk(r, *m_value);
+        }
+        m_raw = std::monostate();
+    }
+
+    mutable std::optional<T> m_value;
+    mutable std::variant<std::monostate, QJsonValue, QByteArray> m_raw;
+};
+
+} // namespace QTypedJson
+QT_END_NAMESPACE
+
+#endif // QTYPEDJSONLAZY_P_H
@@ -0,0 +1,1010 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qtypedjsontextreader_p.h"
+#include <QtCore/qjsonarray.h>
+#include <QtCore/qjsonobject.h>
+#include <QtCore/qvarlengtharray.h>
+
+#include <algorithm>
+#include <cstring>
+
+QT_BEGIN_NAMESPACE
+
+using namespace Qt::StringLiterals;
+
+namespace QTypedJson {
+
+/*!
+ * \internal
+ * \class QTypedJson::JsonTape
+ * \brief Tokenizes JSON text in a single pass into a flat list of tokens
+ *
+ * Each value gets a token with its position in the text, containers are followed by the tokens
+ * of their children (key and value alternating for objects), and Token::next allows skipping
+ * a whole subtree. Strings are not decoded until they are needed.
+ *
+ * Values nested deeper than maxTokenDepth are validated, but get no tokens of their own, only
+ * rawValue() is meaningful for them.
+ */
+
+namespace {
+constexpr int MaxNesting = 1024;
+
+void appendUtf8(QByteArray &out, char32_t ucs4)
+{
+    if (ucs4 < 0x80) {
+        out.append(char(ucs4));
+    } else if (ucs4 < 0x800) {
+        out.append(char(0xc0 | (ucs4 >> 6)));
+        out.append(char(0x80 | (ucs4 & 0x3f)));
+    } else if (ucs4 < 0x10000) {
+        out.append(char(0xe0 | (ucs4 >> 12)));
+        out.append(char(0x80 | ((ucs4 >> 6) & 0x3f)));
+        out.append(char(0x80 | (ucs4 & 0x3f)));
+    } else {
+        out.append(char(0xf0 | (ucs4 >> 18)));
+        out.append(char(0x80 | ((ucs4 >> 12) & 0x3f)));
+        out.append(char(0x80 | ((ucs4 >> 6) & 0x3f)));
+        out.append(char(0x80 | (ucs4 & 0x3f)));
+    }
+}
+
+int hexValue(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+// reads the 4 hex digits of a \u escape starting at pos, returns -1 if they are invalid
+int readHex4(QByteArrayView in, qsizetype pos)
+{
+    if (pos + 4 > in.size())
+        return -1;
+    int res = 0;
+    for (qsizetype i = pos; i < pos + 4; ++i) {
+        const int v = hexValue(in[i]);
+        if (v < 0)
+            return -1;
+        res = (res << 4) | v;
+    }
+    return res;
+}
+
+// returns the length of the UTF-8 sequence starting at pos, or 0 if it is invalid
+qsizetype utf8SequenceLength(const char *data, qsizetype pos, qsizetype size)
+{
+    const uchar c = uchar(data[pos]);
+    qsizetype length = 0;
+    char32_t ucs4 = 0;
+    char32_t minimum = 0;
+    if (c < 0x80)
+        return 1;
+    if ((c & 0xe0) == 0xc0) {
+        length = 2;
+        ucs4 = c & 0x1f;
+        minimum = 0x80;
+    } else if ((c & 0xf0) == 0xe0) {
+        length = 3;
+        ucs4 = c & 0x0f;
+        minimum = 0x800;
+    } else if ((c & 0xf8) == 0xf0) {
+        length = 4;
+        ucs4 = c & 0x07;
+        minimum = 0x10000;
+    } else {
+        return 0;
+    }
+    if (pos + length > size)
+        return 0;
+    for (qsizetype i = 1; i < length; ++i) {
+        const uchar b = uchar(data[pos + i]);
+        if ((b & 0xc0) != 0x80)
+            return 0;
+        ucs4 = (ucs4 << 6) | (b & 0x3f);
+    }
+    // overlong encodings, surrogates and values past the last code point
+    if (ucs4 < minimum || ucs4 > char32_t(QChar::LastValidCodePoint) || QChar::isSurrogate(ucs4))
+        return 0;
+    return length;
+}
+
+QByteArray unescape(QByteArrayView in)
+{
+    QByteArray out;
+    out.reserve(in.size());
+    qsizetype pos = 0;
+    while (pos < in.size()) {
+        const void *slash = std::memchr(in.data() + pos, '\\', size_t(in.size() - pos));
+        const qsizetype slashPos =
+                (slash ? static_cast<const char *>(slash) - in.data() : in.size());
+        out.append(in.data() + pos, slashPos - pos);
+        pos = slashPos + 1;
+        if (pos >= in.size())
+            break;
+        const char c = in[pos++];
+        switch (c) {
+        case 'b':
+            out.append('\b');
+            break;
+        case 'f':
+            out.append('\f');
+            break;
+        case 'n':
+            out.append('\n');
+            break;
+        case 'r':
+            out.append('\r');
+            break;
+        case 't':
+            out.append('\t');
+            break;
+        case 'u': {
+            int code = readHex4(in, pos);
+            if (code < 0) {
+                out.append("\\u");
+                break;
+            }
+            pos += 4;
+            char32_t ucs4 = char32_t(code);
+            if (QChar::isHighSurrogate(ucs4)) {
+                const int low = (pos + 1 < in.size() && in[pos] == '\\' && in[pos + 1] == 'u')
+                        ? readHex4(in, pos + 2)
+                        : -1;
+                if (low >= 0 && QChar::isLowSurrogate(char32_t(low))) {
+                    ucs4 = QChar::surrogateToUcs4(char16_t(code), char16_t(low));
+                    pos += 6;
+                } else {
+                    ucs4 = QChar::ReplacementCharacter;
+                }
+            } else if (QChar::isLowSurrogate(ucs4)) {
+                ucs4 = QChar::ReplacementCharacter;
+            }
+            appendUtf8(out, ucs4);
+            break;
+        }
+        default: // '"', '\\' and '/', JsonTape rejects all other escapes
+            out.append(c);
+            break;
+        }
+    }
+    return out;
+}
+} // namespace
+
+JsonTape::JsonTape(const QByteArray &text, int maxTokenDepth)
+    : m_text(text), m_maxTokenDepth(maxTokenDepth)
+{
+    qsizetype pos = skipWhitespace(0);
+    if (!parseValue(pos, 0))
+        return;
+    pos = skipWhitespace(pos);
+    if (pos != m_text.size())
+        fail(u"Garbage at the end of the document"_s, pos);
+}
+
+qsizetype JsonTape::skipWhitespace(qsizetype pos) const
+{
+    const char *data = m_text.constData();
+    const qsizetype size = m_text.size();
+    while (pos < size) {
+        switch (data[pos]) {
+        case ' ':
+        case '\t':
+        case '\n':
+        case '\r':
+            ++pos;
+            continue;
+        default:
+            return pos;
+        }
+    }
+    return pos;
+}
+
+bool JsonTape::fail(const QString &msg, qsizetype pos)
+{
+    m_error = u"%1 at offset %2"_s.arg(msg, QString::number(pos));
+    m_tokens.clear();
+    return false;
+}
+
+void JsonTape::addToken(int depth, TokenType type, qsizetype begin, qsizetype end, bool escaped,
+                        quint32 hash)
+{
+    if (depth <= m_maxTokenDepth)
+        m_tokens.append(
+                Token { type, escaped, false, qint32(m_tokens.size() + 1), 0, hash, begin, end });
+}
+
+bool JsonTape::parseValue(qsizetype &pos, int depth)
+{
+    if (pos >= m_text.size())
+        return fail(u"Unexpected end of document"_s, pos);
+    switch (m_text.at(pos)) {
+    case '{':
+        return parseContainer(pos, depth, TokenType::Object);
+    case '[':
+        return parseContainer(pos, depth, TokenType::Array);
+    case '"':
+        return parseString(pos, depth);
+    case 't':
+        return parseLiteral(pos, depth, "true", TokenType::True);
+    case 'f':
+        return parseLiteral(pos, depth, "false", TokenType::False);
+    case 'n':
+        return parseLiteral(pos, depth, "null", TokenType::Null);
+    default:
+        return parseNumber(pos, depth);
+    }
+}
+
+bool JsonTape::parseContainer(qsizetype &pos, int depth, TokenType type)
+{
+    if (depth >= MaxNesting)
+        return fail(u"Document too deeply nested"_s, pos);
+    const qint32 index = qint32(m_tokens.size());
+    addToken(depth, type, pos, pos);
+    const char *data = m_text.constData();
+    const qsizetype size = m_text.size();
+    const char close = (type == TokenType::Object ? '}' : ']');
+    qint32 count = 0;
+    QVarLengthArray<quint32, 32> keyHashes;
+    pos = skipWhitespace(pos + 1);
+    if (pos < size && data[pos] == close) {
+        ++pos;
+    } else {
+        while (true) {
+            if (type == TokenType::Object) {
+                if (pos >= size || data[pos] != '"')
+                    return fail(u"Expected a member name"_s, pos);
+                if (!parseString(pos, depth + 1, true))
+                    return false;
+                if (depth < m_maxTokenDepth)
+                    keyHashes.append(keyHash(qint32(m_tokens.size() - 1)));
+                pos = skipWhitespace(pos);
+                if (pos >= size || data[pos] != ':')
+                    return fail(u"Expected ':' after the member name"_s, pos);
+                pos = skipWhitespace(pos + 1);
+            }
+            if (!parseValue(pos, depth + 1))
+                return false;
+            ++count;
+            pos = skipWhitespace(pos);
+            if (pos >= size)
+                return fail(u"Unexpected end of document"_s, pos);
+            if (data[pos] == ',') {
+                pos = skipWhitespace(pos + 1);
+                continue;
+            }
+            if (data[pos] == close) {
+                ++pos;
+                break;
+            }
+            return fail(u"Expected ',' or '%1'"_s.arg(QChar::fromLatin1(close)), pos);
+        }
+    }
+    if (depth <= m_maxTokenDepth) {
+        Token &t = m_tokens[index];
+        t.count = count;
+        t.end = pos;
+        t.next = qint32(m_tokens.size());
+        if (keyHashes.size() > 1) {
+            std::sort(keyHashes.begin(), keyHashes.end());
+            t.duplicateKeys =
+                    std::adjacent_find(keyHashes.begin(), keyHashes.end()) != keyHashes.end();
+        }
+    }
+    return true;
+}
+
+bool JsonTape::parseString(qsizetype &pos, int depth, bool isKey)
+{
+    const char *data = m_text.constData();
+    const qsizetype size = m_text.size();
+    const qsizetype begin = pos;
+    bool escaped = false;
+    ++pos;
+    while (true) {
+        if (pos >= size)
+            return fail(u"Unterminated string"_s, begin);
+        const uchar c = uchar(data[pos]);
+        if (c == '"')
+            break;
+        if (c == '\\') {
+            escaped = true;
+            if (pos + 1 >= size)
+                return fail(u"Unterminated string"_s, begin);
+            switch (data[pos + 1]) {
+            case '"':
+            case '\\':
+            case '/':
+            case 'b':
+            case 'f':
+            case 'n':
+            case 'r':
+            case 't':
+                pos += 2;
+                continue;
+            case 'u':
+                if (readHex4(m_text, pos + 2) < 0)
+                    return fail(u"Invalid escape sequence"_s, pos);
+                pos += 6;
+                continue;
+            default:
+                return fail(u"Invalid escape sequence"_s, pos);
+            }
+        }
+        if (c < 0x20)
+            return fail(u"Control character in string"_s, pos);
+        if (c >= 0x80) {
+            const qsizetype length = utf8SequenceLength(data, pos, size);
+            if (length == 0)
+                return fail(u"Invalid UTF-8 in string"_s, pos);
+            pos += length;
+            continue;
+        }
+        ++pos;
+    }
+    const quint32 hash = (isKey && !escaped) ? fieldNameHash(data + begin + 1, pos - begin - 1) : 0;
+    ++pos;
+    addToken(depth, TokenType::String, begin, pos, escaped, hash);
+    return true;
+}
+
+bool JsonTape::parseNumber(qsizetype &pos, int depth)
+{
+    const char *data = m_text.constData();
+    const qsizetype size = m_text.size();
+    const qsizetype begin = pos;
+    auto skipDigits = [&]() {
+        const qsizetype start = pos;
+        while (pos < size && data[pos] >= '0' && data[pos] <= '9')
+            ++pos;
+        return pos != start;
+    };
+    if (data[pos] == '-')
+        ++pos;
+    if (pos < size && data[pos] == '0') {
+        // no leading zeros
+        ++pos;
+        if (pos < size && data[pos] >= '0' && data[pos] <= '9')
+            return fail(u"Invalid number"_s, begin);
+    } else if (!skipDigits()) {
+        return fail(u"Invalid value"_s, begin);
+    }
+    if (pos < size && data[pos] == '.') {
+        ++pos;
+        if (!skipDigits())
+            return fail(u"Invalid number"_s, begin);
+    }
+    if (pos < size && (data[pos] == 'e' || data[pos] == 'E')) {
+        ++pos;
+        if (pos < size && (data[pos] == '+' || data[pos] == '-'))
+            ++pos;
+        if (!skipDigits())
+            return fail(u"Invalid number"_s, begin);
+    }
+    addToken(depth, TokenType::Number, begin, pos);
+    return true;
+}
+
+bool JsonTape::parseLiteral(qsizetype &pos, int depth, QByteArrayView literal, TokenType type)
+{
+    if (m_text.size() - pos < literal.size()
+        || std::memcmp(m_text.constData() + pos, literal.data(), size_t(literal.size())) != 0)
+        return fail(u"Invalid value"_s, pos);
+    addToken(depth, type, pos, pos + literal.size());
+    pos += literal.size();
+    return true;
+}
+
+QByteArrayView JsonTape::rawValue(qint32 index) const
+{
+    const Token &t = m_tokens.at(index);
+    return QByteArrayView(m_text.constData() + t.begin, t.end - t.begin);
+}
+
+// returns the UTF-8 content of a string token, without going through UTF-16
+QByteArray JsonTape::string(qint32 index) const
+{
+    const Token &t = m_tokens.at(index);
+    if (t.type != TokenType::String)
+        return QByteArray();
+    const QByteArrayView content(m_text.constData() + t.begin + 1, t.end - t.begin - 2);
+    if (t.escaped)
+        return unescape(content);
+    return content.toByteArray();
+}
+
+// fieldNameHash of the decoded member name
+quint32 JsonTape::keyHash(qint32 keyIndex) const
+{
+    const Token &t = m_tokens.at(keyIndex);
+    if (!t.escaped)
+        return t.hash;
+    const QByteArray key = string(keyIndex);
+    return fieldNameHash(key.constData(), key.size());
+}
+
+bool JsonTape::keyEquals(qint32 keyIndex, QByteArrayView key) const
+{
+    const Token &t = m_tokens.at(keyIndex);
+    if (t.escaped)
+        return QByteArrayView(string(keyIndex)) == key;
+    return t.end - t.begin - 2 == key.size()
+            && std::memcmp(m_text.constData() + t.begin + 1, key.data(), size_t(key.size())) == 0;
+}
+
+bool JsonTape::keyEquals(qint32 keyIndex, const FieldName &key) const
+{
+    const Token &t = m_tokens.at(keyIndex);
+    if (t.escaped)
+        return QByteArrayView(string(keyIndex)) == QByteArrayView(key.name);
+    return t.hash == key.hash && t.end - t.begin - 2 == key.name.size()
+            && std::memcmp(m_text.constData() + t.begin + 1, key.name.data(),
+                           size_t(key.name.size()))
+            == 0;
+}
+
+double JsonTape::toDouble(qint32 index) const
+{
+    if (m_tokens.at(index).type != TokenType::Number)
+        return 0;
+    return rawValue(index).toDouble();
+}
+
+// same conversion rules as QJsonValue::toInt()
+int JsonTape::toInt(qint32 index, int defaultValue) const
+{
+    if (m_tokens.at(index).type != TokenType::Number)
+        return defaultValue;
+    const double d = rawValue(index).toDouble();
+    if (!(d >= double(std::numeric_limits<int>::min())
+          && d <= double(std::numeric_limits<int>::max())))
+        return defaultValue;
+    const int i = int(d);
+    return (double(i) == d) ? i : defaultValue;
+}
+
+qint32 JsonTape::findMember(qint32 objectIndex, QByteArrayView key) const
+{
+    const Token &o = m_tokens.at(objectIndex);
+    if (o.type != TokenType::Object)
+        return -1;
+    // like QJsonObject, the last of duplicate members wins
+    qint32 res = -1;
+    qint32 keyIndex = objectIndex + 1;
+    for (qint32 i = 0; i < o.count; ++i) {
+        if (keyEquals(keyIndex, key)) {
+            res = keyIndex + 1;
+            if (!o.duplicateKeys)
+                break;
+        }
+        keyIndex = m_tokens.at(keyIndex + 1).next;
+    }
+    return res;
+}
+
+qint32 JsonTape::findMember(qint32 objectIndex, const FieldName &key) const
+{
+    const Token &o = m_tokens.at(objectIndex);
+    if (o.type != TokenType::Object)
+        return -1;
+    // like QJsonObject, the last of duplicate members wins
+    qint32 res = -1;
+    qint32 keyIndex = objectIndex + 1;
+    for (qint32 i = 0; i < o.count; ++i) {
+        if (keyEquals(keyIndex, key)) {
+            res = keyIndex + 1;
+            if (!o.duplicateKeys)
+                break;
+        }
+        keyIndex = m_tokens.at(keyIndex + 1).next;
+    }
+    return res;
+}
+
+QJsonValue JsonTape::toJsonValue(qint32 index) const
+{
+    const Token &t = m_tokens.at(index);
+    switch (t.type) {
+    case TokenType::Null:
+        return QJsonValue(QJsonValue::Null);
+    case TokenType::True:
+        return QJsonValue(true);
+    case TokenType::False:
+        return QJsonValue(false);
+    case TokenType::Number: {
+        const QByteArrayView raw = rawValue(index);
+        bool isInteger = true;
+        for (char c : raw) {
+            if (c == '.' || c == 'e' || c == 'E') {
+                isInteger = false;
+                break;
+            }
+        }
+        bool ok = false;
+        if (isInteger) {
+            const qint64 v = raw.toLongLong(&ok);
+            if (ok)
+                return QJsonValue(v);
+        }
+        return QJsonValue(raw.toDouble());
+    }
+    case TokenType::String:
+        return QJsonValue(QString::fromUtf8(string(index)));
+    case TokenType::Object: {
+        QJsonObject res;
+        qint32 keyIndex = index + 1;
+        for (qint32 i = 0; i < t.count; ++i) {
+            res.insert(QString::fromUtf8(string(keyIndex)), toJsonValue(keyIndex + 1));
+            keyIndex = m_tokens.at(keyIndex + 1).next;
+        }
+        return res;
+    }
+    case TokenType::Array: {
+        QJsonArray res;
+        qint32 elIndex = index + 1;
+        for (qint32 i = 0; i < t.count; ++i) {
+            res.append(toJsonValue(elIndex));
+            elIndex = m_tokens.at(elIndex).next;
+        }
+        return res;
+    }
+    }
+    return QJsonValue(QJsonValue::Undefined);
+}
+
+/*!
+ * \internal
+ * \class QTypedJson::TextReader
+ * \brief Decodes JSON text directly into objects with a walk method
+ *
+ * Works like Reader, with the same error reporting and handling of extra fields, but reads the
+ * JSON text through a JsonTape instead of building a QJsonDocument first. Strings are copied
+ * from the text as UTF-8, QJsonValue instances are only created for QJsonValue fields and
+ * extra fields.
+ */
+
+TextReader::TextReader(const QByteArray &json) : m_tape(json), m_p(new TextReaderPrivate)
+{
+    m_p->valuesStack.append(TextReaderPrivate::ValueStack { m_tape.isValid() ? 0 : -1 });
+    if (!m_tape.isValid()) {
+        ReaderError error;
+        error.kind = ReaderError::Kind::InvalidJson;
+        error.value = m_tape.errorString();
+        warn(std::move(error));
+    }
+}
+
+TextReader::~TextReader()
+{
+    for (const ReaderError &error : std::as_const(m_p->errors))
+        qCWarning(jsonRpcLog) << error.toString();
+    delete m_p;
+}
+
+QStringList TextReader::errorMessages()
+{
+    QStringList res;
+    res.reserve(m_p->errors.size());
+    for (const ReaderError &error : std::as_const(m_p->errors))
+        res.append(error.toString());
+    return res;
+}
+
+bool TextReader::hasErrors() const
+{
+    return !m_p->errors.isEmpty();
+}
+
+void TextReader::clearErrorMessages()
+{
+    m_p->errors.clear();
+}
+
+bool TextReader::failed() const
+{
+    return m_p->parseStatus == ParseStatus::Failed;
+}
+
+bool TextReader::collectErrors() const
+{
+    return m_p->collectErrors;
+}
+
+void TextReader::setCollectErrors(bool collectErrors)
+{
+    m_p->collectErrors = collectErrors;
+}
+
+QByteArray TextReader::currentString() const
+{
+    const qint32 token = currentToken();
+    return (token < 0 ? QByteArray() : m_tape.string(token));
+}
+
+void TextReader::handleBasic(bool &el)
+{
+    if (isCurrent(JsonTape::TokenType::True))
+        el = true;
+    else if (isCurrent(JsonTape::TokenType::False))
+        el = false;
+    else
+        warnMissing(u"bool");
+}
+
+void TextReader::handleBasic(QByteArray &el)
+{
+    if (isCurrent(JsonTape::TokenType::String))
+        el = m_tape.string(currentToken());
+    else
+        warnMissing(u"string");
+}
+
+void TextReader::handleBasic(int &el)
+{
+    if (isCurrent(JsonTape::TokenType::Number))
+        el = m_tape.toInt(currentToken(), el);
+    else
+        warnMissing(u"int");
+}
+
+void TextReader::handleBasic(double &el)
+{
+    if (isCurrent(JsonTape::TokenType::Number))
+        el = m_tape.toDouble(currentToken());
+    else
+        warnMissing(u"double");
+}
+
+void TextReader::handleNullType()
+{
+    if (!isNullOrMissing())
+        warnNonNull();
+}
+
+template<typename Key>
+qint32 TextReader::findField(const Key &fieldName)
+{
+    TextReaderPrivate::ObjectStack &o = m_p->objectsStack.last();
+    if (o.token < 0)
+        return -1;
+    const qint32 count = m_tape.at(o.token).count;
+    qint32 member = o.nextMember;
+    qint32 key = o.nextKey;
+    for (qint32 i = 0; i < count; ++i) {
+        const qint32 value = key + 1;
+        const qint32 nextMember = member + 1;
+        const qint32 nextKey = m_tape.at(value).next;
+        if (m_tape.keyEquals(key, fieldName)) {
+            o.visitedMembers.setBit(member);
+            // like QJsonObject, the last of duplicate members wins, the others are not extra
+            qint32 found = value;
+            if (m_tape.at(o.token).duplicateKeys) {
+                for (qint32 m = 0, k = o.token + 1; m < count; ++m) {
+                    if (m != member && m_tape.keyEquals(k, fieldName)) {
+                        o.visitedMembers.setBit(m);
+                        found = std::max(found, k + 1);
+                    }
+                    k = m_tape.at(k + 1).next;
+                }
+            }
+            if (nextMember < count) {
+                o.nextMember = nextMember;
+                o.nextKey = nextKey;
+            } else {
+                o.nextMember = 0;
+                o.nextKey = o.token + 1;
+            }
+            return found;
+        }
+        if (nextMember < count) {
+            member = nextMember;
+            key = nextKey;
+        } else {
+            member = 0;
+            key = o.token + 1;
+        }
+    }
+    return -1;
+}
+
+bool TextReader::startField(const QString &fieldName)
+{
+    const qint32 token = findField(QByteArrayView(fieldName.toUtf8()));
+    m_p->valuesStack.append(
+            TextReaderPrivate::ValueStack { token, QLatin1StringView(), fieldName });
+    return true;
+}
+
+bool TextReader::startField(const char *fieldName)
+{
+    const qint32 token = findField(QByteArrayView(fieldName));
+    m_p->valuesStack.append(TextReaderPrivate::ValueStack { token, QLatin1StringView(fieldName) });
+    return true;
+}
+
+bool TextReader::startField(const FieldName &fieldName)
+{
+    const qint32 token = findField(fieldName);
+    m_p->valuesStack.append(TextReaderPrivate::ValueStack { token, fieldName.name });
+    return true;
+}
+
+void TextReader::endField(const QString &fieldName)
+{
+    Q_ASSERT(m_p->valuesStack.last().fieldPath == fieldName);
+    Q_UNUSED(fieldName);
+    m_p->valuesStack.removeLast();
+}
+
+void TextReader::endField(const char *fieldName)
+{
+    Q_ASSERT(m_p->valuesStack.last().fieldName == QLatin1StringView(fieldName));
+    Q_UNUSED(fieldName);
+    m_p->valuesStack.removeLast();
+}
+
+void TextReader::endField(const FieldName &fieldName)
+{
+    Q_ASSERT(m_p->valuesStack.last().fieldName == fieldName.name);
+    Q_UNUSED(fieldName);
+    m_p->valuesStack.removeLast();
+}
+
+bool TextReader::startObjectF(const char *type, ObjectOptions options, quintptr)
+{
+    if (m_p->parseStatus != ParseStatus::Normal)
+        return false;
+    const qint32 token = currentToken();
+    if (token < 0) {
+        m_p->parseStatus = ParseStatus::Failed;
+        return false;
+    }
+    TextReaderPrivate::ObjectStack o { type, options };
+    if (m_tape.at(token).type == JsonTape::TokenType::Object) {
+        o.token = token;
+        o.visitedMembers = VisitedMembers(m_tape.at(token).count);
+        o.nextKey = token + 1;
+    }
+    m_p->objectsStack.append(o);
+    return true;
+}
+
+void TextReader::endObjectF(const char *type, ObjectOptions, quintptr)
+{
+    Q_ASSERT(std::strcmp(m_p->objectsStack.last().type, type) == 0);
+    Q_UNUSED(type);
+    m_p->objectsStack.removeLast();
+}
+
+QJsonObject TextReader::getExtraFields() const
+{
+    QJsonObject extraFields;
+    const TextReaderPrivate::ObjectStack &o = m_p->objectsStack.last();
+    if (o.token < 0)
+        return extraFields;
+    const qint32 count = m_tape.at(o.token).count;
+    qint32 key = o.token + 1;
+    for (qint32 i = 0; i < count; ++i) {
+        if (!o.visitedMembers.testBit(i))
+            extraFields.insert(QString::fromUtf8(m_tape.string(key)), m_tape.toJsonValue(key + 1));
+        key = m_tape.at(key + 1).next;
+    }
+    return extraFields;
+}
+
+QJsonValue::Type TextReader::currentType() const
+{
+    const qint32 token = currentToken();
+    if (token < 0)
+        return QJsonValue::Undefined;
+    switch (m_tape.at(token).type) {
+    case JsonTape::TokenType::Null:
+        return QJsonValue::Null;
+    case JsonTape::TokenType::True:
+    case JsonTape::TokenType::False:
+        return QJsonValue::Bool;
+    case JsonTape::TokenType::Number:
+        return QJsonValue::Double;
+    case JsonTape::TokenType::String:
+        return QJsonValue::String;
+    case JsonTape::TokenType::Object:
+        return QJsonValue::Object;
+    case JsonTape::TokenType::Array:
+        return QJsonValue::Array;
+    }
+    return QJsonValue::Undefined;
+}
+
+bool TextReader::hasCurrentField(const FieldName &fieldName) const
+{
+    const qint32 token = currentToken();
+    return token >= 0 && m_tape.findMember(token, fieldName) >= 0;
+}
+
+bool TextReader::currentFieldEquals(const FieldName &fieldName, QLatin1StringView value) const
+{
+    const qint32 token = currentToken();
+    const qint32 member = (token < 0 ? -1 : m_tape.findMember(token, fieldName));
+    return member >= 0 && m_tape.at(member).type == JsonTape::TokenType::String
+            && QByteArrayView(m_tape.string(member)) == QByteArrayView(value);
+}
+
+bool TextReader::failSilently()
+{
+    if (!m_p->suppressErrors && m_p->collectErrors)
+        return false;
+    m_p->parseStatus = ParseStatus::Failed;
+    return true;
+}
+
+void TextReader::warnExtra(const QJsonObject &e)
+{
+    if (e.constBegin() == e.constEnd())
+        return;
+    ReaderError error;
+    error.kind = ReaderError::Kind::Extra;
+    error.value = e;
+    warn(std::move(error));
+}
+
+void TextReader::warnInvalidSize(qint32 size, qint32 expectedSize)
+{
+    if (size == expectedSize)
+        return;
+    ReaderError error;
+    error.kind = ReaderError::Kind::InvalidSize;
+    error.size = size;
+    error.expectedSize = expectedSize;
+    warn(std::move(error));
+}
+
+void TextReader::warnMissing(QStringView s)
+{
+    ReaderError error;
+    error.kind = ReaderError::Kind::Missing;
+    error.expectedType = s;
+    warn(std::move(error));
+}
+
+void TextReader::warnNonNull()
+{
+    // the value is only converted if the error is recorded
+    if (failSilently())
+        return;
+    ReaderError error;
+    error.kind = ReaderError::Kind::NonNull;
+    error.value = currentValue();
+    warn(std::move(error));
+}
+
+// records error at the current path like Reader::warn, the message is built only by
+// errorMessages()
+void TextReader::warn(ReaderError &&error)
+{
+    if (failSilently())
+        return;
+    error.path.reserve(m_p->valuesStack.size());
+    for (const TextReaderPrivate::ValueStack &v : std::as_const(m_p->valuesStack))
+        error.path.append(PathSegment { v.fieldName, v.fieldPath, v.indexPath });
+    m_p->errors.append(std::move(error));
+    m_p->parseStatus = ParseStatus::Failed;
+}
+
+QJsonValue TextReader::currentValue() const
+{
+    const qint32 token = currentToken();
+    return (token < 0 ? QJsonValue(QJsonValue::Undefined) : m_tape.toJsonValue(token));
+}
+
+void TextReader::handleJson(QJsonValue &v)
+{
+    v = currentValue();
+}
+
+void TextReader::handleJson(QJsonObject &v)
+{
+    if (isCurrent(JsonTape::TokenType::Object)) {
+        v = m_tape.toJsonValue(currentToken()).toObject();
+        return;
+    }
+    if (!isNullOrMissing() && !failSilently()) {
+        ReaderError error;
+        error.kind = ReaderError::Kind::NotObject;
+        error.value = currentValue();
+        warn(std::move(error));
+    }
+    v = QJsonObject();
+}
+
+void TextReader::handleJson(QJsonArray &v)
+{
+    if (isCurrent(JsonTape::TokenType::Array)) {
+        v = m_tape.toJsonValue(currentToken()).toArray();
+        return;
+    }
+    if (!isNullOrMissing() && !failSilently()) {
+        ReaderError error;
+        error.kind = ReaderError::Kind::NotArray;
+        error.value = currentValue();
+        warn(std::move(error));
+    }
+    v = QJsonArray();
+}
+
+void TextReader::startArrayF(qint32 &size)
+{
+    size = (isCurrent(JsonTape::TokenType::Array) ? m_tape.at(currentToken()).count : 0);
+}
+
+bool TextReader::startElement(qint32 index)
+{
+    TextReaderPrivate::ValueStack &array = m_p->valuesStack.last();
+    qint32 element = -1;
+    if (isCurrent(JsonTape::TokenType::Array) && index >= 0
+        && index < m_tape.at(array.token).count) {
+        qint32 i = 0;
+        element = array.token + 1;
+        if (array.lastIndex >= 0 && array.lastIndex <= index) {
+            i = array.lastIndex;
+            element = array.lastElement;
+        }
+        for (; i < index; ++i)
+            element = m_tape.at(element).next;
+        array.lastIndex = index;
+        array.lastElement = element;
+    }
+    m_p->valuesStack.append(
+            TextReaderPrivate::ValueStack { element, QLatin1StringView(), QString(), index });
+    return true;
+}
+
+void TextReader::endElement(qint32 index)
+{
+    Q_ASSERT(m_p->valuesStack.last().indexPath == index);
+    Q_UNUSED(index);
+    m_p->valuesStack.removeLast();
+}
+
+void TextReader::endArrayF(qint32 &) { }
+
+QStringList TextReader::currentKeys() const
+{
+    QStringList keys;
+    const TextReaderPrivate::ObjectStack &o = m_p->objectsStack.last();
+    if (o.token < 0)
+        return keys;
+    const qint32 count = m_tape.at(o.token).count;
+    keys.reserve(count);
+    qint32 key = o.token + 1;
+    for (qint32 i = 0; i < count; ++i) {
+        keys.append(QString::fromUtf8(m_tape.string(key)));
+        key = m_tape.at(key + 1).next;
+    }
+    return keys;
+}
+
+bool TextReader::startTuple(qint32 size)
+{
+    const qint32 expected =
+            (isCurrent(JsonTape::TokenType::Array) ? m_tape.at(currentToken()).count : 0);
+    if (size != expected) {
+        warnInvalidSize(size, expected);
+        return false;
+    }
+    return true;
+}
+
+void TextReader::endTuple(qint32) { }
+
+} // namespace QTypedJson
+
+QT_END_NAMESPACE
@@ -0,0 +1,303 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QTYPEDJSONTEXTREADER_P_H
+#define QTYPEDJSONTEXTREADER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtJsonRpc/private/qtypedjson_p.h>
+#include <QtCore/qbytearray.h>
+#include <QtCore/qbytearrayview.h>
+#include <QtCore/qlist.h>
+
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+namespace QTypedJson {
+
+class Q_JSONRPC_EXPORT JsonTape
+{
+public:
+    enum class TokenType : quint8 { Null, True, False, Number, String, Object, Array };
+
+    struct Token
+    {
+        TokenType type = TokenType::Null;
+        bool escaped = false; // string containing escape sequences
+        bool duplicateKeys = false; // object that might have several members with the same name
+        qint32 next = 0; // index of the first token after this value and its children
+        qint32 count = 0; // number of members of an object, or elements of an array
+        quint32 hash = 0; // fieldNameHash of member names without escapes
+        qsizetype begin = 0; // offset of the first byte of the value
+        qsizetype end = 0; // offset one past the last byte of the value
+    };
+
+    JsonTape() = default;
+    explicit JsonTape(const QByteArray &text,
+                      int maxTokenDepth = std::numeric_limits<int>::max());
+
+    bool isValid() const { return m_error.isEmpty(); }
+    QString errorString() const { return m_error; }
+    const QByteArray &text() const { return m_text; }
+    qint32 size() const { return qint32(m_tokens.size()); }
+    const Token &at(qint32 index) const { return m_tokens.at(index); }
+
+    QByteArrayView rawValue(qint32 index) const;
+    QByteArray string(qint32 index) const;
+    bool keyEquals(qint32 keyIndex, QByteArrayView key) const;
+    bool keyEquals(qint32 keyIndex, const FieldName &key) const;
+    double toDouble(qint32 index) const;
+    int toInt(qint32 index, int defaultValue) const;
+    qint32 findMember(qint32 objectIndex, QByteArrayView key) const;
+    qint32 findMember(qint32 objectIndex, const FieldName &key) const;
+    QJsonValue toJsonValue(qint32 index) const;
+
+private:
+    bool parseValue(qsizetype &pos, int depth);
+    bool parseContainer(qsizetype &pos, int depth, TokenType type);
+    bool parseString(qsizetype &pos, int depth, bool isKey = false);
+    bool parseNumber(qsizetype &pos, int depth);
+    bool parseLiteral(qsizetype &pos, int depth, QByteArrayView literal, TokenType type);
+    void addToken(int depth, TokenType type, qsizetype begin, qsizetype end, bool escaped = false,
+                  quint32 hash = 0);
+    qsizetype skipWhitespace(qsizetype pos) const;
+    bool fail(const QString &msg, qsizetype pos);
+    quint32 keyHash(qint32 keyIndex) const;
+
+    QByteArray m_text;
+    QList<Token> m_tokens;
+    QString m_error;
+    int m_maxTokenDepth = std::numeric_limits<int>::max();
+};
+
+class TextReaderPrivate
+{
+public:
+    class ValueStack
+    {
+    public:
+        qint32 token = -1; // -1 for a missing value
+        QLatin1StringView fieldName = {}; // static field names, fieldPath is used otherwise
+        QString fieldPath = {};
+        qint32 indexPath = -1;
+        // last element visited, elements are normally accessed sequentially
+        qint32 lastIndex = -1;
+        qint32 lastElement = -1;
+    };
+
+    class ObjectStack
+    {
+    public:
+        const char *type;
+        ObjectOptions options;
+        qint32 token = -1;
+        VisitedMembers visitedMembers = {};
+        // member after the last one found, fields tend to be sent in declaration order
+        qint32 nextMember = 0;
+        qint32 nextKey = -1;
+    };
+
+    QVarLengthArray<ValueStack, 16> valuesStack = {};
+    QVarLengthArray<ObjectStack, 8> objectsStack = {};
+    ParseStatus parseStatus = ParseStatus::Normal;
+    bool suppressErrors = false; // set while trying the alternatives of a variant
+    bool collectErrors = true;
+    QList<ReaderError> errors = {};
+};
+
+class Q_JSONRPC_EXPORT TextReader
+{
+    Q_DISABLE_COPY_MOVE(TextReader)
+public:
+    TextReader(const QByteArray &json);
+    ~TextReader();
+
+    QStringList errorMessages();
+    bool hasErrors() const;
+    void clearErrorMessages();
+    // decoding stopped on an error, also without error collection
+    bool failed() const;
+
+    // without error collection failures only stop the decoding, which is faster
+    bool collectErrors() const;
+    void setCollectErrors(bool collectErrors);
+
+    // serialization templates
+
+    template<typename T>
+    bool startObject(const char *type, ObjectOptions options, quintptr id, T &)
+    {
+        return this->startObjectF(type, options, id);
+    }
+    template<typename T>
+    void endObject(const char *type, ObjectOptions options, quintptr id, T &obj);
+
+    template<typename T>
+    bool startArray(qint32 &size, T &el)
+    {
+        startArrayF(size);
+        using BaseT = std::decay_t<T>;
+        if constexpr (IsResizableList<BaseT>::value) {
+            el.resize(size);
+        } else {
+            assert(false); // currently unsupported
+        }
+        return true;
+    }
+
+    template<typename T>
+    bool handleOptional(T &el)
+    {
+        if (isNullOrMissing())
+            el.reset();
+        else
+            el.emplace();
+        return bool(el);
+    }
+
+    template<typename T>
+    bool handlePointer(T &el)
+    {
+        if (isNullOrMissing())
+            el = nullptr;
+        else
+            allocatePointer(el);
+        return bool(el);
+    }
+
+    template<typename... T>
+    void handleVariant(std::variant<T...> &el)
+    {
+        readVariant(*this, *m_p, el, std::index_sequence_for<T...>());
+    }
+
+    template<typename T>
+    void handleLazy(T &el)
+    {
+        // keeps only the text of the value, it is tokenized again when decoded
+        if (currentToken() < 0)
+            el.setRawJson(QJsonValue(QJsonValue::Undefined));
+        else
+            el.setRawJsonText(m_tape.rawValue(currentToken()).toByteArray());
+    }
+
+    template<typename T>
+    void handleEnum(T &e)
+    {
+        if (isCurrent(JsonTape::TokenType::Number))
+            e = T(m_tape.toInt(currentToken(), 0));
+        else
+            e = enumFromUtf8<T>(currentString());
+    }
+
+    template<typename T>
+    void endArray(qint32 &size, T &)
+    {
+        this->endArrayF(size);
+    }
+
+    template<typename T>
+    bool startMap(QStringList &keys, T &el)
+    {
+        el.clear();
+        if (isNullOrMissing())
+            return false;
+        if (!this->startObjectF("map", ObjectOption::None, quintptr(&el)))
+            return false;
+        keys = this->currentKeys();
+        return true;
+    }
+
+    template<typename T>
+    void endMap(QStringList &, T &el)
+    {
+        this->endObjectF("map", ObjectOption::None, quintptr(&el));
+    }
+
+    //  serialization callbacks
+    void handleBasic(bool &);
+    void handleBasic(QByteArray &);
+    void handleBasic(int &);
+    void handleBasic(double &);
+    void handleNullType();
+    void handleJson(QJsonValue &v);
+    void handleJson(QJsonObject &v);
+    void handleJson(QJsonArray &v);
+    bool startField(const QString &fieldName);
+    bool startField(const char *fieldName);
+    bool startField(const FieldName &fieldName);
+    void endField(const QString &fieldName);
+    void endField(const char *fieldName);
+    void endField(const FieldName &fieldName);
+    bool startElement(qint32 index);
+    void endElement(qint32 index);
+    bool startTuple(qint32 size);
+    void endTuple(qint32 size);
+
+    // cheap checks on the current value, used to select the alternatives of a variant
+    QJsonValue::Type currentType() const;
+    bool hasCurrentField(const FieldName &fieldName) const;
+    bool currentFieldEquals(const FieldName &fieldName, QLatin1StringView value) const;
+
+private:
+    bool failSilently();
+    void warnExtra(const QJsonObject &e);
+    void warnMissing(QStringView s);
+    void warnNonNull();
+    void warnInvalidSize(qint32 size, qint32 expectedSize);
+    void warn(ReaderError &&error);
+    QJsonObject getExtraFields() const;
+    bool startObjectF(const char *type, ObjectOptions options, quintptr id);
+    void endObjectF(const char *type, ObjectOptions options, quintptr id);
+    void startArrayF(qint32 &size);
+    void endArrayF(qint32 &size);
+    template<typename Key>
+    qint32 findField(const Key &fieldName);
+    QStringList currentKeys() const;
+    QByteArray currentString() const;
+    QJsonValue currentValue() const;
+    qint32 currentToken() const { return m_p->valuesStack.last().token; }
+    bool isCurrent(JsonTape::TokenType type) const
+    {
+        const qint32 token = currentToken();
+        return token >= 0 && m_tape.at(token).type == type;
+    }
+    bool isNullOrMissing() const
+    {
+        return currentToken() < 0 || isCurrent(JsonTape::TokenType::Null);
+    }
+
+    JsonTape m_tape;
+    TextReaderPrivate *m_p;
+};
+
+template<typename T>
+inline void TextReader::endObject(const char *type, ObjectOptions options, quintptr id, T &obj)
+{
+    using BaseT = std::decay_t<T>;
+    QJsonObject extra;
+    if (SetExtraFields<BaseT>::value
+        || (options & (ObjectOption::KeepExtraFields | ObjectOption::WarnExtra)))
+        extra = this->getExtraFields();
+    this->endObjectF(type, options, id);
+    if constexpr (SetExtraFields<BaseT>::value)
+        obj.setExtraFields(extra);
+    else if (extra.constBegin() != extra.constEnd())
+        warnExtra(extra);
+}
+
+} // namespace QTypedJson
+QT_END_NAMESPACE
+
+#endif // QTYPEDJSONTEXTREADER_P_H
@@ -0,0 +1,278 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qtypedjsontextwriter_p.h"
+#include <QtCore/qjsonarray.h>
+#include <QtCore/qjsondocument.h>
+#include <QtCore/qjsonobject.h>
+#include <QtCore/qlocale.h>
+#include <QtCore/qstring.h>
+#include <QtCore/qutf8stringview.h>
+
+#include <cmath>
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+namespace QTypedJson {
+
+/*!
+ * \internal
+ * \class QTypedJson::JsonTextWriter
+ * \brief Walker that writes typed values as compact UTF-8 JSON text
+ *
+ * It produces the same JSON value as JsonBuilder, but appends directly to a QByteArray, so
+ * QByteArray fields are copied as they are instead of being converted to UTF-16 and back.
+ * Object members are written in walk order.
+ */
+
+QByteArray JsonTextWriter::takeText()
+{
+    Q_ASSERT(m_isFirst.isEmpty());
+    QByteArray res = std::move(m_text);
+    m_text = QByteArray();
+    if (res.isEmpty())
+        return QByteArray();
+    return res;
+}
+
+void JsonTextWriter::startValue()
+{
+    if (m_hasPendingKey) {
+        if (!m_isFirst.isEmpty()) {
+            if (!m_isFirst.last())
+                m_text.append(',');
+            m_isFirst.last() = false;
+        }
+        writeString(m_pendingKey);
+        m_text.append(':');
+        m_hasPendingKey = false;
+    } else if (!m_isFirst.isEmpty()) {
+        if (!m_isFirst.last())
+            m_text.append(',');
+        m_isFirst.last() = false;
+    }
+}
+
+void JsonTextWriter::writeString(QByteArrayView utf8)
+{
+    // invalid sequences are replaced like QString::fromUtf8 would do
+    if (!QUtf8StringView(utf8.data(), utf8.size()).isValidUtf8()) {
+        writeString(QString::fromUtf8(utf8).toUtf8());
+        return;
+    }
+    static const char hexDigits[] = "0123456789abcdef";
+    m_text.reserve(m_text.size() + utf8.size() + 2);
+    m_text.append('"');
+    const char *data = utf8.data();
+    const qsizetype size = utf8.size();
+    qsizetype start = 0;
+    for (qsizetype i = 0; i < size; ++i) {
+        const uchar c = uchar(data[i]);
+        if (c >= 0x20 && c != '"' && c != '\\')
+            continue;
+        m_text.append(data + start, i - start);
+        start = i + 1;
+        m_text.append('\\');
+        switch (c) {
+        case '"':
+            m_text.append('"');
+            break;
+        case '\\':
+            m_text.append('\\');
+            break;
+        case '\b':
+            m_text.append('b');
+            break;
+        case '\f':
+            m_text.append('f');
+            break;
+        case '\n':
+            m_text.append('n');
+            break;
+        case '\r':
+            m_text.append('r');
+            break;
+        case '\t':
+            m_text.append('t');
+            break;
+        default:
+            m_text.append("u00");
+            m_text.append(hexDigits[c >> 4]);
+            m_text.append(hexDigits[c & 0xf]);
+            break;
+        }
+    }
+    m_text.append(data + start, size - start);
+    m_text.append('"');
+}
+
+void JsonTextWriter::handleBasic(const bool &v)
+{
+    startValue();
+    m_text.append(v ? "true" : "false");
+}
+
+void JsonTextWriter::handleBasic(const QByteArray &v)
+{
+    startValue();
+    writeString(v);
+}
+
+void JsonTextWriter::handleBasic(const int &v)
+{
+    startValue();
+    m_text.append(QByteArray::number(v));
+}
+
+void JsonTextWriter::handleBasic(const double &v)
+{
+    startValue();
+    // same formatting as QJsonDocument
+    if (!std::isfinite(v)) {
+        m_text.append("null");
+    } else if (v == std::floor(v) && std::abs(v) < (1LL << std::numeric_limits<double>::digits)) {
+        m_text.append(QByteArray::number(qint64(v)));
+    } else {
+        m_text.append(QByteArray::number(v, 'g', QLocale::FloatingPointShortest));
+    }
+}
+
+void JsonTextWriter::handleNullType()
+{
+    startValue();
+    m_text.append("null");
+}
+
+void JsonTextWriter::handleMissingOptional()
+{
+    // missing fields are skipped, missing elements written as null
+    if (m_hasPendingKey)
+        m_hasPendingKey = false;
+    else
+        handleNullType();
+}
+
+void JsonTextWriter::handleJson(QJsonValue &v)
+{
+    switch (v.type()) {
+    case QJsonValue::Undefined:
+        // toJsonValue() returns undefined at the top level, so nothing is written
+        if (m_hasPendingKey || !m_isFirst.isEmpty())
+            handleMissingOptional();
+        break;
+    case QJsonValue::Object:
+        startValue();
+        m_text.append(QJsonDocument(v.toObject()).toJson(QJsonDocument::Compact));
+        break;
+    case QJsonValue::Array:
+        startValue();
+        m_text.append(QJsonDocument(v.toArray()).toJson(QJsonDocument::Compact));
+        break;
+    default: {
+        startValue();
+        const QByteArray array = QJsonDocument(QJsonArray({ v })).toJson(QJsonDocument::Compact);
+        m_text.append(array.mid(1, array.size() - 2));
+        break;
+    }
+    }
+}
+
+void JsonTextWriter::handleJson(QJsonObject &v)
+{
+    startValue();
+    m_text.append(QJsonDocument(v).toJson(QJsonDocument::Compact));
+}
+
+void JsonTextWriter::handleJson(QJsonArray &v)
+{
+    startValue();
+    m_text.append(QJsonDocument(v).toJson(QJsonDocument::Compact));
+}
+
+bool JsonTextWriter::startField(const QString &fieldName)
+{
+    m_pendingKey = fieldName.toUtf8();
+    m_hasPendingKey = true;
+    return true;
+}
+
+bool JsonTextWriter::startField(const char *fieldName)
+{
+    m_pendingKey = QByteArray::fromRawData(fieldName, qstrlen(fieldName));
+    m_hasPendingKey = true;
+    return true;
+}
+
+bool JsonTextWriter::startField(const FieldName &fieldName)
+{
+    m_pendingKey = QByteArray::fromRawData(fieldName.name.data(), fieldName.name.size());
+    m_hasPendingKey = true;
+    return true;
+}
+
+void JsonTextWriter::endField(const QString &)
+{
+    m_hasPendingKey = false;
+}
+
+void JsonTextWriter::endField(const char *)
+{
+    m_hasPendingKey = false;
+}
+
+void JsonTextWriter::endField(const FieldName &)
+{
+    m_hasPendingKey = false;
+}
+
+bool JsonTextWriter::startObjectF(const char *, ObjectOptions, quintptr)
+{
+    startValue();
+    m_text.append('{');
+    m_isFirst.append(true);
+    return true;
+}
+
+void JsonTextWriter::endObjectF(const char *, ObjectOptions, quintptr)
+{
+    Q_ASSERT(!m_isFirst.isEmpty());
+    m_isFirst.removeLast();
+    m_text.append('}');
+}
+
+bool JsonTextWriter::startArrayF(qint32 &)
+{
+    startValue();
+    m_text.append('[');
+    m_isFirst.append(true);
+    return true;
+}
+
+void JsonTextWriter::endArrayF(qint32 &)
+{
+    Q_ASSERT(!m_isFirst.isEmpty());
+    m_isFirst.removeLast();
+    m_text.append(']');
+}
+
+bool JsonTextWriter::startElement(qint32)
+{
+    return true;
+}
+
+void JsonTextWriter::endElement(qint32) { }
+
+bool JsonTextWriter::startTuple(qint32 size)
+{
+    return startArrayF(size);
+}
+
+void JsonTextWriter::endTuple(qint32 size)
+{
+    endArrayF(size);
+}
+
+} // namespace QTypedJson
+
+QT_END_NAMESPACE
@@ -0,0 +1,190 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QTYPEDJSONTEXTWRITER_P_H
+#define QTYPEDJSONTEXTWRITER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API. It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtJsonRpc/private/qtypedjson_p.h>
+#include <QtCore/qbytearray.h>
+#include <QtCore/qlist.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace QTypedJson {
+
+class Q_JSONRPC_EXPORT JsonTextWriter
+{
+    Q_DISABLE_COPY_MOVE(JsonTextWriter)
+public:
+    JsonTextWriter() = default;
+
+    // public api
+    QByteArray takeText();
+
+    // serialization templates
+    template<typename T>
+    bool handleOptional(T &el)
+    {
+        if (el)
+            return true;
+        this->handleMissingOptional();
+        return false;
+    }
+
+    template<typename T>
+    bool handlePointer(T &el)
+    {
+        if (el)
+            return true;
+        this->handleMissingOptional();
+        return false;
+    }
+
+    template<typename T>
+    bool startObject(const char *type, ObjectOptions options, quintptr id, T &)
+    {
+        return this->startObjectF(type, options, id);
+    }
+
+    template<typename T>
+    void endObject(const char *type, ObjectOptions options, quintptr id, T &)
+    {
+        this->endObjectF(type, options, id);
+    }
+
+    template<typename T>
+    bool startArray(qint32 &size, T &el)
+    {
+        using BaseT = std::decay_t<T>;
+        if constexpr (IsResizableList<BaseT>::value) {
+            size = qint32(el.size());
+        } else {
+            assert(false); // currently unsupported
+        }
+        return startArrayF(size);
+    }
+
+    template<typename T>
+    void endArray(qint32 &size, T &)
+    {
+        this->endArrayF(size);
+    }
+
+    template<typename T>
+    bool startMap(QStringList &keys, T &el)
+    {
+        keys = mapKeys(el);
+        return this->startObjectF("map", ObjectOption::None, quintptr(&el));
+    }
+
+    template<typename T>
+    void endMap(QStringList &, T &el)
+    {
+        this->endObjectF("map", ObjectOption::None, quintptr(&el));
+    }
+
+    template<typename T>
+    void handleVariant(T &el)
+    {
+        std::visit([this](auto &v) { doWalk(*this, v); }, el);
+    }
+
+    template<typename T>
+    void handleLazy(T &el)
+    {
+        // undecoded text is copied as it is
+        if (el.hasRawJsonText()) {
+            startValue();
+            m_text.append(el.rawJsonText());
+        } else if (el.hasRawJson()) {
+            QJsonValue v = el.rawJsonValue();
+            this->handleJson(v);
+        } else {
+            doWalk(*this, el.value());
+        }
+    }
+
+    template<typename T>
+    void handleEnum(T &el)
+    {
+        writeEnum(*this, el);
+    }
+
+    // serialization callbacks
+    void handleBasic(const bool &v);
+    void handleBasic(const QByteArray &v);
+    void handleBasic(const int &v);
+    void handleBasic(const double &v);
+    void handleNullType();
+    void handleJson(QJsonValue &v);
+    void handleJson(QJsonObject &v);
+    void handleJson(QJsonArray &v);
+    bool startField(const QString &fieldName);
+    bool startField(const char *fieldName);
+    bool startField(const FieldName &fieldName);
+    void endField(const QString &);
+    void endField(const char *);
+    void endField(const FieldName &);
+    bool startElement(qint32 index);
+    void endElement(qint32);
+    bool startTuple(qint32 size);
+    void endTuple(qint32 size);
+
+private:
+    void handleMissingOptional();
+    bool startObjectF(const char *, ObjectOptions, quintptr);
+    void endObjectF(const char *, ObjectOptions, quintptr);
+    bool startArrayF(qint32 &);
+    void endArrayF(qint32 &);
+    void startValue();
+    void writeString(QByteArrayView utf8);
+
+    QByteArray m_text;
+    QByteArray m_pendingKey; // name of the field whose value was not written yet
+    bool m_hasPendingKey = false;
+    QList<bool> m_isFirst; // for each open object or array, if no member was written yet
+};
+
+/*!
+ * \internal
+ * Serializes params directly to compact UTF-8 JSON text, representing the same value as
+ * toJsonValue(params...) without building QJsonValues or converting strings to UTF-16.
+ * Returns a null QByteArray when nothing is written (toJsonValue would return undefined).
+ */
+template<typename... Params>
+QByteArray toJsonText(const Params &...params)
+{
+    if constexpr (sizeof...(Params) == 0)
+        return QByteArray();
+
+    JsonTextWriter w;
+    if constexpr (sizeof...(Params) == 1) {
+        (doWalk(w, const_cast<Params &>(params)), ...);
+    } else if (w.startTuple(sizeof...(Params))) {
+        qint32 i = 0;
+        auto writeElement = [&i, &w](auto &el) {
+            w.startElement(i);
+            doWalk(w, el);
+            w.endElement(i++);
+        };
+        (writeElement(const_cast<Params &>(params)), ...);
+        w.endTuple(sizeof...(Params));
+    }
+    return w.takeText();
+}
+
+} // namespace QTypedJson
+QT_END_NAMESPACE
+
+#endif // QTYPEDJSONTEXTWRITER_P_H
@@ -11,6 +11,9 @@ The language server protocol is largely generated from the
 specification
   src/languageserver/3rdparty/specification.md
 by the src/languageserver/generate.ts script.
+The few LSP 3.17 additions that are needed (like the negotiation of the
+position encoding, or pull diagnostics) are added by the script itself,
+see updatedStructMembers, specificationAdditions and protocolAdditions.
 Use
   npm install
   tsc --downlevelIteration --strictNullChecks generate.ts && node generate.js
@@ -83,11 +86,6 @@ import * as ts from "typescript";
 
 var globalBaseClass = "";
 
-function stringLiteral(text: string)
-{
-    return "QLatin1String(\"" + text + "\")";
-}
-
 var builtinTypes = {
     "string" : "QByteArray",
     "number" : "int",
@@ -131,6 +129,204 @@ const patchedStructMembers = new Map<string, Map<string, string>>([
     ]
 ]);
 
+// large members that handlers seldom need, decoded only when they are accessed
+const lazyStructMembers = new Map<string, Set<string>>([
+    [ "InitializeParams", new Set<string>([ "capabilities" ]) ],
+    [ "CodeActionParams", new Set<string>([ "context" ]) ],
+]);
+
+// containers used instead of QList for arrays (or of QJsonObject for index signatures like
+// { [uri: DocumentUri]: TextEdit[]; }), for example "std::vector" or "QMap".
+// Changing the container of an existing member breaks the code using it, so only the members
+// added by this script (see specificationAdditions) set one.
+const relatedDocumentsContainer = new Map<string, string>([ [ "relatedDocuments", "QMap" ] ]);
+const memberContainers = new Map<string, Map<string, string>>([
+    [ "RelatedFullDocumentDiagnosticReport", relatedDocumentsContainer ],
+    [ "RelatedUnchangedDocumentDiagnosticReport", relatedDocumentsContainer ],
+    [ "DocumentDiagnosticReportPartialResult", relatedDocumentsContainer ],
+]);
+
+// LSP 3.17 members missing in the bundled 3.16 specification, added to the parsed interfaces
+// (replacing a member with the same name). New types they use are in specificationAdditions.
+const updatedStructMembers = new Map<string, Member[]>([
+    [
+        "ClientCapabilities",
+        [ { name : "general", type : "GeneralClientCapabilities", isOptional : true } ]
+    ],
+    [
+        "TextDocumentClientCapabilities",
+        [ { name : "diagnostic", type : "DiagnosticClientCapabilities", isOptional : true } ]
+    ],
+    [
+        "ServerCapabilities",
+        [
+            // a PositionEncodingKind: "utf-8", "utf-16" or "utf-32", the only one before 3.17
+            { name : "positionEncoding", type : "string", isOptional : true },
+            {
+                name : "diagnosticProvider",
+                type : "DiagnosticOptions | DiagnosticRegistrationOptions",
+                isOptional : true
+            }
+        ]
+    ],
+]);
+
+// LSP 3.17 types missing in the bundled 3.16 specification
+const specificationAdditions = `
+export interface GeneralClientCapabilities {
+	regularExpressions?: RegularExpressionsClientCapabilities;
+	markdown?: MarkdownClientCapabilities;
+	// PositionEncodingKind values, in decreasing order of preference
+	positionEncodings?: string[];
+	// the other members (like staleRequestSupport) are kept in extraFields
+	[key: string]: any;
+}
+
+export interface DiagnosticClientCapabilities {
+	dynamicRegistration?: boolean;
+	relatedDocumentSupport?: boolean;
+}
+
+export interface DiagnosticOptions extends WorkDoneProgressOptions {
+	identifier?: string;
+	interFileDependencies: boolean;
+	workspaceDiagnostics: boolean;
+}
+
+export interface DiagnosticRegistrationOptions extends TextDocumentRegistrationOptions,
+	DiagnosticOptions, StaticRegistrationOptions {
+}
+
+export interface DocumentDiagnosticParams extends WorkDoneProgressParams,
+	PartialResultParams {
+	textDocument: TextDocumentIdentifier;
+	identifier?: string;
+	previousResultId?: string;
+}
+
+// the kind (a DocumentDiagnosticReportKind) tells the reports apart
+export interface FullDocumentDiagnosticReport {
+	kind: 'full';
+	resultId?: string;
+	items: Diagnostic[];
+}
+
+export interface UnchangedDocumentDiagnosticReport {
+	kind: 'unchanged';
+	resultId: string;
+}
+
+export interface RelatedFullDocumentDiagnosticReport extends FullDocumentDiagnosticReport {
+	relatedDocuments?: {
+		[uri: string]: FullDocumentDiagnosticReport | UnchangedDocumentDiagnosticReport;
+	};
+}
+
+export interface RelatedUnchangedDocumentDiagnosticReport
+	extends UnchangedDocumentDiagnosticReport {
+	relatedDocuments?: {
+		[uri: string]: FullDocumentDiagnosticReport | UnchangedDocumentDiagnosticReport;
+	};
+}
+
+export interface DocumentDiagnosticReportPartialResult {
+	relatedDocuments: {
+		[uri: string]: FullDocumentDiagnosticReport | UnchangedDocumentDiagnosticReport;
+	};
+}
+
+export interface PreviousResultId {
+	uri: DocumentUri;
+	value: string;
+}
+
+export interface WorkspaceDiagnosticParams extends WorkDoneProgressParams,
+	PartialResultParams {
+	identifier?: string;
+	previousResultIds: PreviousResultId[];
+}
+
+export interface WorkspaceFullDocumentDiagnosticReport extends FullDocumentDiagnosticReport {
+	uri: DocumentUri;
+	version: integer | null;
+}
+
+export interface WorkspaceUnchangedDocumentDiagnosticReport
+	extends UnchangedDocumentDiagnosticReport {
+	uri: DocumentUri;
+	version: integer | null;
+}
+
+export interface WorkspaceDiagnosticReport {
+	items: (WorkspaceFullDocumentDiagnosticReport
+		| WorkspaceUnchangedDocumentDiagnosticReport)[];
+}
+
+export interface WorkspaceDiagnosticReportPartialResult {
+	items: (WorkspaceFullDocumentDiagnosticReport
+		| WorkspaceUnchangedDocumentDiagnosticReport)[];
+}
+
+export interface DiagnosticWorkspaceClientCapabilities {
+	refreshSupport?: boolean;
+}
+`;
+
+// LSP 3.17 requests missing in the bundled 3.16 specification, in the format of protocol.json.
+// They are appended to the parsed protocol.
+const protocolAdditions = {
+    "pullDiagnostics" : {
+        "ServerCapability" : {
+            propertyPath : "diagnosticProvider",
+            propertyType : "DiagnosticOptions | DiagnosticRegistrationOptions"
+        },
+        "ClientCapability" : {
+            propertyPath : "textDocument.diagnostic",
+            propertyType : "DiagnosticClientCapabilities"
+        },
+        "Request" : {
+            method : "textDocument/diagnostic",
+            params : "DocumentDiagnosticParams",
+            response : {
+                result : "RelatedFullDocumentDiagnosticReport"
+                        + " | RelatedUnchangedDocumentDiagnosticReport",
+                partialResult : "DocumentDiagnosticReportPartialResult"
+            }
+        }
+    },
+    "workspaceDiagnostics" : {
+        "Request" : {
+            method : "workspace/diagnostic",
+            params : "WorkspaceDiagnosticParams",
+            response : {
+                result : "WorkspaceDiagnosticReport",
+                partialResult : "WorkspaceDiagnosticReportPartialResult"
+            }
+        }
+    },
+    "diagnosticRefresh" : {
+        "ClientCapability" : {
+            propertyPath : "workspace.diagnostics",
+            propertyType : "DiagnosticWorkspaceClientCapabilities"
+        },
+        "Request" : {
+            method : "workspace/diagnostic/refresh",
+            params : "null",
+            response : { result : "null" }
+        }
+    }
+};
+
+function withContainer(type: string, tsType: string, container: string): string
+{
+    // optional members are "T | undefined" with strictNullChecks
+    let indexSignature = tsType.replace(/ \| undefined$/, "")
+                                 .match(/^\{\s*\[\w+:\s*\w+\]:\s*(.+?);?\s*\}$/);
+    if (indexSignature)
+        return container + "<QByteArray, " + effectiveType(indexSignature[1]) + ">";
+    return type.replace(/^QList</, container + "<");
+}
+
 var specialEnums = { "ErrorCodes" : null, "InitializeError" : "InitializeErrorCode" }
 
 var postStruct = {
@@ -143,9 +339,10 @@ public:
     QByteArray text = {};
 
     template <typename W> void walk(W &w) {
-        field(w, "range", range);
-        field(w, "rangeLength", rangeLength);
-        field(w, "text", text);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "range", "rangeLength", "text" };
+        field(w, fieldNames[0], range);
+        field(w, fieldNames[1], rangeLength);
+        field(w, fieldNames[2], text);
     }
 };
 
@@ -175,8 +372,9 @@ public:
     std::unique_ptr<SelectionRange> parent;
 
     template <typename W> void walk(W &w) {
-        field(w, "range", range);
-        field(w, "parent", parent);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "range", "parent" };
+        field(w, fieldNames[0], range);
+        field(w, fieldNames[1], parent);
     }
 };
 
@@ -187,8 +385,9 @@ public:
     QByteArray placeholder = {};
 
     template <typename W> void walk(W &w) {
-        field(w, "range", range);
-        field(w, "placeholder", placeholder);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "range", "placeholder" };
+        field(w, fieldNames[0], range);
+        field(w, fieldNames[1], placeholder);
     }
 };
 
@@ -198,7 +397,8 @@ public:
     bool defaultBehavior = {};
 
     template <typename W> void walk(W &w) {
-        field(w, "defaultBehavior", defaultBehavior);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "defaultBehavior" };
+        field(w, fieldNames[0], defaultBehavior);
     }
 };
 
@@ -340,63 +540,34 @@ function generateEnum(e: Enum)
     return output + "\n};\nQ_ENUM_NS(" + e.name + ")\n\n";
 }
 
-function generateStringAccessors(e: Enum)
+function generateEnumTraits(e: Enum)
 {
-    let output: string = "";
-    let nameValIdentical: boolean = true;
-    let nameValSimilar: boolean = true;
-    e.members.forEach(function(m) {
-        if (m.name !== m.value) {
-            nameValIdentical = false;
-            if (m.name.toUpperCase() !== m.value.toUpperCase())
-                nameValSimilar = false;
-        }
-    });
-    if (!nameValIdentical) {
-        output = "template<>\n";
-        output += "inline QString enumToString<QLspSpecification::" + e.name
-                + ">(QLspSpecification::" + e.name + " value)\n";
-        output += "{\n";
-        output += "    switch (value) {\n"
-        output += e.members
-                          .map(function(member) {
-                              return "    case QLspSpecification::" + e.name + "::" + member.name
-                                      + ": return " + stringLiteral(member.value) + ";\n";
-                          })
+    let enumType: string = "QLspSpecification::" + e.name;
+    let output: string = "template<>\n";
+    output += "struct EnumTraits<" + enumType + ">\n";
+    output += "{\n";
+    if (e.type == "number") {
+        output += "    static constexpr bool isNumber = true;\n";
+    } else {
+        // string enums use the values 0, 1, 2,... so names can be indexed by value
+        output += "    static constexpr bool isNumber = false;\n";
+        output += "    static constexpr QByteArrayView names[] = {\n";
+        output += e.members.map(function(member) { return "        \"" + member.value + "\",\n"; })
                           .join("");
-        output += "    default: return QString::number(int(value));\n";
-        output += "    }\n"
-        output += "}\n\n";
-    }
-    if (!nameValSimilar) {
-        output += "template<>\n";
-        output += "inline QLspSpecification::" + e.name
-                + " enumFromString<QLspSpecification::" + e.name + ">(const QString &string)\n";
-        output += "{\n";
-        output += e.members
+        output += "    };\n";
+        output += "    static constexpr EnumEntry<" + enumType + "> sortedEntries[] = {\n";
+        output += e.members.slice()
+                          .sort(function(a, b) {
+                              return a.value < b.value ? -1 : (a.value > b.value ? 1 : 0);
+                          })
                           .map(function(member) {
-                              return "    if (string.compare(" + stringLiteral(member.value)
-                                      + ", Qt::CaseInsensitive) == 0)\n" +
-                                      "        return QLspSpecification::" + e.name
-                                      + "::" + member.name + ";\n";
+                              return "        { \"" + member.value + "\", " + enumType + "::"
+                                      + member.name + " },\n";
                           })
-                          .join("    else ");
-        output += "    return QLspSpecification::" + e.name + "{};\n";
-        output += "}\n\n";
+                          .join("");
+        output += "    };\n";
     }
-    return output;
-}
-
-function generateNumberAccessors(e: Enum)
-{
-    let output: string = "";
-    output += "template<>\n";
-    output += "inline QString enumToString<QLspSpecification::" + e.name
-            + ">(QLspSpecification::" + e.name + " value)\n";
-    output += "{\n";
-    output += "    return enumToIntString<QLspSpecification::" + e.name + ">(value);";
-    output += "}\n\n";
-
+    output += "};\n\n";
     return output;
 }
 
@@ -412,7 +583,7 @@ function generateClass(struct: Struct, indent: string)
 {
     let output: string = indent + "class Q_LANGUAGESERVER_EXPORT " + struct.name;
     if (struct.extends.length != 0)
-        output += " : public " + struct.extends;
+        output += " : public " + struct.extends.split(", ").join(", public ");
     output += "\n";
 
     var innerIndent = indent + "    ";
@@ -438,8 +609,15 @@ function generateClass(struct: Struct, indent: string)
                               type = effectiveType(t);
                               if (isNullableVariant(t))
                                   defaultValue = "nullptr";
+                              let container = memberContainers.get(struct.name)?.get(member.name);
+                              if (container)
+                                  type = withContainer(type, t, container);
                           }
                           let upperCaseName: string = upperCase(member.name);
+                          if (lazyStructMembers.get(struct.name)?.has(member.name)) {
+                              type = "QTypedJson::Lazy<" + type + ">";
+                              defaultValue = "{}";
+                          }
                           var rType: string = type;
                           if (member.isOptional)
                               rType = "std::optional<" + type + ">";
@@ -451,6 +629,15 @@ function generateClass(struct: Struct, indent: string)
     if (struct.hasExtraMembers) {
         output += innerIndent + "QJsonObject extraFields;\n"
     }
+    // a required member with a single literal value (like kind: 'create') identifies the type
+    // when it is an alternative of a variant
+    let discriminator = struct.members.find(function(member: Member) {
+        return !member.isOptional && typeof member.type === "string"
+                && /^"[^"]+"$/.test(<string>member.type);
+    });
+    if (discriminator)
+        output += innerIndent + "static constexpr QTypedJson::Discriminator jsonDiscriminator = { \""
+                + discriminator.name + "\", " + <string>discriminator.type + " };\n";
 
     output += "\n"
     if (struct.extends.length != 0 || struct.members.length != 0)
@@ -459,18 +646,26 @@ function generateClass(struct: Struct, indent: string)
         if (struct.extends.length != 0)
         struct.extends.split(", ").forEach(function(
                 parentName) { output += innerIndent + "    " + parentName + "::walk(w);\n"; })
-        if (struct.members.length != 0)
-        output += struct.members
-                          .map(function(member: Member) {
-                              return innerIndent
-                                      + `    field(w, "${member.name}", ${member.name});\n`;
-                          })
-                          .join("")
+        if (struct.members.length != 0) {
+            // field names and their hashes are computed once per type, at compile time
+            output += innerIndent + "    static constexpr QTypedJson::FieldName fieldNames[] = { "
+                    + struct.members.map((member: Member) => `"${member.name}"`).join(", ")
+                    + " };\n";
+            output += struct.members
+                              .map(function(member: Member, index: number) {
+                                  return innerIndent
+                                          + `    field(w, fieldNames[${index}], ${member.name});\n`;
+                              })
+                              .join("")
+        }
         output += innerIndent + "}\n";
 
         if (struct.hasExtraMembers) {
             output += innerIndent
                     + "template <typename W> void walkExtra(W &w) { w.handleExtras(extraFields); }\n"
+            // the readers store the members without a field there
+            output += innerIndent
+                    + "void setExtraFields(const QJsonObject &e) { extraFields = e; }\n"
         }
     output += indent + "};\n\n";
     let post = postStruct[struct.name];
@@ -545,12 +740,7 @@ function generate(fileNames: string[], options: ts.CompilerOptions): GeneratedTy
     enums.forEach(function(e) { typeDeclarations += generateEnum(e); });
     structs.forEach(doGenerateDeclarations);
 
-    enums.forEach(function(e) {
-        if (e.type == "string")
-            enumStringConversions += generateStringAccessors(e);
-        else
-            enumStringConversions += generateNumberAccessors(e);
-    });
+    enums.forEach(function(e) { enumStringConversions += generateEnumTraits(e); });
 
     return { typeDeclarations : typeDeclarations, enumStringConversions : enumStringConversions };
 
@@ -696,6 +886,13 @@ function generate(fileNames: string[], options: ts.CompilerOptions): GeneratedTy
                 result.hasExtraMembers = true;
             }
         });
+        updatedStructMembers.get(result.name)?.forEach(function(updated: Member) {
+            let i = result.members.findIndex((member: Member) => member.name == updated.name);
+            if (i == -1)
+                result.members.push(updated);
+            else
+                result.members[i] = updated;
+        });
 
         return result;
     }
@@ -1123,7 +1320,6 @@ function generateProtocol(extractedInfo, structuredSequence): GeneratedProtocol
                     responseType = `LSPPartialResponse<${resultType}, ${partialResultType}>`;
                     responses.push(`using ${rName}ResponseType = LSPPartialResponse<${
                             rName}ResultType,${rName}PartialResultType>;`);
-                    // skip client implementation for now
                 } else {
                     responseType = `LSPResponse<${resultType}>`;
                     responses.push(`using ${rName}ResponseType = LSPResponse<${rName}ResultType>;`);
@@ -1146,13 +1342,33 @@ function generateProtocol(extractedInfo, structuredSequence): GeneratedProtocol
             decodeAndCall<${resultType}>(response.data, responseHandler, errorHandler);
     }, params);
 }`);
+                // overload that gives back the partial results, when they can be aggregated
+                let partialResultType = (req.response.partialResult
+                                                 ? effectiveType(req.response.partialResult)
+                                                 : "");
+                if (partialResultType.startsWith("QList<")
+                    && (resultType == partialResultType
+                        || resultType == `std::variant<${partialResultType}, std::nullptr_t>`)) {
+                    sendDeclarations.push(`void request${rName}(const ${
+                            paramsType}&, std::function<void(const ${
+                            partialResultType} &)> partialResultHandler, ${
+                            responseHandlerType} responseHandler, ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);`);
+                    sendImplementations.push(`void ProtocolGen::request${rName}(const ${
+                            paramsType} &params, std::function<void(const ${
+                            partialResultType} &)> partialResultHandler, ${
+                            responseHandlerType} responseHandler, ResponseErrorHandler errorHandler)
+{
+    requestWithPartialResults<${resultType}, ${partialResultType}>(QByteArray(Requests::${
+                            rName}Method), params, std::move(partialResultHandler), std::move(responseHandler), std::move(errorHandler));
+}`);
+                }
                 registerDeclarations.push(`void register${
-                        rName}RequestHandler(const std::function<void(const QByteArray &, const ${
-                        paramsType} &, ${responseType} &&)> &handler);`);
+                        rName}RequestHandler(const std::function<void(const QByteArray &, ${
+                        paramsType}, ${responseType} &&)> &handler);`);
                 registerImplementations.push(`
 void ProtocolGen::register${
-                        rName}RequestHandler(const std::function<void(const QByteArray &, const ${
-                        paramsType} &, ${responseType} &&)> &handler)
+                        rName}RequestHandler(const std::function<void(const QByteArray &, ${
+                        paramsType}, ${responseType} &&)> &handler)
 {
     typedRpc()->registerRequestHandler<QLspSpecification::Requests::${
                         rName}ParamsType, QLspSpecification::Responses::${rName}ResponseType>(
@@ -1192,12 +1408,12 @@ protocol->register${nName}NotificationHandler(
                         nName}Notification(const QLspSpecification::Notifications::${
                         nName}ParamsType &);`)
                 registerDeclarations.push(`void register${
-                        nName}NotificationHandler(const std::function<void(const QByteArray &, const ${
-                        paramsType} &)> &handler);`);
+                        nName}NotificationHandler(const std::function<void(const QByteArray &, ${
+                        paramsType})> &handler);`);
                 registerImplementations.push(`
 void ProtocolGen::register${
-                        nName}NotificationHandler(const std::function<void(const QByteArray &, const ${
-                        paramsType} &)> &handler)
+                        nName}NotificationHandler(const std::function<void(const QByteArray &, ${
+                        paramsType})> &handler)
 {
     typedRpc()->registerNotificationHandler<QLspSpecification::Notifications::${nName}ParamsType>(
         QByteArray(QLspSpecification::Notifications::${nName}Method), handler);
@@ -1265,9 +1481,12 @@ let protoData = extractProto(contents!.split("\n"));
 ts.sys.writeFile("protocolRaw.json", JSON.stringify(protoData, null, 2));
 let protoStructs =
         parseStructuredProtocol(protoData["structured"], protoData["structuredSequence"]);
+Object.assign(protoStructs, protocolAdditions);
+let protoSequence = protoData["structuredSequence"].concat(Object.keys(protocolAdditions));
 ts.sys.writeFile("protocol.json", JSON.stringify(protoStructs, null, 2));
-let proto: GeneratedProtocol = generateProtocol(protoStructs, protoData["structuredSequence"]);
+let proto: GeneratedProtocol = generateProtocol(protoStructs, protoSequence);
 
+output += specificationAdditions;
 ts.sys.writeFile("specification.ts", output);
 
 let result: GeneratedTypes = generate([ "specification.ts" ],
@@ -1296,8 +1515,10 @@ ts.sys.writeFile("qlanguageserverspectypes_p.h", `${license}
 #include <QtLanguageServer/qtlanguageserverglobal.h>
 #include <QtLanguageServer/private/qlanguageserverprespectypes_p.h>
 #include <QtJsonRpc/private/qtypedjson_p.h>
+#include <QtJsonRpc/private/qtypedjsonlazy_p.h>
 #include <QtCore/QByteArray>
 #include <QtCore/QList>
+#include <QtCore/QMap>
 #include <QtCore/QJsonValue>
 #include <QtCore/QJsonObject>
 #include <QtCore/QString>
@@ -1351,21 +1572,26 @@ ${result.typeDeclarations}
 namespace QTypedJson {
 
 template<>
-inline QString enumToString<QLspSpecification::TraceValue>(QLspSpecification::TraceValue value)
+struct EnumTraits<QLspSpecification::TraceValue>
 {
-    switch (value) {
-    case QLspSpecification::TraceValue::Off: return QLatin1String("off");
-    case QLspSpecification::TraceValue::Messages: return QLatin1String("messages");
-    case QLspSpecification::TraceValue::Verbose: return QLatin1String("verbose");
-    }
-    return QString();
-}
+    static constexpr bool isNumber = false;
+    static constexpr QByteArrayView names[] = {
+        "off",
+        "messages",
+        "verbose",
+    };
+    static constexpr EnumEntry<QLspSpecification::TraceValue> sortedEntries[] = {
+        { "messages", QLspSpecification::TraceValue::Messages },
+        { "off", QLspSpecification::TraceValue::Off },
+        { "verbose", QLspSpecification::TraceValue::Verbose },
+    };
+};
 
 template<>
-inline QString enumToString<QLspSpecification::ErrorCodes>(QLspSpecification::ErrorCodes value)
+struct EnumTraits<QLspSpecification::ErrorCodes>
 {
-    return enumToIntString<QLspSpecification::ErrorCodes>(value);
-}
+    static constexpr bool isNumber = true;
+};
 
 ${result.enumStringConversions}
 } // namespace QTypedJson
@@ -38,6 +38,11 @@ void ProtocolBase::registerMethods(QJsonRpc::TypedRpc *typedRpc)
                 handleUndispatchedNotification(method, notif.params);
             });
     typedRpc->setDefaultMessageHandler(defaultHandler); // typedRpc gets ownership
+    typedRpc->registerNotificationHandler<ProgressNotificationParams<QJsonValue>>(
+            QByteArray(Notifications::ProgressMethod),
+            [this](const QByteArray &, ProgressNotificationParams<QJsonValue> params) {
+                handleProgressNotification(std::move(params));
+            });
     typedRpc->setInvalidResponseHandler([this](const QJsonRpcProtocol::Response &response) {
         handleResponseError(ResponseError { response.errorCode.toInt(),
                                             response.errorMessage.toUtf8(), response.data });
@@ -123,6 +128,49 @@ void ProtocolBase::registerUndispatchedNotificationHandler(
     d->undispachedNotificationHandler = handler;
 }
 
+void ProtocolBase::registerPartialResultHandler(const ProgressToken &token,
+                                                const PartialResultHandler &handler)
+{
+    Q_D(ProtocolBase);
+    Q_ASSERT(!d->partialResultHandlers.contains(token));
+    d->partialResultHandlers.insert(token, handler);
+}
+
+void ProtocolBase::unregisterPartialResultHandler(const ProgressToken &token)
+{
+    Q_D(ProtocolBase);
+    d->partialResultHandlers.remove(token);
+}
+
+void ProtocolBase::registerProgressNotificationHandler(const ProgressNotificationHandler &handler)
+{
+    Q_D(ProtocolBase);
+    Q_ASSERT(!d->progressHandler || !handler);
+    d->progressHandler = handler;
+}
+
+ProgressToken ProtocolBase::newProgressToken()
+{
+    Q_D(ProtocolBase);
+    return QByteArray("progress-") + QByteArray::number(++d->lastProgressToken);
+}
+
+void ProtocolBase::handleProgressNotification(ProgressNotificationParams<QJsonValue> &&params)
+{
+    Q_D(ProtocolBase);
+    auto it = d->partialResultHandlers.constFind(params.token);
+    if (it != d->partialResultHandlers.constEnd()) {
+        // the handler might unregister itself
+        const PartialResultHandler handler = it.value();
+        handler(params.value);
+    } else if (d->progressHandler) {
+        d->progressHandler(QByteArray(Notifications::ProgressMethod), std::move(params));
+    } else {
+        handleUndispatchedNotification(QByteArray(Notifications::ProgressMethod),
+                                       QTypedJson::toJsonValue(params));
+    }
+}
+
 void ProtocolBase::handleUndispatchedRequest(const QJsonRpc::IdType &id, const QByteArray &method,
                                              const QLspSpecification::RequestParams &params,
                                              QJsonRpc::TypedResponse &&response)
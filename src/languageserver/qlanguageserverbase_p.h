@@ -24,6 +24,8 @@
 
 #include <functional>
 #include <memory>
+#include <type_traits>
+#include <variant>
 
 QT_BEGIN_NAMESPACE
 
@@ -43,6 +45,9 @@ public:
     using GenericNotificationHandler =
             std::function<void(const QByteArray &, const QLspSpecification::NotificationParams &)>;
     using ResponseErrorHandler = std::function<void(const QLspSpecification::ResponseError &)>;
+    using PartialResultHandler = std::function<void(const QJsonValue &)>;
+    using ProgressNotificationHandler =
+            std::function<void(const QByteArray &, ProgressNotificationParams<QJsonValue>)>;
 
     // generated, defined in qlanguageservergen.cpp
     static QByteArray requestMethodToBaseCppName(const QByteArray &);
@@ -61,6 +66,16 @@ public:
     void registerUndispatchedRequestHandler(const GenericRequestHandler &handler);
     void registerUndispatchedNotificationHandler(const GenericNotificationHandler &handler);
 
+    // $/progress notifications with the token are passed to the handler, until it is
+    // unregistered
+    void registerPartialResultHandler(const ProgressToken &token,
+                                      const PartialResultHandler &handler);
+    void unregisterPartialResultHandler(const ProgressToken &token);
+    // $/progress notifications with the other tokens, they are undispatched without it
+    void registerProgressNotificationHandler(const ProgressNotificationHandler &handler);
+    // a token for partial results or work done progress, unique for this protocol
+    ProgressToken newProgressToken();
+
     void handleResponseError(const ResponseError &err);
     void handleUndispatchedRequest(const QJsonRpc::IdType &id, const QByteArray &method,
                                    const QLspSpecification::RequestParams &params,
@@ -75,7 +90,14 @@ protected:
     ProtocolBase(std::unique_ptr<ProtocolBasePrivate> &&priv);
     QJsonRpcTransport *transport();
 
+    template<typename Result, typename PartialResult, typename Params>
+    void requestWithPartialResults(const QByteArray &method, const Params &params,
+                                   std::function<void(const PartialResult &)> partialResultHandler,
+                                   std::function<void(const Result &)> responseHandler,
+                                   ResponseErrorHandler errorHandler);
+
 private:
+    void handleProgressNotification(ProgressNotificationParams<QJsonValue> &&params);
     void registerMethods(QJsonRpc::TypedRpc *);
     Q_DECLARE_PRIVATE(ProtocolBase)
 };
@@ -105,6 +127,82 @@ void decodeAndCall(QJsonValue value, F funct,
     }
 }
 
+/*!
+ * \internal
+ * Appends the result of the final response to the partial results received before it.
+ * Result is either PartialResult or std::variant<PartialResult, std::nullptr_t>, a null
+ * result stays null only if there were no partial results.
+ */
+template<typename Result, typename PartialResult>
+Result aggregatePartialResults(PartialResult &&partialResults, Result &&result)
+{
+    if constexpr (std::is_same_v<Result, PartialResult>) {
+        if (partialResults.isEmpty())
+            return std::move(result);
+        partialResults.append(std::move(result));
+        return std::move(partialResults);
+    } else {
+        if (PartialResult *last = std::get_if<PartialResult>(&result)) {
+            if (partialResults.isEmpty())
+                return std::move(result);
+            partialResults.append(std::move(*last));
+        } else if (partialResults.isEmpty()) {
+            return std::move(result);
+        }
+        return Result(std::move(partialResults));
+    }
+}
+
+/*!
+ * \internal
+ * Sends a request asking for partial results, using params.partialResultToken or a new token.
+ * Each partial result is passed to partialResultHandler as it arrives, and responseHandler
+ * gets all the partial results followed by the result of the final response.
+ */
+template<typename Result, typename PartialResult, typename Params>
+void ProtocolBase::requestWithPartialResults(
+        const QByteArray &method, const Params &params,
+        std::function<void(const PartialResult &)> partialResultHandler,
+        std::function<void(const Result &)> responseHandler, ResponseErrorHandler errorHandler)
+{
+    Params p = params;
+    if (!p.partialResultToken)
+        p.partialResultToken = newProgressToken();
+    const ProgressToken token = *p.partialResultToken;
+    auto partialResults = std::make_shared<PartialResult>();
+    registerPartialResultHandler(
+            token,
+            [partialResults, partialResultHandler = std::move(partialResultHandler),
+             errorHandler](const QJsonValue &value) {
+                decodeAndCall<PartialResult>(
+                        value,
+                        [&partialResults, &partialResultHandler](PartialResult &partial) {
+                            if (partialResultHandler)
+                                partialResultHandler(partial);
+                            partialResults->append(std::move(partial));
+                        },
+                        errorHandler);
+            });
+    typedRpc()->sendRequest(
+            method,
+            [this, token, partialResults, responseHandler = std::move(responseHandler),
+             errorHandler](const QJsonRpcProtocol::Response &response) {
+                unregisterPartialResultHandler(token);
+                if (response.errorCode.isDouble())
+                    errorHandler(ResponseError { response.errorCode.toInt(),
+                                                 response.errorMessage.toUtf8(), response.data });
+                else
+                    decodeAndCall<Result>(
+                            response.data,
+                            [&partialResults, &responseHandler](Result &result) {
+                                responseHandler(aggregatePartialResults(
+                                        std::move(*partialResults), std::move(result)));
+                            },
+                            errorHandler);
+            },
+            p);
+}
+
 } // namespace QLspSpecification
 QT_END_NAMESPACE
 #endif // QLANGUAGESERVERBASE_P_H
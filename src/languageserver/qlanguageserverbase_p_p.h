@@ -17,6 +17,9 @@
 
 #include <QtLanguageServer/private/qlanguageserverbase_p.h>
 #include <QtLanguageServer/private/qlanguageserverjsonrpctransport_p.h>
+#include <QtLanguageServer/private/qlsppositionencoding_p.h>
+
+#include <QtCore/QMap>
 
 QT_BEGIN_NAMESPACE
 namespace QLspSpecification {
@@ -29,6 +32,12 @@ public:
     ProtocolBase::ResponseErrorHandler errorHandler;
     ProtocolBase::GenericRequestHandler undispachedRequestHandler;
     ProtocolBase::GenericNotificationHandler undispachedNotificationHandler;
+    QMap<ProgressToken, ProtocolBase::PartialResultHandler> partialResultHandlers;
+    ProtocolBase::ProgressNotificationHandler progressHandler;
+    QList<QLspPositionEncoding> supportedPositionEncodings = { QLspPositionEncoding::Utf8,
+                                                               QLspPositionEncoding::Utf16 };
+    QLspPositionEncoding positionEncoding = QLspPositionEncoding::Utf16;
+    int lastProgressToken = 0;
 };
 
 } // namespace QLspSpecification
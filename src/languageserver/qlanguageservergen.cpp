@@ -73,7 +73,10 @@ QByteArray ProtocolBase::requestMethodToBaseCppName(const QByteArray &method)
               { QByteArray("workspace/semanticTokens/refresh"),
                 QByteArray("RequestingARefreshOfAllSemanticTokens") },
               { QByteArray("textDocument/linkedEditingRange"), QByteArray("LinkedEditingRange") },
-              { QByteArray("textDocument/moniker"), QByteArray("Moniker") } });
+              { QByteArray("textDocument/moniker"), QByteArray("Moniker") },
+              { QByteArray("textDocument/diagnostic"), QByteArray("DocumentDiagnostic") },
+              { QByteArray("workspace/diagnostic"), QByteArray("WorkspaceDiagnostic") },
+              { QByteArray("workspace/diagnostic/refresh"), QByteArray("DiagnosticRefresh") } });
     return map.value(method);
 }
 
@@ -355,6 +358,19 @@ void ProtocolGen::requestWorkspaceSymbol(
             params);
 }
 
+void ProtocolGen::requestWorkspaceSymbol(
+        const WorkspaceSymbolParams &params,
+        std::function<void(const QList<SymbolInformation> &)> partialResultHandler,
+        std::function<void(const std::variant<QList<SymbolInformation>, std::nullptr_t> &)>
+                responseHandler,
+        ResponseErrorHandler errorHandler)
+{
+    requestWithPartialResults<std::variant<QList<SymbolInformation>, std::nullptr_t>,
+                              QList<SymbolInformation>>(
+            QByteArray(Requests::WorkspaceSymbolMethod), params, std::move(partialResultHandler),
+            std::move(responseHandler), std::move(errorHandler));
+}
+
 void ProtocolGen::requestExecuteCommand(
         const ExecuteCommandParams &params,
         std::function<void(const std::variant<QJsonValue, std::nullptr_t> &)> responseHandler,
@@ -698,6 +714,17 @@ void ProtocolGen::requestReference(
             params);
 }
 
+void ProtocolGen::requestReference(
+        const ReferenceParams &params,
+        std::function<void(const QList<Location> &)> partialResultHandler,
+        std::function<void(const std::variant<QList<Location>, std::nullptr_t> &)> responseHandler,
+        ResponseErrorHandler errorHandler)
+{
+    requestWithPartialResults<std::variant<QList<Location>, std::nullptr_t>, QList<Location>>(
+            QByteArray(Requests::ReferenceMethod), params, std::move(partialResultHandler),
+            std::move(responseHandler), std::move(errorHandler));
+}
+
 void ProtocolGen::requestDocumentHighlight(
         const DocumentHighlightParams &params,
         std::function<void(const std::variant<QList<DocumentHighlight>, std::nullptr_t> &)>
@@ -718,6 +745,19 @@ void ProtocolGen::requestDocumentHighlight(
             params);
 }
 
+void ProtocolGen::requestDocumentHighlight(
+        const DocumentHighlightParams &params,
+        std::function<void(const QList<DocumentHighlight> &)> partialResultHandler,
+        std::function<void(const std::variant<QList<DocumentHighlight>, std::nullptr_t> &)>
+                responseHandler,
+        ResponseErrorHandler errorHandler)
+{
+    requestWithPartialResults<std::variant<QList<DocumentHighlight>, std::nullptr_t>,
+                              QList<DocumentHighlight>>(
+            QByteArray(Requests::DocumentHighlightMethod), params, std::move(partialResultHandler),
+            std::move(responseHandler), std::move(errorHandler));
+}
+
 void ProtocolGen::requestDocumentSymbol(
         const DocumentSymbolParams &params,
         std::function<void(const std::variant<QList<DocumentSymbol>, QList<SymbolInformation>,
@@ -762,6 +802,21 @@ void ProtocolGen::requestCodeAction(
             params);
 }
 
+void ProtocolGen::requestCodeAction(
+        const CodeActionParams &params,
+        std::function<void(const QList<std::variant<Command, CodeAction>> &)> partialResultHandler,
+        std::function<void(
+                const std::variant<QList<std::variant<Command, CodeAction>>, std::nullptr_t> &)>
+                responseHandler,
+        ResponseErrorHandler errorHandler)
+{
+    requestWithPartialResults<
+            std::variant<QList<std::variant<Command, CodeAction>>, std::nullptr_t>,
+            QList<std::variant<Command, CodeAction>>>(
+            QByteArray(Requests::CodeActionMethod), params, std::move(partialResultHandler),
+            std::move(responseHandler), std::move(errorHandler));
+}
+
 void ProtocolGen::requestCodeActionResolve(const CodeAction &params,
                                            std::function<void(const CodeAction &)> responseHandler,
                                            ResponseErrorHandler errorHandler)
@@ -798,6 +853,17 @@ void ProtocolGen::requestCodeLens(
             params);
 }
 
+void ProtocolGen::requestCodeLens(
+        const CodeLensParams &params,
+        std::function<void(const QList<CodeLens> &)> partialResultHandler,
+        std::function<void(const std::variant<QList<CodeLens>, std::nullptr_t> &)> responseHandler,
+        ResponseErrorHandler errorHandler)
+{
+    requestWithPartialResults<std::variant<QList<CodeLens>, std::nullptr_t>, QList<CodeLens>>(
+            QByteArray(Requests::CodeLensMethod), params, std::move(partialResultHandler),
+            std::move(responseHandler), std::move(errorHandler));
+}
+
 void ProtocolGen::requestCodeLensResolve(const CodeLens &params,
                                          std::function<void(const CodeLens &)> responseHandler,
                                          ResponseErrorHandler errorHandler)
@@ -852,6 +918,19 @@ void ProtocolGen::requestDocumentLink(
             params);
 }
 
+void ProtocolGen::requestDocumentLink(
+        const DocumentLinkParams &params,
+        std::function<void(const QList<DocumentLink> &)> partialResultHandler,
+        std::function<void(const std::variant<QList<DocumentLink>, std::nullptr_t> &)>
+                responseHandler,
+        ResponseErrorHandler errorHandler)
+{
+    requestWithPartialResults<std::variant<QList<DocumentLink>, std::nullptr_t>,
+                              QList<DocumentLink>>(
+            QByteArray(Requests::DocumentLinkMethod), params, std::move(partialResultHandler),
+            std::move(responseHandler), std::move(errorHandler));
+}
+
 void ProtocolGen::requestDocumentLinkResolve(
         const DocumentLink &params, std::function<void(const DocumentLink &)> responseHandler,
         ResponseErrorHandler errorHandler)
@@ -888,6 +967,17 @@ void ProtocolGen::requestDocumentColor(
             params);
 }
 
+void ProtocolGen::requestDocumentColor(
+        const DocumentColorParams &params,
+        std::function<void(const QList<ColorInformation> &)> partialResultHandler,
+        std::function<void(const QList<ColorInformation> &)> responseHandler,
+        ResponseErrorHandler errorHandler)
+{
+    requestWithPartialResults<QList<ColorInformation>, QList<ColorInformation>>(
+            QByteArray(Requests::DocumentColorMethod), params, std::move(partialResultHandler),
+            std::move(responseHandler), std::move(errorHandler));
+}
+
 void ProtocolGen::requestColorPresentation(
         const ColorPresentationParams &params,
         std::function<void(const QList<ColorPresentation> &)> responseHandler,
@@ -907,6 +997,17 @@ void ProtocolGen::requestColorPresentation(
             params);
 }
 
+void ProtocolGen::requestColorPresentation(
+        const ColorPresentationParams &params,
+        std::function<void(const QList<ColorPresentation> &)> partialResultHandler,
+        std::function<void(const QList<ColorPresentation> &)> responseHandler,
+        ResponseErrorHandler errorHandler)
+{
+    requestWithPartialResults<QList<ColorPresentation>, QList<ColorPresentation>>(
+            QByteArray(Requests::ColorPresentationMethod), params, std::move(partialResultHandler),
+            std::move(responseHandler), std::move(errorHandler));
+}
+
 void ProtocolGen::requestDocumentFormatting(
         const DocumentFormattingParams &params,
         std::function<void(const std::variant<QList<TextEdit>, std::nullptr_t> &)> responseHandler,
@@ -1025,6 +1126,19 @@ void ProtocolGen::requestFoldingRange(
             params);
 }
 
+void ProtocolGen::requestFoldingRange(
+        const FoldingRangeParams &params,
+        std::function<void(const QList<FoldingRange> &)> partialResultHandler,
+        std::function<void(const std::variant<QList<FoldingRange>, std::nullptr_t> &)>
+                responseHandler,
+        ResponseErrorHandler errorHandler)
+{
+    requestWithPartialResults<std::variant<QList<FoldingRange>, std::nullptr_t>,
+                              QList<FoldingRange>>(
+            QByteArray(Requests::FoldingRangeMethod), params, std::move(partialResultHandler),
+            std::move(responseHandler), std::move(errorHandler));
+}
+
 void ProtocolGen::requestSelectionRange(
         const SelectionRangeParams &params,
         std::function<void(const std::variant<QList<SelectionRange>, std::nullptr_t> &)>
@@ -1045,6 +1159,19 @@ void ProtocolGen::requestSelectionRange(
             params);
 }
 
+void ProtocolGen::requestSelectionRange(
+        const SelectionRangeParams &params,
+        std::function<void(const QList<SelectionRange> &)> partialResultHandler,
+        std::function<void(const std::variant<QList<SelectionRange>, std::nullptr_t> &)>
+                responseHandler,
+        ResponseErrorHandler errorHandler)
+{
+    requestWithPartialResults<std::variant<QList<SelectionRange>, std::nullptr_t>,
+                              QList<SelectionRange>>(
+            QByteArray(Requests::SelectionRangeMethod), params, std::move(partialResultHandler),
+            std::move(responseHandler), std::move(errorHandler));
+}
+
 void ProtocolGen::requestCallHierarchyPrepare(
         const CallHierarchyPrepareParams &params,
         std::function<void(const std::variant<QList<CallHierarchyItem>, std::nullptr_t> &)>
@@ -1085,6 +1212,19 @@ void ProtocolGen::requestCallHierarchyIncomingCalls(
             params);
 }
 
+void ProtocolGen::requestCallHierarchyIncomingCalls(
+        const CallHierarchyIncomingCallsParams &params,
+        std::function<void(const QList<CallHierarchyIncomingCall> &)> partialResultHandler,
+        std::function<void(const std::variant<QList<CallHierarchyIncomingCall>, std::nullptr_t> &)>
+                responseHandler,
+        ResponseErrorHandler errorHandler)
+{
+    requestWithPartialResults<std::variant<QList<CallHierarchyIncomingCall>, std::nullptr_t>,
+                              QList<CallHierarchyIncomingCall>>(
+            QByteArray(Requests::CallHierarchyIncomingCallsMethod), params,
+            std::move(partialResultHandler), std::move(responseHandler), std::move(errorHandler));
+}
+
 void ProtocolGen::requestCallHierarchyOutgoingCalls(
         const CallHierarchyOutgoingCallsParams &params,
         std::function<void(const std::variant<QList<CallHierarchyOutgoingCall>, std::nullptr_t> &)>
@@ -1105,6 +1245,19 @@ void ProtocolGen::requestCallHierarchyOutgoingCalls(
             params);
 }
 
+void ProtocolGen::requestCallHierarchyOutgoingCalls(
+        const CallHierarchyOutgoingCallsParams &params,
+        std::function<void(const QList<CallHierarchyOutgoingCall> &)> partialResultHandler,
+        std::function<void(const std::variant<QList<CallHierarchyOutgoingCall>, std::nullptr_t> &)>
+                responseHandler,
+        ResponseErrorHandler errorHandler)
+{
+    requestWithPartialResults<std::variant<QList<CallHierarchyOutgoingCall>, std::nullptr_t>,
+                              QList<CallHierarchyOutgoingCall>>(
+            QByteArray(Requests::CallHierarchyOutgoingCallsMethod), params,
+            std::move(partialResultHandler), std::move(responseHandler), std::move(errorHandler));
+}
+
 void ProtocolGen::requestSemanticTokens(
         const SemanticTokensParams &params,
         std::function<void(const std::variant<SemanticTokens, std::nullptr_t> &)> responseHandler,
@@ -1221,15 +1374,84 @@ void ProtocolGen::requestMoniker(
             params);
 }
 
+void ProtocolGen::requestMoniker(
+        const MonikerParams &params,
+        std::function<void(const QList<Moniker> &)> partialResultHandler,
+        std::function<void(const std::variant<QList<Moniker>, std::nullptr_t> &)> responseHandler,
+        ResponseErrorHandler errorHandler)
+{
+    requestWithPartialResults<std::variant<QList<Moniker>, std::nullptr_t>, QList<Moniker>>(
+            QByteArray(Requests::MonikerMethod), params, std::move(partialResultHandler),
+            std::move(responseHandler), std::move(errorHandler));
+}
+
+void ProtocolGen::requestDocumentDiagnostic(
+        const DocumentDiagnosticParams &params,
+        std::function<void(const std::variant<RelatedFullDocumentDiagnosticReport,
+                                              RelatedUnchangedDocumentDiagnosticReport> &)>
+                responseHandler,
+        ResponseErrorHandler errorHandler)
+{
+    typedRpc()->sendRequest(
+            QByteArray(Requests::DocumentDiagnosticMethod),
+            [responseHandler = std::move(responseHandler),
+             errorHandler = std::move(errorHandler)](const QJsonRpcProtocol::Response &response) {
+                if (response.errorCode.isDouble())
+                    errorHandler(ResponseError{ response.errorCode.toInt(),
+                                                response.errorMessage.toUtf8(), response.data });
+                else
+                    decodeAndCall<std::variant<RelatedFullDocumentDiagnosticReport,
+                                               RelatedUnchangedDocumentDiagnosticReport>>(
+                            response.data, responseHandler, errorHandler);
+            },
+            params);
+}
+
+void ProtocolGen::requestWorkspaceDiagnostic(
+        const WorkspaceDiagnosticParams &params,
+        std::function<void(const WorkspaceDiagnosticReport &)> responseHandler,
+        ResponseErrorHandler errorHandler)
+{
+    typedRpc()->sendRequest(
+            QByteArray(Requests::WorkspaceDiagnosticMethod),
+            [responseHandler = std::move(responseHandler),
+             errorHandler = std::move(errorHandler)](const QJsonRpcProtocol::Response &response) {
+                if (response.errorCode.isDouble())
+                    errorHandler(ResponseError{ response.errorCode.toInt(),
+                                                response.errorMessage.toUtf8(), response.data });
+                else
+                    decodeAndCall<WorkspaceDiagnosticReport>(response.data, responseHandler,
+                                                             errorHandler);
+            },
+            params);
+}
+
+void ProtocolGen::requestDiagnosticRefresh(const std::nullptr_t &params,
+                                           std::function<void()> responseHandler,
+                                           ResponseErrorHandler errorHandler)
+{
+    typedRpc()->sendRequest(
+            QByteArray(Requests::DiagnosticRefreshMethod),
+            [responseHandler = std::move(responseHandler),
+             errorHandler = std::move(errorHandler)](const QJsonRpcProtocol::Response &response) {
+                if (response.errorCode.isDouble())
+                    errorHandler(ResponseError{ response.errorCode.toInt(),
+                                                response.errorMessage.toUtf8(), response.data });
+                else
+                    decodeAndCall<std::nullptr_t>(response.data, responseHandler, errorHandler);
+            },
+            params);
+}
+
 void ProtocolGen::registerCancelNotificationHandler(
-        const std::function<void(const QByteArray &, const CancelParams &)> &handler)
+        const std::function<void(const QByteArray &, CancelParams)> &handler)
 {
     typedRpc()->registerNotificationHandler<QLspSpecification::Notifications::CancelParamsType>(
             QByteArray(QLspSpecification::Notifications::CancelMethod), handler);
 }
 
 void ProtocolGen::registerInitializeRequestHandler(
-        const std::function<void(const QByteArray &, const InitializeParams &,
+        const std::function<void(const QByteArray &, InitializeParams,
                                  LSPResponse<InitializeResult> &&)> &handler)
 {
     typedRpc()
@@ -1239,7 +1461,7 @@ void ProtocolGen::registerInitializeRequestHandler(
 }
 
 void ProtocolGen::registerInitializedNotificationHandler(
-        const std::function<void(const QByteArray &, const InitializedParams &)> &handler)
+        const std::function<void(const QByteArray &, InitializedParams)> &handler)
 {
     typedRpc()
             ->registerNotificationHandler<QLspSpecification::Notifications::InitializedParamsType>(
@@ -1247,7 +1469,7 @@ void ProtocolGen::registerInitializedNotificationHandler(
 }
 
 void ProtocolGen::registerShutdownRequestHandler(
-        const std::function<void(const QByteArray &, const std::nullptr_t &,
+        const std::function<void(const QByteArray &, std::nullptr_t,
                                  LSPResponse<std::nullptr_t> &&)> &handler)
 {
     typedRpc()
@@ -1257,28 +1479,28 @@ void ProtocolGen::registerShutdownRequestHandler(
 }
 
 void ProtocolGen::registerExitNotificationHandler(
-        const std::function<void(const QByteArray &, const std::nullptr_t &)> &handler)
+        const std::function<void(const QByteArray &, std::nullptr_t)> &handler)
 {
     typedRpc()->registerNotificationHandler<QLspSpecification::Notifications::ExitParamsType>(
             QByteArray(QLspSpecification::Notifications::ExitMethod), handler);
 }
 
 void ProtocolGen::registerLogTraceNotificationHandler(
-        const std::function<void(const QByteArray &, const LogTraceParams &)> &handler)
+        const std::function<void(const QByteArray &, LogTraceParams)> &handler)
 {
     typedRpc()->registerNotificationHandler<QLspSpecification::Notifications::LogTraceParamsType>(
             QByteArray(QLspSpecification::Notifications::LogTraceMethod), handler);
 }
 
 void ProtocolGen::registerSetTraceNotificationHandler(
-        const std::function<void(const QByteArray &, const SetTraceParams &)> &handler)
+        const std::function<void(const QByteArray &, SetTraceParams)> &handler)
 {
     typedRpc()->registerNotificationHandler<QLspSpecification::Notifications::SetTraceParamsType>(
             QByteArray(QLspSpecification::Notifications::SetTraceMethod), handler);
 }
 
 void ProtocolGen::registerShowMessageNotificationHandler(
-        const std::function<void(const QByteArray &, const ShowMessageParams &)> &handler)
+        const std::function<void(const QByteArray &, ShowMessageParams)> &handler)
 {
     typedRpc()
             ->registerNotificationHandler<QLspSpecification::Notifications::ShowMessageParamsType>(
@@ -1286,7 +1508,7 @@ void ProtocolGen::registerShowMessageNotificationHandler(
 }
 
 void ProtocolGen::registerShowMessageRequestRequestHandler(
-        const std::function<void(const QByteArray &, const ShowMessageRequestParams &,
+        const std::function<void(const QByteArray &, ShowMessageRequestParams,
                                  LSPResponse<std::variant<MessageActionItem, std::nullptr_t>> &&)>
                 &handler)
 {
@@ -1297,7 +1519,7 @@ void ProtocolGen::registerShowMessageRequestRequestHandler(
 }
 
 void ProtocolGen::registerShowDocumentRequestHandler(
-        const std::function<void(const QByteArray &, const ShowDocumentParams &,
+        const std::function<void(const QByteArray &, ShowDocumentParams,
                                  LSPResponse<ShowDocumentResult> &&)> &handler)
 {
     typedRpc()
@@ -1307,14 +1529,14 @@ void ProtocolGen::registerShowDocumentRequestHandler(
 }
 
 void ProtocolGen::registerLogMessageNotificationHandler(
-        const std::function<void(const QByteArray &, const LogMessageParams &)> &handler)
+        const std::function<void(const QByteArray &, LogMessageParams)> &handler)
 {
     typedRpc()->registerNotificationHandler<QLspSpecification::Notifications::LogMessageParamsType>(
             QByteArray(QLspSpecification::Notifications::LogMessageMethod), handler);
 }
 
 void ProtocolGen::registerWorkDoneProgressCreateRequestHandler(
-        const std::function<void(const QByteArray &, const WorkDoneProgressCreateParams &,
+        const std::function<void(const QByteArray &, WorkDoneProgressCreateParams,
                                  LSPResponse<std::nullptr_t> &&)> &handler)
 {
     typedRpc()
@@ -1325,7 +1547,7 @@ void ProtocolGen::registerWorkDoneProgressCreateRequestHandler(
 }
 
 void ProtocolGen::registerWorkDoneProgressCancelNotificationHandler(
-        const std::function<void(const QByteArray &, const WorkDoneProgressCancelParams &)>
+        const std::function<void(const QByteArray &, WorkDoneProgressCancelParams)>
                 &handler)
 {
     typedRpc()
@@ -1336,7 +1558,7 @@ void ProtocolGen::registerWorkDoneProgressCancelNotificationHandler(
 }
 
 void ProtocolGen::registerTelemetryEventNotificationHandler(
-        const std::function<void(const QByteArray &, const QJsonObject &)> &handler)
+        const std::function<void(const QByteArray &, QJsonObject)> &handler)
 {
     typedRpc()
             ->registerNotificationHandler<
@@ -1345,7 +1567,7 @@ void ProtocolGen::registerTelemetryEventNotificationHandler(
 }
 
 void ProtocolGen::registerRegistrationRequestHandler(
-        const std::function<void(const QByteArray &, const RegistrationParams &,
+        const std::function<void(const QByteArray &, RegistrationParams,
                                  LSPResponse<std::nullptr_t> &&)> &handler)
 {
     typedRpc()
@@ -1355,7 +1577,7 @@ void ProtocolGen::registerRegistrationRequestHandler(
 }
 
 void ProtocolGen::registerUnregistrationRequestHandler(
-        const std::function<void(const QByteArray &, const UnregistrationParams &,
+        const std::function<void(const QByteArray &, UnregistrationParams,
                                  LSPResponse<std::nullptr_t> &&)> &handler)
 {
     typedRpc()
@@ -1366,7 +1588,7 @@ void ProtocolGen::registerUnregistrationRequestHandler(
 
 void ProtocolGen::registerWorkspaceWorkspaceFoldersRequestHandler(
         const std::function<void(
-                const QByteArray &, const std::nullptr_t &,
+                const QByteArray &, std::nullptr_t,
                 LSPResponse<std::variant<QList<WorkspaceFolder>, std::nullptr_t>> &&)> &handler)
 {
     typedRpc()
@@ -1378,7 +1600,7 @@ void ProtocolGen::registerWorkspaceWorkspaceFoldersRequestHandler(
 }
 
 void ProtocolGen::registerDidChangeWorkspaceFoldersNotificationHandler(
-        const std::function<void(const QByteArray &, const DidChangeWorkspaceFoldersParams &)>
+        const std::function<void(const QByteArray &, DidChangeWorkspaceFoldersParams)>
                 &handler)
 {
     typedRpc()
@@ -1389,7 +1611,7 @@ void ProtocolGen::registerDidChangeWorkspaceFoldersNotificationHandler(
 }
 
 void ProtocolGen::registerDidChangeConfigurationNotificationHandler(
-        const std::function<void(const QByteArray &, const DidChangeConfigurationParams &)>
+        const std::function<void(const QByteArray &, DidChangeConfigurationParams)>
                 &handler)
 {
     typedRpc()
@@ -1400,7 +1622,7 @@ void ProtocolGen::registerDidChangeConfigurationNotificationHandler(
 }
 
 void ProtocolGen::registerConfigurationRequestHandler(
-        const std::function<void(const QByteArray &, const ConfigurationParams &,
+        const std::function<void(const QByteArray &, ConfigurationParams,
                                  LSPResponse<QList<QJsonValue>> &&)> &handler)
 {
     typedRpc()
@@ -1410,7 +1632,7 @@ void ProtocolGen::registerConfigurationRequestHandler(
 }
 
 void ProtocolGen::registerDidChangeWatchedFilesNotificationHandler(
-        const std::function<void(const QByteArray &, const DidChangeWatchedFilesParams &)> &handler)
+        const std::function<void(const QByteArray &, DidChangeWatchedFilesParams)> &handler)
 {
     typedRpc()
             ->registerNotificationHandler<
@@ -1421,7 +1643,7 @@ void ProtocolGen::registerDidChangeWatchedFilesNotificationHandler(
 
 void ProtocolGen::registerWorkspaceSymbolRequestHandler(
         const std::function<
-                void(const QByteArray &, const WorkspaceSymbolParams &,
+                void(const QByteArray &, WorkspaceSymbolParams,
                      LSPPartialResponse<std::variant<QList<SymbolInformation>, std::nullptr_t>,
                                         QList<SymbolInformation>> &&)> &handler)
 {
@@ -1432,7 +1654,7 @@ void ProtocolGen::registerWorkspaceSymbolRequestHandler(
 }
 
 void ProtocolGen::registerExecuteCommandRequestHandler(
-        const std::function<void(const QByteArray &, const ExecuteCommandParams &,
+        const std::function<void(const QByteArray &, ExecuteCommandParams,
                                  LSPResponse<std::variant<QJsonValue, std::nullptr_t>> &&)>
                 &handler)
 {
@@ -1443,7 +1665,7 @@ void ProtocolGen::registerExecuteCommandRequestHandler(
 }
 
 void ProtocolGen::registerApplyWorkspaceEditRequestHandler(
-        const std::function<void(const QByteArray &, const ApplyWorkspaceEditParams &,
+        const std::function<void(const QByteArray &, ApplyWorkspaceEditParams,
                                  LSPResponse<ApplyWorkspaceEditResponse> &&)> &handler)
 {
     typedRpc()
@@ -1453,7 +1675,7 @@ void ProtocolGen::registerApplyWorkspaceEditRequestHandler(
 }
 
 void ProtocolGen::registerCreateFilesRequestHandler(
-        const std::function<void(const QByteArray &, const CreateFilesParams &,
+        const std::function<void(const QByteArray &, CreateFilesParams,
                                  LSPResponse<std::variant<WorkspaceEdit, std::nullptr_t>> &&)>
                 &handler)
 {
@@ -1464,7 +1686,7 @@ void ProtocolGen::registerCreateFilesRequestHandler(
 }
 
 void ProtocolGen::registerCreateFilesNotificationHandler(
-        const std::function<void(const QByteArray &, const CreateFilesParams &)> &handler)
+        const std::function<void(const QByteArray &, CreateFilesParams)> &handler)
 {
     typedRpc()
             ->registerNotificationHandler<QLspSpecification::Notifications::CreateFilesParamsType>(
@@ -1472,7 +1694,7 @@ void ProtocolGen::registerCreateFilesNotificationHandler(
 }
 
 void ProtocolGen::registerRenameFilesRequestHandler(
-        const std::function<void(const QByteArray &, const RenameFilesParams &,
+        const std::function<void(const QByteArray &, RenameFilesParams,
                                  LSPResponse<std::variant<WorkspaceEdit, std::nullptr_t>> &&)>
                 &handler)
 {
@@ -1483,7 +1705,7 @@ void ProtocolGen::registerRenameFilesRequestHandler(
 }
 
 void ProtocolGen::registerRenameFilesNotificationHandler(
-        const std::function<void(const QByteArray &, const RenameFilesParams &)> &handler)
+        const std::function<void(const QByteArray &, RenameFilesParams)> &handler)
 {
     typedRpc()
             ->registerNotificationHandler<QLspSpecification::Notifications::RenameFilesParamsType>(
@@ -1491,7 +1713,7 @@ void ProtocolGen::registerRenameFilesNotificationHandler(
 }
 
 void ProtocolGen::registerDeleteFilesRequestHandler(
-        const std::function<void(const QByteArray &, const DeleteFilesParams &,
+        const std::function<void(const QByteArray &, DeleteFilesParams,
                                  LSPResponse<std::variant<WorkspaceEdit, std::nullptr_t>> &&)>
                 &handler)
 {
@@ -1502,7 +1724,7 @@ void ProtocolGen::registerDeleteFilesRequestHandler(
 }
 
 void ProtocolGen::registerDeleteFilesNotificationHandler(
-        const std::function<void(const QByteArray &, const DeleteFilesParams &)> &handler)
+        const std::function<void(const QByteArray &, DeleteFilesParams)> &handler)
 {
     typedRpc()
             ->registerNotificationHandler<QLspSpecification::Notifications::DeleteFilesParamsType>(
@@ -1510,7 +1732,7 @@ void ProtocolGen::registerDeleteFilesNotificationHandler(
 }
 
 void ProtocolGen::registerDidOpenTextDocumentNotificationHandler(
-        const std::function<void(const QByteArray &, const DidOpenTextDocumentParams &)> &handler)
+        const std::function<void(const QByteArray &, DidOpenTextDocumentParams)> &handler)
 {
     typedRpc()
             ->registerNotificationHandler<
@@ -1520,7 +1742,7 @@ void ProtocolGen::registerDidOpenTextDocumentNotificationHandler(
 }
 
 void ProtocolGen::registerDidChangeTextDocumentNotificationHandler(
-        const std::function<void(const QByteArray &, const DidChangeTextDocumentParams &)> &handler)
+        const std::function<void(const QByteArray &, DidChangeTextDocumentParams)> &handler)
 {
     typedRpc()
             ->registerNotificationHandler<
@@ -1530,7 +1752,7 @@ void ProtocolGen::registerDidChangeTextDocumentNotificationHandler(
 }
 
 void ProtocolGen::registerWillSaveTextDocumentNotificationHandler(
-        const std::function<void(const QByteArray &, const WillSaveTextDocumentParams &)> &handler)
+        const std::function<void(const QByteArray &, WillSaveTextDocumentParams)> &handler)
 {
     typedRpc()
             ->registerNotificationHandler<
@@ -1540,7 +1762,7 @@ void ProtocolGen::registerWillSaveTextDocumentNotificationHandler(
 }
 
 void ProtocolGen::registerWillSaveTextDocumentRequestHandler(
-        const std::function<void(const QByteArray &, const WillSaveTextDocumentParams &,
+        const std::function<void(const QByteArray &, WillSaveTextDocumentParams,
                                  LSPResponse<std::variant<QList<TextEdit>, std::nullptr_t>> &&)>
                 &handler)
 {
@@ -1552,7 +1774,7 @@ void ProtocolGen::registerWillSaveTextDocumentRequestHandler(
 }
 
 void ProtocolGen::registerDidSaveTextDocumentNotificationHandler(
-        const std::function<void(const QByteArray &, const DidSaveTextDocumentParams &)> &handler)
+        const std::function<void(const QByteArray &, DidSaveTextDocumentParams)> &handler)
 {
     typedRpc()
             ->registerNotificationHandler<
@@ -1562,7 +1784,7 @@ void ProtocolGen::registerDidSaveTextDocumentNotificationHandler(
 }
 
 void ProtocolGen::registerDidCloseTextDocumentNotificationHandler(
-        const std::function<void(const QByteArray &, const DidCloseTextDocumentParams &)> &handler)
+        const std::function<void(const QByteArray &, DidCloseTextDocumentParams)> &handler)
 {
     typedRpc()
             ->registerNotificationHandler<
@@ -1572,7 +1794,7 @@ void ProtocolGen::registerDidCloseTextDocumentNotificationHandler(
 }
 
 void ProtocolGen::registerPublishDiagnosticsNotificationHandler(
-        const std::function<void(const QByteArray &, const PublishDiagnosticsParams &)> &handler)
+        const std::function<void(const QByteArray &, PublishDiagnosticsParams)> &handler)
 {
     typedRpc()
             ->registerNotificationHandler<
@@ -1583,7 +1805,7 @@ void ProtocolGen::registerPublishDiagnosticsNotificationHandler(
 
 void ProtocolGen::registerCompletionRequestHandler(
         const std::function<
-                void(const QByteArray &, const CompletionParams &,
+                void(const QByteArray &, CompletionParams,
                      LSPPartialResponse<
                              std::variant<QList<CompletionItem>, CompletionList, std::nullptr_t>,
                              std::variant<CompletionList, QList<CompletionItem>>> &&)> &handler)
@@ -1595,7 +1817,7 @@ void ProtocolGen::registerCompletionRequestHandler(
 }
 
 void ProtocolGen::registerCompletionItemResolveRequestHandler(
-        const std::function<void(const QByteArray &, const CompletionItem &,
+        const std::function<void(const QByteArray &, CompletionItem,
                                  LSPResponse<CompletionItem> &&)> &handler)
 {
     typedRpc()
@@ -1606,7 +1828,7 @@ void ProtocolGen::registerCompletionItemResolveRequestHandler(
 }
 
 void ProtocolGen::registerHoverRequestHandler(
-        const std::function<void(const QByteArray &, const HoverParams &,
+        const std::function<void(const QByteArray &, HoverParams,
                                  LSPResponse<std::variant<Hover, std::nullptr_t>> &&)> &handler)
 {
     typedRpc()
@@ -1616,7 +1838,7 @@ void ProtocolGen::registerHoverRequestHandler(
 }
 
 void ProtocolGen::registerSignatureHelpRequestHandler(
-        const std::function<void(const QByteArray &, const SignatureHelpParams &,
+        const std::function<void(const QByteArray &, SignatureHelpParams,
                                  LSPResponse<std::variant<SignatureHelp, std::nullptr_t>> &&)>
                 &handler)
 {
@@ -1628,7 +1850,7 @@ void ProtocolGen::registerSignatureHelpRequestHandler(
 
 void ProtocolGen::registerDeclarationRequestHandler(
         const std::function<
-                void(const QByteArray &, const DeclarationParams &,
+                void(const QByteArray &, DeclarationParams,
                      LSPPartialResponse<std::variant<Location, QList<Location>, QList<LocationLink>,
                                                      std::nullptr_t>,
                                         std::variant<QList<Location>, QList<LocationLink>>> &&)>
@@ -1642,7 +1864,7 @@ void ProtocolGen::registerDeclarationRequestHandler(
 
 void ProtocolGen::registerDefinitionRequestHandler(
         const std::function<
-                void(const QByteArray &, const DefinitionParams &,
+                void(const QByteArray &, DefinitionParams,
                      LSPPartialResponse<std::variant<Location, QList<Location>, QList<LocationLink>,
                                                      std::nullptr_t>,
                                         std::variant<QList<Location>, QList<LocationLink>>> &&)>
@@ -1656,7 +1878,7 @@ void ProtocolGen::registerDefinitionRequestHandler(
 
 void ProtocolGen::registerTypeDefinitionRequestHandler(
         const std::function<
-                void(const QByteArray &, const TypeDefinitionParams &,
+                void(const QByteArray &, TypeDefinitionParams,
                      LSPPartialResponse<std::variant<Location, QList<Location>, QList<LocationLink>,
                                                      std::nullptr_t>,
                                         std::variant<QList<Location>, QList<LocationLink>>> &&)>
@@ -1670,7 +1892,7 @@ void ProtocolGen::registerTypeDefinitionRequestHandler(
 
 void ProtocolGen::registerImplementationRequestHandler(
         const std::function<
-                void(const QByteArray &, const ImplementationParams &,
+                void(const QByteArray &, ImplementationParams,
                      LSPPartialResponse<std::variant<Location, QList<Location>, QList<LocationLink>,
                                                      std::nullptr_t>,
                                         std::variant<QList<Location>, QList<LocationLink>>> &&)>
@@ -1683,7 +1905,7 @@ void ProtocolGen::registerImplementationRequestHandler(
 }
 
 void ProtocolGen::registerReferenceRequestHandler(
-        const std::function<void(const QByteArray &, const ReferenceParams &,
+        const std::function<void(const QByteArray &, ReferenceParams,
                                  LSPPartialResponse<std::variant<QList<Location>, std::nullptr_t>,
                                                     QList<Location>> &&)> &handler)
 {
@@ -1695,7 +1917,7 @@ void ProtocolGen::registerReferenceRequestHandler(
 
 void ProtocolGen::registerDocumentHighlightRequestHandler(
         const std::function<
-                void(const QByteArray &, const DocumentHighlightParams &,
+                void(const QByteArray &, DocumentHighlightParams,
                      LSPPartialResponse<std::variant<QList<DocumentHighlight>, std::nullptr_t>,
                                         QList<DocumentHighlight>> &&)> &handler)
 {
@@ -1707,7 +1929,7 @@ void ProtocolGen::registerDocumentHighlightRequestHandler(
 
 void ProtocolGen::registerDocumentSymbolRequestHandler(
         const std::function<void(
-                const QByteArray &, const DocumentSymbolParams &,
+                const QByteArray &, DocumentSymbolParams,
                 LSPPartialResponse<std::variant<QList<DocumentSymbol>, QList<SymbolInformation>,
                                                 std::nullptr_t>,
                                    std::variant<QList<DocumentSymbol>, QList<SymbolInformation>>>
@@ -1721,7 +1943,7 @@ void ProtocolGen::registerDocumentSymbolRequestHandler(
 
 void ProtocolGen::registerCodeActionRequestHandler(
         const std::function<
-                void(const QByteArray &, const CodeActionParams &,
+                void(const QByteArray &, CodeActionParams,
                      LSPPartialResponse<
                              std::variant<QList<std::variant<Command, CodeAction>>, std::nullptr_t>,
                              QList<std::variant<Command, CodeAction>>> &&)> &handler)
@@ -1733,7 +1955,7 @@ void ProtocolGen::registerCodeActionRequestHandler(
 }
 
 void ProtocolGen::registerCodeActionResolveRequestHandler(
-        const std::function<void(const QByteArray &, const CodeAction &,
+        const std::function<void(const QByteArray &, CodeAction,
                                  LSPResponse<CodeAction> &&)> &handler)
 {
     typedRpc()
@@ -1743,7 +1965,7 @@ void ProtocolGen::registerCodeActionResolveRequestHandler(
 }
 
 void ProtocolGen::registerCodeLensRequestHandler(
-        const std::function<void(const QByteArray &, const CodeLensParams &,
+        const std::function<void(const QByteArray &, CodeLensParams,
                                  LSPPartialResponse<std::variant<QList<CodeLens>, std::nullptr_t>,
                                                     QList<CodeLens>> &&)> &handler)
 {
@@ -1754,7 +1976,7 @@ void ProtocolGen::registerCodeLensRequestHandler(
 }
 
 void ProtocolGen::registerCodeLensResolveRequestHandler(
-        const std::function<void(const QByteArray &, const CodeLens &, LSPResponse<CodeLens> &&)>
+        const std::function<void(const QByteArray &, CodeLens, LSPResponse<CodeLens> &&)>
                 &handler)
 {
     typedRpc()
@@ -1764,7 +1986,7 @@ void ProtocolGen::registerCodeLensResolveRequestHandler(
 }
 
 void ProtocolGen::registerCodeLensRefreshRequestHandler(
-        const std::function<void(const QByteArray &, const std::nullptr_t &,
+        const std::function<void(const QByteArray &, std::nullptr_t,
                                  LSPResponse<std::nullptr_t> &&)> &handler)
 {
     typedRpc()
@@ -1775,7 +1997,7 @@ void ProtocolGen::registerCodeLensRefreshRequestHandler(
 
 void ProtocolGen::registerDocumentLinkRequestHandler(
         const std::function<
-                void(const QByteArray &, const DocumentLinkParams &,
+                void(const QByteArray &, DocumentLinkParams,
                      LSPPartialResponse<std::variant<QList<DocumentLink>, std::nullptr_t>,
                                         QList<DocumentLink>> &&)> &handler)
 {
@@ -1786,7 +2008,7 @@ void ProtocolGen::registerDocumentLinkRequestHandler(
 }
 
 void ProtocolGen::registerDocumentLinkResolveRequestHandler(
-        const std::function<void(const QByteArray &, const DocumentLink &,
+        const std::function<void(const QByteArray &, DocumentLink,
                                  LSPResponse<DocumentLink> &&)> &handler)
 {
     typedRpc()
@@ -1797,7 +2019,7 @@ void ProtocolGen::registerDocumentLinkResolveRequestHandler(
 
 void ProtocolGen::registerDocumentColorRequestHandler(
         const std::function<void(
-                const QByteArray &, const DocumentColorParams &,
+                const QByteArray &, DocumentColorParams,
                 LSPPartialResponse<QList<ColorInformation>, QList<ColorInformation>> &&)> &handler)
 {
     typedRpc()
@@ -1807,7 +2029,7 @@ void ProtocolGen::registerDocumentColorRequestHandler(
 }
 
 void ProtocolGen::registerColorPresentationRequestHandler(
-        const std::function<void(const QByteArray &, const ColorPresentationParams &,
+        const std::function<void(const QByteArray &, ColorPresentationParams,
                                  LSPPartialResponse<QList<ColorPresentation>,
                                                     QList<ColorPresentation>> &&)> &handler)
 {
@@ -1818,7 +2040,7 @@ void ProtocolGen::registerColorPresentationRequestHandler(
 }
 
 void ProtocolGen::registerDocumentFormattingRequestHandler(
-        const std::function<void(const QByteArray &, const DocumentFormattingParams &,
+        const std::function<void(const QByteArray &, DocumentFormattingParams,
                                  LSPResponse<std::variant<QList<TextEdit>, std::nullptr_t>> &&)>
                 &handler)
 {
@@ -1829,7 +2051,7 @@ void ProtocolGen::registerDocumentFormattingRequestHandler(
 }
 
 void ProtocolGen::registerDocumentRangeFormattingRequestHandler(
-        const std::function<void(const QByteArray &, const DocumentRangeFormattingParams &,
+        const std::function<void(const QByteArray &, DocumentRangeFormattingParams,
                                  LSPResponse<std::variant<QList<TextEdit>, std::nullptr_t>> &&)>
                 &handler)
 {
@@ -1842,7 +2064,7 @@ void ProtocolGen::registerDocumentRangeFormattingRequestHandler(
 }
 
 void ProtocolGen::registerDocumentOnTypeFormattingRequestHandler(
-        const std::function<void(const QByteArray &, const DocumentOnTypeFormattingParams &,
+        const std::function<void(const QByteArray &, DocumentOnTypeFormattingParams,
                                  LSPResponse<std::variant<QList<TextEdit>, std::nullptr_t>> &&)>
                 &handler)
 {
@@ -1855,7 +2077,7 @@ void ProtocolGen::registerDocumentOnTypeFormattingRequestHandler(
 }
 
 void ProtocolGen::registerRenameRequestHandler(
-        const std::function<void(const QByteArray &, const RenameParams &,
+        const std::function<void(const QByteArray &, RenameParams,
                                  LSPResponse<std::variant<WorkspaceEdit, std::nullptr_t>> &&)>
                 &handler)
 {
@@ -1867,7 +2089,7 @@ void ProtocolGen::registerRenameRequestHandler(
 
 void ProtocolGen::registerPrepareRenameRequestHandler(
         const std::function<
-                void(const QByteArray &, const PrepareRenameParams &,
+                void(const QByteArray &, PrepareRenameParams,
                      LSPResponse<std::variant<Range, RangePlaceHolder, DefaultBehaviorStruct,
                                               std::nullptr_t>> &&)> &handler)
 {
@@ -1879,7 +2101,7 @@ void ProtocolGen::registerPrepareRenameRequestHandler(
 
 void ProtocolGen::registerFoldingRangeRequestHandler(
         const std::function<
-                void(const QByteArray &, const FoldingRangeParams &,
+                void(const QByteArray &, FoldingRangeParams,
                      LSPPartialResponse<std::variant<QList<FoldingRange>, std::nullptr_t>,
                                         QList<FoldingRange>> &&)> &handler)
 {
@@ -1891,7 +2113,7 @@ void ProtocolGen::registerFoldingRangeRequestHandler(
 
 void ProtocolGen::registerSelectionRangeRequestHandler(
         const std::function<
-                void(const QByteArray &, const SelectionRangeParams &,
+                void(const QByteArray &, SelectionRangeParams,
                      LSPPartialResponse<std::variant<QList<SelectionRange>, std::nullptr_t>,
                                         QList<SelectionRange>> &&)> &handler)
 {
@@ -1903,7 +2125,7 @@ void ProtocolGen::registerSelectionRangeRequestHandler(
 
 void ProtocolGen::registerCallHierarchyPrepareRequestHandler(
         const std::function<void(
-                const QByteArray &, const CallHierarchyPrepareParams &,
+                const QByteArray &, CallHierarchyPrepareParams,
                 LSPResponse<std::variant<QList<CallHierarchyItem>, std::nullptr_t>> &&)> &handler)
 {
     typedRpc()
@@ -1915,7 +2137,7 @@ void ProtocolGen::registerCallHierarchyPrepareRequestHandler(
 
 void ProtocolGen::registerCallHierarchyIncomingCallsRequestHandler(
         const std::function<void(
-                const QByteArray &, const CallHierarchyIncomingCallsParams &,
+                const QByteArray &, CallHierarchyIncomingCallsParams,
                 LSPPartialResponse<std::variant<QList<CallHierarchyIncomingCall>, std::nullptr_t>,
                                    QList<CallHierarchyIncomingCall>> &&)> &handler)
 {
@@ -1929,7 +2151,7 @@ void ProtocolGen::registerCallHierarchyIncomingCallsRequestHandler(
 
 void ProtocolGen::registerCallHierarchyOutgoingCallsRequestHandler(
         const std::function<void(
-                const QByteArray &, const CallHierarchyOutgoingCallsParams &,
+                const QByteArray &, CallHierarchyOutgoingCallsParams,
                 LSPPartialResponse<std::variant<QList<CallHierarchyOutgoingCall>, std::nullptr_t>,
                                    QList<CallHierarchyOutgoingCall>> &&)> &handler)
 {
@@ -1942,7 +2164,7 @@ void ProtocolGen::registerCallHierarchyOutgoingCallsRequestHandler(
 }
 
 void ProtocolGen::registerSemanticTokensRequestHandler(
-        const std::function<void(const QByteArray &, const SemanticTokensParams &,
+        const std::function<void(const QByteArray &, SemanticTokensParams,
                                  LSPPartialResponse<std::variant<SemanticTokens, std::nullptr_t>,
                                                     SemanticTokensPartialResult> &&)> &handler)
 {
@@ -1954,7 +2176,7 @@ void ProtocolGen::registerSemanticTokensRequestHandler(
 
 void ProtocolGen::registerSemanticTokensDeltaRequestHandler(
         const std::function<
-                void(const QByteArray &, const SemanticTokensDeltaParams &,
+                void(const QByteArray &, SemanticTokensDeltaParams,
                      LSPPartialResponse<
                              std::variant<SemanticTokens, SemanticTokensDelta, std::nullptr_t>,
                              SemanticTokensDeltaPartialResult> &&)> &handler)
@@ -1966,7 +2188,7 @@ void ProtocolGen::registerSemanticTokensDeltaRequestHandler(
 }
 
 void ProtocolGen::registerSemanticTokensRangeRequestHandler(
-        const std::function<void(const QByteArray &, const SemanticTokensRangeParams &,
+        const std::function<void(const QByteArray &, SemanticTokensRangeParams,
                                  LSPPartialResponse<std::variant<SemanticTokens, std::nullptr_t>,
                                                     SemanticTokensPartialResult> &&)> &handler)
 {
@@ -1977,7 +2199,7 @@ void ProtocolGen::registerSemanticTokensRangeRequestHandler(
 }
 
 void ProtocolGen::registerRequestingARefreshOfAllSemanticTokensRequestHandler(
-        const std::function<void(const QByteArray &, const std::nullptr_t &,
+        const std::function<void(const QByteArray &, std::nullptr_t,
                                  LSPResponse<std::nullptr_t> &&)> &handler)
 {
     typedRpc()
@@ -1991,7 +2213,7 @@ void ProtocolGen::registerRequestingARefreshOfAllSemanticTokensRequestHandler(
 }
 
 void ProtocolGen::registerLinkedEditingRangeRequestHandler(
-        const std::function<void(const QByteArray &, const LinkedEditingRangeParams &,
+        const std::function<void(const QByteArray &, LinkedEditingRangeParams,
                                  LSPResponse<std::variant<LinkedEditingRanges, std::nullptr_t>> &&)>
                 &handler)
 {
@@ -2002,7 +2224,7 @@ void ProtocolGen::registerLinkedEditingRangeRequestHandler(
 }
 
 void ProtocolGen::registerMonikerRequestHandler(
-        const std::function<void(const QByteArray &, const MonikerParams &,
+        const std::function<void(const QByteArray &, MonikerParams,
                                  LSPPartialResponse<std::variant<QList<Moniker>, std::nullptr_t>,
                                                     QList<Moniker>> &&)> &handler)
 {
@@ -2012,6 +2234,41 @@ void ProtocolGen::registerMonikerRequestHandler(
                     QByteArray(QLspSpecification::Requests::MonikerMethod), handler);
 }
 
+void ProtocolGen::registerDocumentDiagnosticRequestHandler(
+        const std::function<
+                void(const QByteArray &, DocumentDiagnosticParams,
+                     LSPPartialResponse<std::variant<RelatedFullDocumentDiagnosticReport,
+                                                     RelatedUnchangedDocumentDiagnosticReport>,
+                                        DocumentDiagnosticReportPartialResult> &&)> &handler)
+{
+    typedRpc()
+            ->registerRequestHandler<QLspSpecification::Requests::DocumentDiagnosticParamsType,
+                                     QLspSpecification::Responses::DocumentDiagnosticResponseType>(
+                    QByteArray(QLspSpecification::Requests::DocumentDiagnosticMethod), handler);
+}
+
+void ProtocolGen::registerWorkspaceDiagnosticRequestHandler(
+        const std::function<void(const QByteArray &, WorkspaceDiagnosticParams,
+                                 LSPPartialResponse<WorkspaceDiagnosticReport,
+                                                    WorkspaceDiagnosticReportPartialResult> &&)>
+                &handler)
+{
+    typedRpc()
+            ->registerRequestHandler<QLspSpecification::Requests::WorkspaceDiagnosticParamsType,
+                                     QLspSpecification::Responses::WorkspaceDiagnosticResponseType>(
+                    QByteArray(QLspSpecification::Requests::WorkspaceDiagnosticMethod), handler);
+}
+
+void ProtocolGen::registerDiagnosticRefreshRequestHandler(
+        const std::function<void(const QByteArray &, std::nullptr_t,
+                                 LSPResponse<std::nullptr_t> &&)> &handler)
+{
+    typedRpc()
+            ->registerRequestHandler<QLspSpecification::Requests::DiagnosticRefreshParamsType,
+                                     QLspSpecification::Responses::DiagnosticRefreshResponseType>(
+                    QByteArray(QLspSpecification::Requests::DiagnosticRefreshMethod), handler);
+}
+
 } // namespace QLspSpecification
 
 QT_END_NAMESPACE
@@ -111,6 +111,12 @@ public:
             std::function<void(const std::variant<QList<SymbolInformation>, std::nullptr_t> &)>
                     responseHandler,
             ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
+    void requestWorkspaceSymbol(
+            const WorkspaceSymbolParams &,
+            std::function<void(const QList<SymbolInformation> &)> partialResultHandler,
+            std::function<void(const std::variant<QList<SymbolInformation>, std::nullptr_t> &)>
+                    responseHandler,
+            ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
 
     // ServerCapability::ExecuteCommandProvider
     // ClientCapability::WorkspaceExecuteCommand
@@ -259,6 +265,12 @@ public:
             std::function<void(const std::variant<QList<Location>, std::nullptr_t> &)>
                     responseHandler,
             ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
+    void requestReference(
+            const ReferenceParams &,
+            std::function<void(const QList<Location> &)> partialResultHandler,
+            std::function<void(const std::variant<QList<Location>, std::nullptr_t> &)>
+                    responseHandler,
+            ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
 
     // ServerCapability::DocumentHighlightProvider
     // ClientCapability::TextDocumentDocumentHighlight
@@ -267,6 +279,12 @@ public:
             std::function<void(const std::variant<QList<DocumentHighlight>, std::nullptr_t> &)>
                     responseHandler,
             ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
+    void requestDocumentHighlight(
+            const DocumentHighlightParams &,
+            std::function<void(const QList<DocumentHighlight> &)> partialResultHandler,
+            std::function<void(const std::variant<QList<DocumentHighlight>, std::nullptr_t> &)>
+                    responseHandler,
+            ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
 
     // ServerCapability::DocumentSymbolProvider
     // ClientCapability::TextDocumentDocumentSymbol
@@ -285,6 +303,14 @@ public:
                     const std::variant<QList<std::variant<Command, CodeAction>>, std::nullptr_t> &)>
                     responseHandler,
             ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
+    void requestCodeAction(
+            const CodeActionParams &,
+            std::function<void(const QList<std::variant<Command, CodeAction>> &)>
+                    partialResultHandler,
+            std::function<void(
+                    const std::variant<QList<std::variant<Command, CodeAction>>, std::nullptr_t> &)>
+                    responseHandler,
+            ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
 
     // ClientCapability::TextDocumentCodeActionResolveSupport
     void requestCodeActionResolve(
@@ -298,6 +324,12 @@ public:
                     std::function<void(const std::variant<QList<CodeLens>, std::nullptr_t> &)>
                             responseHandler,
                     ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
+    void
+    requestCodeLens(const CodeLensParams &,
+                    std::function<void(const QList<CodeLens> &)> partialResultHandler,
+                    std::function<void(const std::variant<QList<CodeLens>, std::nullptr_t> &)>
+                            responseHandler,
+                    ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
 
     void requestCodeLensResolve(
             const CodeLens &, std::function<void(const CodeLens &)> responseHandler,
@@ -315,6 +347,12 @@ public:
             std::function<void(const std::variant<QList<DocumentLink>, std::nullptr_t> &)>
                     responseHandler,
             ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
+    void requestDocumentLink(
+            const DocumentLinkParams &,
+            std::function<void(const QList<DocumentLink> &)> partialResultHandler,
+            std::function<void(const std::variant<QList<DocumentLink>, std::nullptr_t> &)>
+                    responseHandler,
+            ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
 
     void requestDocumentLinkResolve(
             const DocumentLink &, std::function<void(const DocumentLink &)> responseHandler,
@@ -326,11 +364,21 @@ public:
             const DocumentColorParams &,
             std::function<void(const QList<ColorInformation> &)> responseHandler,
             ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
+    void requestDocumentColor(
+            const DocumentColorParams &,
+            std::function<void(const QList<ColorInformation> &)> partialResultHandler,
+            std::function<void(const QList<ColorInformation> &)> responseHandler,
+            ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
 
     void requestColorPresentation(
             const ColorPresentationParams &,
             std::function<void(const QList<ColorPresentation> &)> responseHandler,
             ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
+    void requestColorPresentation(
+            const ColorPresentationParams &,
+            std::function<void(const QList<ColorPresentation> &)> partialResultHandler,
+            std::function<void(const QList<ColorPresentation> &)> responseHandler,
+            ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
 
     // ServerCapability::DocumentFormattingProvider
     // ClientCapability::TextDocumentFormatting
@@ -378,6 +426,12 @@ public:
             std::function<void(const std::variant<QList<FoldingRange>, std::nullptr_t> &)>
                     responseHandler,
             ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
+    void requestFoldingRange(
+            const FoldingRangeParams &,
+            std::function<void(const QList<FoldingRange> &)> partialResultHandler,
+            std::function<void(const std::variant<QList<FoldingRange>, std::nullptr_t> &)>
+                    responseHandler,
+            ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
 
     // ServerCapability::SelectionRangeProvider
     // ClientCapability::TextDocumentSelectionRange
@@ -386,6 +440,12 @@ public:
             std::function<void(const std::variant<QList<SelectionRange>, std::nullptr_t> &)>
                     responseHandler,
             ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
+    void requestSelectionRange(
+            const SelectionRangeParams &,
+            std::function<void(const QList<SelectionRange> &)> partialResultHandler,
+            std::function<void(const std::variant<QList<SelectionRange>, std::nullptr_t> &)>
+                    responseHandler,
+            ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
 
     // ServerCapability::CallHierarchyProvider
     // ClientCapability::TextDocumentCallHierarchy
@@ -401,12 +461,26 @@ public:
                     void(const std::variant<QList<CallHierarchyIncomingCall>, std::nullptr_t> &)>
                     responseHandler,
             ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
+    void requestCallHierarchyIncomingCalls(
+            const CallHierarchyIncomingCallsParams &,
+            std::function<void(const QList<CallHierarchyIncomingCall> &)> partialResultHandler,
+            std::function<
+                    void(const std::variant<QList<CallHierarchyIncomingCall>, std::nullptr_t> &)>
+                    responseHandler,
+            ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
     void requestCallHierarchyOutgoingCalls(
             const CallHierarchyOutgoingCallsParams &,
             std::function<
                     void(const std::variant<QList<CallHierarchyOutgoingCall>, std::nullptr_t> &)>
                     responseHandler,
             ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
+    void requestCallHierarchyOutgoingCalls(
+            const CallHierarchyOutgoingCallsParams &,
+            std::function<void(const QList<CallHierarchyOutgoingCall> &)> partialResultHandler,
+            std::function<
+                    void(const std::variant<QList<CallHierarchyOutgoingCall>, std::nullptr_t> &)>
+                    responseHandler,
+            ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
 
     // ServerCapability::SemanticTokensProvider
     // ClientCapability::TextDocumentSemanticTokens
@@ -445,205 +519,230 @@ public:
                    std::function<void(const std::variant<QList<Moniker>, std::nullptr_t> &)>
                            responseHandler,
                    ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
+    void
+    requestMoniker(const MonikerParams &,
+                   std::function<void(const QList<Moniker> &)> partialResultHandler,
+                   std::function<void(const std::variant<QList<Moniker>, std::nullptr_t> &)>
+                           responseHandler,
+                   ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
+
+    // ServerCapability::DiagnosticProvider
+    // ClientCapability::TextDocumentDiagnostic
+    void requestDocumentDiagnostic(
+            const DocumentDiagnosticParams &,
+            std::function<void(const std::variant<RelatedFullDocumentDiagnosticReport,
+                                                  RelatedUnchangedDocumentDiagnosticReport> &)>
+                    responseHandler,
+            ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
+
+    void requestWorkspaceDiagnostic(
+            const WorkspaceDiagnosticParams &,
+            std::function<void(const WorkspaceDiagnosticReport &)> responseHandler,
+            ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
+
+    // ClientCapability::WorkspaceDiagnostics
+    void requestDiagnosticRefresh(
+            const std::nullptr_t &, std::function<void()> responseHandler,
+            ResponseErrorHandler errorHandler = &ProtocolBase::defaultResponseErrorHandler);
 
     // # receive protocol
     void registerCancelNotificationHandler(
-            const std::function<void(const QByteArray &, const CancelParams &)> &handler);
+            const std::function<void(const QByteArray &, CancelParams)> &handler);
 
     // ClientCapability::GeneralRegularExpressions
 
     // ClientCapability::WorkspaceWorkspaceEdit
 
     void registerInitializeRequestHandler(
-            const std::function<void(const QByteArray &, const InitializeParams &,
+            const std::function<void(const QByteArray &, InitializeParams,
                                      LSPResponse<InitializeResult> &&)> &handler);
     void registerInitializedNotificationHandler(
-            const std::function<void(const QByteArray &, const InitializedParams &)> &handler);
+            const std::function<void(const QByteArray &, InitializedParams)> &handler);
     void registerShutdownRequestHandler(
-            const std::function<void(const QByteArray &, const std::nullptr_t &,
+            const std::function<void(const QByteArray &, std::nullptr_t,
                                      LSPResponse<std::nullptr_t> &&)> &handler);
     void registerExitNotificationHandler(
-            const std::function<void(const QByteArray &, const std::nullptr_t &)> &handler);
+            const std::function<void(const QByteArray &, std::nullptr_t)> &handler);
     void registerLogTraceNotificationHandler(
-            const std::function<void(const QByteArray &, const LogTraceParams &)> &handler);
+            const std::function<void(const QByteArray &, LogTraceParams)> &handler);
     void registerSetTraceNotificationHandler(
-            const std::function<void(const QByteArray &, const SetTraceParams &)> &handler);
+            const std::function<void(const QByteArray &, SetTraceParams)> &handler);
     void registerShowMessageNotificationHandler(
-            const std::function<void(const QByteArray &, const ShowMessageParams &)> &handler);
+            const std::function<void(const QByteArray &, ShowMessageParams)> &handler);
 
     // ClientCapability::WindowShowMessage
     void registerShowMessageRequestRequestHandler(
             const std::function<void(
-                    const QByteArray &, const ShowMessageRequestParams &,
+                    const QByteArray &, ShowMessageRequestParams,
                     LSPResponse<std::variant<MessageActionItem, std::nullptr_t>> &&)> &handler);
 
     // ClientCapability::WindowShowDocument
     void registerShowDocumentRequestHandler(
-            const std::function<void(const QByteArray &, const ShowDocumentParams &,
+            const std::function<void(const QByteArray &, ShowDocumentParams,
                                      LSPResponse<ShowDocumentResult> &&)> &handler);
 
     void registerLogMessageNotificationHandler(
-            const std::function<void(const QByteArray &, const LogMessageParams &)> &handler);
+            const std::function<void(const QByteArray &, LogMessageParams)> &handler);
     void registerWorkDoneProgressCreateRequestHandler(
-            const std::function<void(const QByteArray &, const WorkDoneProgressCreateParams &,
+            const std::function<void(const QByteArray &, WorkDoneProgressCreateParams,
                                      LSPResponse<std::nullptr_t> &&)> &handler);
     void registerWorkDoneProgressCancelNotificationHandler(
-            const std::function<void(const QByteArray &, const WorkDoneProgressCancelParams &)>
+            const std::function<void(const QByteArray &, WorkDoneProgressCancelParams)>
                     &handler);
     void registerTelemetryEventNotificationHandler(
-            const std::function<void(const QByteArray &, const QJsonObject &)> &handler);
+            const std::function<void(const QByteArray &, QJsonObject)> &handler);
     void registerRegistrationRequestHandler(
-            const std::function<void(const QByteArray &, const RegistrationParams &,
+            const std::function<void(const QByteArray &, RegistrationParams,
                                      LSPResponse<std::nullptr_t> &&)> &handler);
     void registerUnregistrationRequestHandler(
-            const std::function<void(const QByteArray &, const UnregistrationParams &,
+            const std::function<void(const QByteArray &, UnregistrationParams,
                                      LSPResponse<std::nullptr_t> &&)> &handler);
 
     // ServerCapability::WorkspaceWorkspaceFolders
     // ClientCapability::WorkspaceWorkspaceFolders
     void registerWorkspaceWorkspaceFoldersRequestHandler(
             const std::function<
-                    void(const QByteArray &, const std::nullptr_t &,
+                    void(const QByteArray &, std::nullptr_t,
                          LSPResponse<std::variant<QList<WorkspaceFolder>, std::nullptr_t>> &&)>
                     &handler);
 
     void registerDidChangeWorkspaceFoldersNotificationHandler(
-            const std::function<void(const QByteArray &, const DidChangeWorkspaceFoldersParams &)>
+            const std::function<void(const QByteArray &, DidChangeWorkspaceFoldersParams)>
                     &handler);
 
     // ClientCapability::WorkspaceDidChangeConfiguration
     void registerDidChangeConfigurationNotificationHandler(
-            const std::function<void(const QByteArray &, const DidChangeConfigurationParams &)>
+            const std::function<void(const QByteArray &, DidChangeConfigurationParams)>
                     &handler);
 
     // ClientCapability::WorkspaceConfiguration
     void registerConfigurationRequestHandler(
-            const std::function<void(const QByteArray &, const ConfigurationParams &,
+            const std::function<void(const QByteArray &, ConfigurationParams,
                                      LSPResponse<QList<QJsonValue>> &&)> &handler);
 
     // ClientCapability::WorkspaceDidChangeWatchedFiles
     void registerDidChangeWatchedFilesNotificationHandler(
-            const std::function<void(const QByteArray &, const DidChangeWatchedFilesParams &)>
+            const std::function<void(const QByteArray &, DidChangeWatchedFilesParams)>
                     &handler);
 
     // ServerCapability::WorkspaceSymbolProvider
     // ClientCapability::WorkspaceSymbol
     void registerWorkspaceSymbolRequestHandler(
             const std::function<
-                    void(const QByteArray &, const WorkspaceSymbolParams &,
+                    void(const QByteArray &, WorkspaceSymbolParams,
                          LSPPartialResponse<std::variant<QList<SymbolInformation>, std::nullptr_t>,
                                             QList<SymbolInformation>> &&)> &handler);
 
     // ServerCapability::ExecuteCommandProvider
     // ClientCapability::WorkspaceExecuteCommand
     void registerExecuteCommandRequestHandler(
-            const std::function<void(const QByteArray &, const ExecuteCommandParams &,
+            const std::function<void(const QByteArray &, ExecuteCommandParams,
                                      LSPResponse<std::variant<QJsonValue, std::nullptr_t>> &&)>
                     &handler);
 
     // ClientCapability::WorkspaceApplyEdit
     void registerApplyWorkspaceEditRequestHandler(
-            const std::function<void(const QByteArray &, const ApplyWorkspaceEditParams &,
+            const std::function<void(const QByteArray &, ApplyWorkspaceEditParams,
                                      LSPResponse<ApplyWorkspaceEditResponse> &&)> &handler);
 
     // ServerCapability::WorkspaceFileOperationsWillCreate
     // ClientCapability::WorkspaceFileOperationsWillCreate
     void registerCreateFilesRequestHandler(
-            const std::function<void(const QByteArray &, const CreateFilesParams &,
+            const std::function<void(const QByteArray &, CreateFilesParams,
                                      LSPResponse<std::variant<WorkspaceEdit, std::nullptr_t>> &&)>
                     &handler);
 
     // ServerCapability::WorkspaceFileOperationsDidCreate
     // ClientCapability::WorkspaceFileOperationsDidCreate
     void registerCreateFilesNotificationHandler(
-            const std::function<void(const QByteArray &, const CreateFilesParams &)> &handler);
+            const std::function<void(const QByteArray &, CreateFilesParams)> &handler);
 
     // ServerCapability::WorkspaceFileOperationsWillRename
     // ClientCapability::WorkspaceFileOperationsWillRename
     void registerRenameFilesRequestHandler(
-            const std::function<void(const QByteArray &, const RenameFilesParams &,
+            const std::function<void(const QByteArray &, RenameFilesParams,
                                      LSPResponse<std::variant<WorkspaceEdit, std::nullptr_t>> &&)>
                     &handler);
 
     // ServerCapability::WorkspaceFileOperationsDidRename
     // ClientCapability::WorkspaceFileOperationsDidRename
     void registerRenameFilesNotificationHandler(
-            const std::function<void(const QByteArray &, const RenameFilesParams &)> &handler);
+            const std::function<void(const QByteArray &, RenameFilesParams)> &handler);
 
     // ServerCapability::WorkspaceFileOperationsWillDelete
     // ClientCapability::WorkspaceFileOperationsWillDelete
     void registerDeleteFilesRequestHandler(
-            const std::function<void(const QByteArray &, const DeleteFilesParams &,
+            const std::function<void(const QByteArray &, DeleteFilesParams,
                                      LSPResponse<std::variant<WorkspaceEdit, std::nullptr_t>> &&)>
                     &handler);
 
     // ServerCapability::WorkspaceFileOperationsDidDelete
     // ClientCapability::WorkspaceFileOperationsDidDelete
     void registerDeleteFilesNotificationHandler(
-            const std::function<void(const QByteArray &, const DeleteFilesParams &)> &handler);
+            const std::function<void(const QByteArray &, DeleteFilesParams)> &handler);
 
     // ServerCapability::TextDocumentSync
     // ClientCapability::TextDocumentSynchronizationDynamicRegistration
 
     void registerDidOpenTextDocumentNotificationHandler(
-            const std::function<void(const QByteArray &, const DidOpenTextDocumentParams &)>
+            const std::function<void(const QByteArray &, DidOpenTextDocumentParams)>
                     &handler);
     void registerDidChangeTextDocumentNotificationHandler(
-            const std::function<void(const QByteArray &, const DidChangeTextDocumentParams &)>
+            const std::function<void(const QByteArray &, DidChangeTextDocumentParams)>
                     &handler);
 
     // ServerCapability::TextDocumentSyncWillSave
     // ClientCapability::TextDocumentSynchronizationWillSave
     void registerWillSaveTextDocumentNotificationHandler(
-            const std::function<void(const QByteArray &, const WillSaveTextDocumentParams &)>
+            const std::function<void(const QByteArray &, WillSaveTextDocumentParams)>
                     &handler);
 
     // ServerCapability::TextDocumentSyncWillSaveWaitUntil
     // ClientCapability::TextDocumentSynchronizationWillSaveWaitUntil
     void registerWillSaveTextDocumentRequestHandler(
-            const std::function<void(const QByteArray &, const WillSaveTextDocumentParams &,
+            const std::function<void(const QByteArray &, WillSaveTextDocumentParams,
                                      LSPResponse<std::variant<QList<TextEdit>, std::nullptr_t>> &&)>
                     &handler);
 
     // ServerCapability::TextDocumentSyncSave
     // ClientCapability::TextDocumentSynchronizationDidSave
     void registerDidSaveTextDocumentNotificationHandler(
-            const std::function<void(const QByteArray &, const DidSaveTextDocumentParams &)>
+            const std::function<void(const QByteArray &, DidSaveTextDocumentParams)>
                     &handler);
 
     void registerDidCloseTextDocumentNotificationHandler(
-            const std::function<void(const QByteArray &, const DidCloseTextDocumentParams &)>
+            const std::function<void(const QByteArray &, DidCloseTextDocumentParams)>
                     &handler);
 
     // ClientCapability::TextDocumentPublishDiagnostics
     void registerPublishDiagnosticsNotificationHandler(
-            const std::function<void(const QByteArray &, const PublishDiagnosticsParams &)>
+            const std::function<void(const QByteArray &, PublishDiagnosticsParams)>
                     &handler);
 
     // ServerCapability::CompletionProvider
     // ClientCapability::TextDocumentCompletion
     void registerCompletionRequestHandler(
             const std::function<void(
-                    const QByteArray &, const CompletionParams &,
+                    const QByteArray &, CompletionParams,
                     LSPPartialResponse<
                             std::variant<QList<CompletionItem>, CompletionList, std::nullptr_t>,
                             std::variant<CompletionList, QList<CompletionItem>>> &&)> &handler);
 
     void registerCompletionItemResolveRequestHandler(
-            const std::function<void(const QByteArray &, const CompletionItem &,
+            const std::function<void(const QByteArray &, CompletionItem,
                                      LSPResponse<CompletionItem> &&)> &handler);
 
     // ServerCapability::HoverProvider
     // ClientCapability::TextDocumentHover
     void registerHoverRequestHandler(
-            const std::function<void(const QByteArray &, const HoverParams &,
+            const std::function<void(const QByteArray &, HoverParams,
                                      LSPResponse<std::variant<Hover, std::nullptr_t>> &&)>
                     &handler);
 
     // ServerCapability::SignatureHelpProvider
     // ClientCapability::TextDocumentSignatureHelp
     void registerSignatureHelpRequestHandler(
-            const std::function<void(const QByteArray &, const SignatureHelpParams &,
+            const std::function<void(const QByteArray &, SignatureHelpParams,
                                      LSPResponse<std::variant<SignatureHelp, std::nullptr_t>> &&)>
                     &handler);
 
@@ -651,7 +750,7 @@ public:
     // ClientCapability::TextDocumentDeclaration
     void registerDeclarationRequestHandler(
             const std::function<
-                    void(const QByteArray &, const DeclarationParams &,
+                    void(const QByteArray &, DeclarationParams,
                          LSPPartialResponse<std::variant<Location, QList<Location>,
                                                          QList<LocationLink>, std::nullptr_t>,
                                             std::variant<QList<Location>, QList<LocationLink>>> &&)>
@@ -661,7 +760,7 @@ public:
     // ClientCapability::TextDocumentDefinition
     void registerDefinitionRequestHandler(
             const std::function<
-                    void(const QByteArray &, const DefinitionParams &,
+                    void(const QByteArray &, DefinitionParams,
                          LSPPartialResponse<std::variant<Location, QList<Location>,
                                                          QList<LocationLink>, std::nullptr_t>,
                                             std::variant<QList<Location>, QList<LocationLink>>> &&)>
@@ -671,7 +770,7 @@ public:
     // ClientCapability::TextDocumentTypeDefinition
     void registerTypeDefinitionRequestHandler(
             const std::function<
-                    void(const QByteArray &, const TypeDefinitionParams &,
+                    void(const QByteArray &, TypeDefinitionParams,
                          LSPPartialResponse<std::variant<Location, QList<Location>,
                                                          QList<LocationLink>, std::nullptr_t>,
                                             std::variant<QList<Location>, QList<LocationLink>>> &&)>
@@ -681,7 +780,7 @@ public:
     // ClientCapability::TextDocumentImplementation
     void registerImplementationRequestHandler(
             const std::function<
-                    void(const QByteArray &, const ImplementationParams &,
+                    void(const QByteArray &, ImplementationParams,
                          LSPPartialResponse<std::variant<Location, QList<Location>,
                                                          QList<LocationLink>, std::nullptr_t>,
                                             std::variant<QList<Location>, QList<LocationLink>>> &&)>
@@ -691,7 +790,7 @@ public:
     // ClientCapability::TextDocumentReferences
     void registerReferenceRequestHandler(
             const std::function<
-                    void(const QByteArray &, const ReferenceParams &,
+                    void(const QByteArray &, ReferenceParams,
                          LSPPartialResponse<std::variant<QList<Location>, std::nullptr_t>,
                                             QList<Location>> &&)> &handler);
 
@@ -699,7 +798,7 @@ public:
     // ClientCapability::TextDocumentDocumentHighlight
     void registerDocumentHighlightRequestHandler(
             const std::function<
-                    void(const QByteArray &, const DocumentHighlightParams &,
+                    void(const QByteArray &, DocumentHighlightParams,
                          LSPPartialResponse<std::variant<QList<DocumentHighlight>, std::nullptr_t>,
                                             QList<DocumentHighlight>> &&)> &handler);
 
@@ -707,7 +806,7 @@ public:
     // ClientCapability::TextDocumentDocumentSymbol
     void registerDocumentSymbolRequestHandler(
             const std::function<
-                    void(const QByteArray &, const DocumentSymbolParams &,
+                    void(const QByteArray &, DocumentSymbolParams,
                          LSPPartialResponse<std::variant<QList<DocumentSymbol>,
                                                          QList<SymbolInformation>, std::nullptr_t>,
                                             std::variant<QList<DocumentSymbol>,
@@ -717,88 +816,88 @@ public:
     // ClientCapability::TextDocumentCodeAction
     void registerCodeActionRequestHandler(
             const std::function<void(
-                    const QByteArray &, const CodeActionParams &,
+                    const QByteArray &, CodeActionParams,
                     LSPPartialResponse<
                             std::variant<QList<std::variant<Command, CodeAction>>, std::nullptr_t>,
                             QList<std::variant<Command, CodeAction>>> &&)> &handler);
 
     // ClientCapability::TextDocumentCodeActionResolveSupport
     void registerCodeActionResolveRequestHandler(
-            const std::function<void(const QByteArray &, const CodeAction &,
+            const std::function<void(const QByteArray &, CodeAction,
                                      LSPResponse<CodeAction> &&)> &handler);
 
     // ServerCapability::CodeLensProvider
     // ClientCapability::TextDocumentCodeLens
     void registerCodeLensRequestHandler(
             const std::function<
-                    void(const QByteArray &, const CodeLensParams &,
+                    void(const QByteArray &, CodeLensParams,
                          LSPPartialResponse<std::variant<QList<CodeLens>, std::nullptr_t>,
                                             QList<CodeLens>> &&)> &handler);
 
     void registerCodeLensResolveRequestHandler(
-            const std::function<void(const QByteArray &, const CodeLens &,
+            const std::function<void(const QByteArray &, CodeLens,
                                      LSPResponse<CodeLens> &&)> &handler);
 
     // ClientCapability::WorkspaceCodeLens
     void registerCodeLensRefreshRequestHandler(
-            const std::function<void(const QByteArray &, const std::nullptr_t &,
+            const std::function<void(const QByteArray &, std::nullptr_t,
                                      LSPResponse<std::nullptr_t> &&)> &handler);
 
     // ServerCapability::DocumentLinkProvider
     // ClientCapability::TextDocumentDocumentLink
     void registerDocumentLinkRequestHandler(
             const std::function<
-                    void(const QByteArray &, const DocumentLinkParams &,
+                    void(const QByteArray &, DocumentLinkParams,
                          LSPPartialResponse<std::variant<QList<DocumentLink>, std::nullptr_t>,
                                             QList<DocumentLink>> &&)> &handler);
 
     void registerDocumentLinkResolveRequestHandler(
-            const std::function<void(const QByteArray &, const DocumentLink &,
+            const std::function<void(const QByteArray &, DocumentLink,
                                      LSPResponse<DocumentLink> &&)> &handler);
 
     // ServerCapability::ColorProvider
     // ClientCapability::TextDocumentColorProvider
     void registerDocumentColorRequestHandler(
-            const std::function<void(const QByteArray &, const DocumentColorParams &,
+            const std::function<void(const QByteArray &, DocumentColorParams,
                                      LSPPartialResponse<QList<ColorInformation>,
                                                         QList<ColorInformation>> &&)> &handler);
 
     void registerColorPresentationRequestHandler(
-            const std::function<void(const QByteArray &, const ColorPresentationParams &,
+            const std::function<void(const QByteArray &, ColorPresentationParams,
                                      LSPPartialResponse<QList<ColorPresentation>,
                                                         QList<ColorPresentation>> &&)> &handler);
 
     // ServerCapability::DocumentFormattingProvider
     // ClientCapability::TextDocumentFormatting
     void registerDocumentFormattingRequestHandler(
-            const std::function<void(const QByteArray &, const DocumentFormattingParams &,
+            const std::function<void(const QByteArray &, DocumentFormattingParams,
                                      LSPResponse<std::variant<QList<TextEdit>, std::nullptr_t>> &&)>
                     &handler);
 
     // ServerCapability::DocumentRangeFormattingProvider
     // ClientCapability::TextDocumentRangeFormatting
     void registerDocumentRangeFormattingRequestHandler(
-            const std::function<void(const QByteArray &, const DocumentRangeFormattingParams &,
+            const std::function<void(const QByteArray &, DocumentRangeFormattingParams,
                                      LSPResponse<std::variant<QList<TextEdit>, std::nullptr_t>> &&)>
                     &handler);
 
     // ServerCapability::DocumentOnTypeFormattingProvider
     // ClientCapability::TextDocumentOnTypeFormatting
     void registerDocumentOnTypeFormattingRequestHandler(
-            const std::function<void(const QByteArray &, const DocumentOnTypeFormattingParams &,
+            const std::function<void(const QByteArray &, DocumentOnTypeFormattingParams,
                                      LSPResponse<std::variant<QList<TextEdit>, std::nullptr_t>> &&)>
                     &handler);
 
     // ServerCapability::RenameProvider
     // ClientCapability::TextDocumentRename
     void registerRenameRequestHandler(
-            const std::function<void(const QByteArray &, const RenameParams &,
+            const std::function<void(const QByteArray &, RenameParams,
                                      LSPResponse<std::variant<WorkspaceEdit, std::nullptr_t>> &&)>
                     &handler);
 
     void registerPrepareRenameRequestHandler(
             const std::function<
-                    void(const QByteArray &, const PrepareRenameParams &,
+                    void(const QByteArray &, PrepareRenameParams,
                          LSPResponse<std::variant<Range, RangePlaceHolder, DefaultBehaviorStruct,
                                                   std::nullptr_t>> &&)> &handler);
 
@@ -806,7 +905,7 @@ public:
     // ClientCapability::TextDocumentFoldingRange
     void registerFoldingRangeRequestHandler(
             const std::function<
-                    void(const QByteArray &, const FoldingRangeParams &,
+                    void(const QByteArray &, FoldingRangeParams,
                          LSPPartialResponse<std::variant<QList<FoldingRange>, std::nullptr_t>,
                                             QList<FoldingRange>> &&)> &handler);
 
@@ -814,7 +913,7 @@ public:
     // ClientCapability::TextDocumentSelectionRange
     void registerSelectionRangeRequestHandler(
             const std::function<
-                    void(const QByteArray &, const SelectionRangeParams &,
+                    void(const QByteArray &, SelectionRangeParams,
                          LSPPartialResponse<std::variant<QList<SelectionRange>, std::nullptr_t>,
                                             QList<SelectionRange>> &&)> &handler);
 
@@ -822,19 +921,19 @@ public:
     // ClientCapability::TextDocumentCallHierarchy
     void registerCallHierarchyPrepareRequestHandler(
             const std::function<
-                    void(const QByteArray &, const CallHierarchyPrepareParams &,
+                    void(const QByteArray &, CallHierarchyPrepareParams,
                          LSPResponse<std::variant<QList<CallHierarchyItem>, std::nullptr_t>> &&)>
                     &handler);
 
     void registerCallHierarchyIncomingCallsRequestHandler(
             const std::function<
-                    void(const QByteArray &, const CallHierarchyIncomingCallsParams &,
+                    void(const QByteArray &, CallHierarchyIncomingCallsParams,
                          LSPPartialResponse<
                                  std::variant<QList<CallHierarchyIncomingCall>, std::nullptr_t>,
                                  QList<CallHierarchyIncomingCall>> &&)> &handler);
     void registerCallHierarchyOutgoingCallsRequestHandler(
             const std::function<
-                    void(const QByteArray &, const CallHierarchyOutgoingCallsParams &,
+                    void(const QByteArray &, CallHierarchyOutgoingCallsParams,
                          LSPPartialResponse<
                                  std::variant<QList<CallHierarchyOutgoingCall>, std::nullptr_t>,
                                  QList<CallHierarchyOutgoingCall>> &&)> &handler);
@@ -843,39 +942,59 @@ public:
     // ClientCapability::TextDocumentSemanticTokens
     void registerSemanticTokensRequestHandler(
             const std::function<
-                    void(const QByteArray &, const SemanticTokensParams &,
+                    void(const QByteArray &, SemanticTokensParams,
                          LSPPartialResponse<std::variant<SemanticTokens, std::nullptr_t>,
                                             SemanticTokensPartialResult> &&)> &handler);
     void registerSemanticTokensDeltaRequestHandler(
             const std::function<
-                    void(const QByteArray &, const SemanticTokensDeltaParams &,
+                    void(const QByteArray &, SemanticTokensDeltaParams,
                          LSPPartialResponse<
                                  std::variant<SemanticTokens, SemanticTokensDelta, std::nullptr_t>,
                                  SemanticTokensDeltaPartialResult> &&)> &handler);
     void registerSemanticTokensRangeRequestHandler(
             const std::function<
-                    void(const QByteArray &, const SemanticTokensRangeParams &,
+                    void(const QByteArray &, SemanticTokensRangeParams,
                          LSPPartialResponse<std::variant<SemanticTokens, std::nullptr_t>,
                                             SemanticTokensPartialResult> &&)> &handler);
 
     // ClientCapability::WorkspaceSemanticTokens
     void registerRequestingARefreshOfAllSemanticTokensRequestHandler(
-            const std::function<void(const QByteArray &, const std::nullptr_t &,
+            const std::function<void(const QByteArray &, std::nullptr_t,
                                      LSPResponse<std::nullptr_t> &&)> &handler);
 
     // ServerCapability::LinkedEditingRangeProvider
     void registerLinkedEditingRangeRequestHandler(
             const std::function<void(
-                    const QByteArray &, const LinkedEditingRangeParams &,
+                    const QByteArray &, LinkedEditingRangeParams,
                     LSPResponse<std::variant<LinkedEditingRanges, std::nullptr_t>> &&)> &handler);
 
     // ServerCapability::MonikerProvider
     void registerMonikerRequestHandler(
             const std::function<void(
-                    const QByteArray &, const MonikerParams &,
+                    const QByteArray &, MonikerParams,
                     LSPPartialResponse<std::variant<QList<Moniker>, std::nullptr_t>, QList<Moniker>>
                             &&)> &handler);
 
+    // ServerCapability::DiagnosticProvider
+    // ClientCapability::TextDocumentDiagnostic
+    void registerDocumentDiagnosticRequestHandler(
+            const std::function<void(
+                    const QByteArray &, DocumentDiagnosticParams,
+                    LSPPartialResponse<std::variant<RelatedFullDocumentDiagnosticReport,
+                                                    RelatedUnchangedDocumentDiagnosticReport>,
+                                       DocumentDiagnosticReportPartialResult> &&)> &handler);
+
+    void registerWorkspaceDiagnosticRequestHandler(
+            const std::function<void(const QByteArray &, WorkspaceDiagnosticParams,
+                                     LSPPartialResponse<WorkspaceDiagnosticReport,
+                                                        WorkspaceDiagnosticReportPartialResult> &&)>
+                    &handler);
+
+    // ClientCapability::WorkspaceDiagnostics
+    void registerDiagnosticRefreshRequestHandler(
+            const std::function<void(const QByteArray &, std::nullptr_t,
+                                     LSPResponse<std::nullptr_t> &&)> &handler);
+
 private:
     Q_DISABLE_COPY(ProtocolGen)
     Q_DECLARE_PRIVATE(ProtocolGen)
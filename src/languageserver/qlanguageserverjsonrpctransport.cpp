@@ -36,11 +36,16 @@ QLanguageServerJsonRpcTransport::QLanguageServerJsonRpcTransport() noexcept
 
 void QLanguageServerJsonRpcTransport::sendMessage(const QJsonDocument &packet)
 {
-    const QByteArray content = packet.toJson(QJsonDocument::Compact);
+    sendRawMessage(packet.toJson(QJsonDocument::Compact));
+}
+
+void QLanguageServerJsonRpcTransport::sendRawMessage(const QByteArray &content)
+{
     if (auto handler = dataHandler()) {
         // send all data in one go, this way if handler is threadsafe the whole sendMessage is
         // threadsafe
         QByteArray msg;
+        msg.reserve(content.size() + 64);
         msg.append(s_contentLengthFieldName);
         msg.append(s_fieldSeparator);
         msg.append(QByteArray::number(content.size()));
@@ -78,6 +83,9 @@ void QLanguageServerJsonRpcTransport::hasHeader(const QByteArray &fieldName,
 
 void QLanguageServerJsonRpcTransport::hasBody(const QByteArray &body)
 {
+    if (auto handler = rawMessageHandler(); handler && handler(body))
+        return;
+
     QJsonParseError error = { 0, QJsonParseError::NoError };
     const QJsonDocument doc = QJsonDocument::fromJson(body, &error);
 
@@ -26,6 +26,7 @@ class Q_LANGUAGESERVER_EXPORT QLanguageServerJsonRpcTransport : public QJsonRpcT
 public:
     QLanguageServerJsonRpcTransport() noexcept;
     void sendMessage(const QJsonDocument &packet) override;
+    void sendRawMessage(const QByteArray &content) override;
     void receiveData(const QByteArray &data) override;
 
 private:
@@ -21,6 +21,7 @@
 #include <QtCore/QMetaEnum>
 #include <QtCore/QString>
 
+#include <optional>
 #include <variant>
 #include <type_traits>
 
@@ -38,8 +39,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "language", language);
-        field(w, "value", value);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "language", "value" };
+        field(w, fieldNames[0], language);
+        field(w, fieldNames[1], value);
     }
 };
 
@@ -67,6 +69,45 @@ public:
     }
 };
 
+template<typename T, typename = void>
+struct HasPartialResultToken : std::false_type
+{
+};
+
+template<typename T>
+struct HasPartialResultToken<T, std::void_t<decltype(std::declval<T>().partialResultToken)>>
+    : std::true_type
+{
+};
+
+template<typename T, typename = void>
+struct HasWorkDoneToken : std::false_type
+{
+};
+
+template<typename T>
+struct HasWorkDoneToken<T, std::void_t<decltype(std::declval<T>().workDoneToken)>>
+    : std::true_type
+{
+};
+
+// the params of a $/progress notification, value is the partial result or the work done progress
+template<typename T>
+class ProgressNotificationParams
+{
+public:
+    ProgressToken token = {};
+    T value = {};
+
+    template<typename W>
+    void walk(W &w)
+    {
+        static constexpr QTypedJson::FieldName fieldNames[] = { "token", "value" };
+        field(w, fieldNames[0], token);
+        field(w, fieldNames[1], value);
+    }
+};
+
 template<typename RType, typename PRType>
 class LSPPartialResponse : public LSPResponse<RType>
 {
@@ -80,11 +121,35 @@ public:
 
     LSPPartialResponse(QJsonRpc::TypedResponse &&r) : LSPResponse<RType>(std::move(r)) { }
 
-    void sendPartialResponse(const PRType &r)
+    // called by TypedRpc before the handler gets the response
+    template<typename Req>
+    void initFromRequest(const Req &request)
     {
+        if constexpr (HasPartialResultToken<Req>::value)
+            m_partialResultToken = request.partialResultToken;
+    }
+
+    // the client accepts partial results only if it sent a partialResultToken
+    const std::optional<ProgressToken> &partialResultToken() const { return m_partialResultToken; }
+    void setPartialResultToken(const std::optional<ProgressToken> &token)
+    {
+        m_partialResultToken = token;
+    }
+
+    // returns false (and sends nothing) if the request had no partialResultToken, in that
+    // case the whole result has to be sent with sendResponse
+    bool sendPartialResponse(const PRType &r)
+    {
+        if (!m_partialResultToken)
+            return false;
         // using Notifications::Progress here would require to split out the *RequestType aliases
-        sendNotification("$/progress", r);
+        this->sendNotification("$/progress",
+                               ProgressNotificationParams<PRType> { *m_partialResultToken, r });
+        return true;
     }
+
+private:
+    std::optional<ProgressToken> m_partialResultToken;
 };
 
 } // namespace QLspSpecification
@@ -5,6 +5,7 @@
 #include <QtLanguageServer/private/qlanguageserverprotocol_p.h>
 #include <QtLanguageServer/private/qlanguageservergen_p_p.h>
 
+#include <QtCore/qjsondocument.h>
 #include <QtCore/qjsonobject.h>
 
 #include <memory>
@@ -35,10 +36,18 @@ You have to provide a function to send the data that the protocol
 generates to the constructor, and you have to feed the data you
 receive to it via the receivedData method.
 
-Limitations: for the client use case (Creator),the handling of partial
-results could be improved. A clean solution should handle the progress
-notification, do some extra tracking and give the partial results back
-to the call that did the request.
+For the client use case (Creator), requests whose partial results are
+lists have a requestXX overload taking also a partialResultHandler.
+It sets a partialResultToken in the request (unless one is already set),
+passes each partial result received with a $/progress notification to
+the partialResultHandler, and gives all partial results, followed by the
+final result, to the responseHandler.
+
+The handler registered with registerInitializeRequestHandler() is called
+after the position encoding has been negotiated with the client, among
+the supportedPositionEncodings(). It is then available as
+positionEncoding(), for example to set it in a QLspDocumentStore, and
+the protocol sets it in the capabilities of the result.
 */
 
 QLanguageServerProtocol::QLanguageServerProtocol(const QJsonRpcTransport::DataHandler &sender)
@@ -61,4 +70,51 @@ void QLanguageServerProtocol::receiveData(const QByteArray &data)
     transport()->receiveData(data);
 }
 
+QList<QLspPositionEncoding> QLanguageServerProtocol::supportedPositionEncodings() const
+{
+    return d_ptr->supportedPositionEncodings;
+}
+
+void QLanguageServerProtocol::setSupportedPositionEncodings(
+        const QList<QLspPositionEncoding> &encodings)
+{
+    d_ptr->supportedPositionEncodings = encodings;
+}
+
+QLspPositionEncoding QLanguageServerProtocol::positionEncoding() const
+{
+    return d_ptr->positionEncoding;
+}
+
+void QLanguageServerProtocol::registerInitializeRequestHandler(
+        const std::function<void(const QByteArray &, InitializeParams,
+                                 LSPResponse<InitializeResult> &&)> &handler)
+{
+    if (!handler) {
+        ProtocolGen::registerInitializeRequestHandler(handler);
+        return;
+    }
+    ProtocolGen::registerInitializeRequestHandler(
+            [this, handler](const QByteArray &method, InitializeParams params,
+                            LSPResponse<InitializeResult> &&response) {
+                const QLspPositionEncoding encoding = qLspNegotiatePositionEncoding(
+                        params.capabilities, d_ptr->supportedPositionEncodings);
+                d_ptr->positionEncoding = encoding;
+                // UTF-16 is the default, and is sent only if the handler set an encoding
+                response.setResultTextFilter([encoding](const QByteArray &resultText) {
+                    QJsonObject result = QJsonDocument::fromJson(resultText).object();
+                    QJsonObject capabilities = result[u"capabilities"_s].toObject();
+                    if (encoding == QLspPositionEncoding::Utf16
+                        && !capabilities.contains(u"positionEncoding"_s)) {
+                        return resultText;
+                    }
+                    capabilities.insert(u"positionEncoding"_s,
+                                        QString::fromUtf8(qLspPositionEncodingName(encoding)));
+                    result.insert(u"capabilities"_s, capabilities);
+                    return QJsonDocument(result).toJson(QJsonDocument::Compact);
+                });
+                handler(method, std::move(params), std::move(response));
+            });
+}
+
 QT_END_NAMESPACE
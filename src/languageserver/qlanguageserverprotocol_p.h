@@ -17,6 +17,7 @@
 #include <QtLanguageServer/qtlanguageserverglobal.h>
 #include <QtLanguageServer/private/qlanguageserverspec_p.h>
 #include <QtLanguageServer/private/qlanguageservergen_p.h>
+#include <QtLanguageServer/private/qlsppositionencoding_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -25,6 +26,18 @@ class Q_LANGUAGESERVER_EXPORT QLanguageServerProtocol : public QLspSpecification
 public:
     QLanguageServerProtocol(const QJsonRpcTransport::DataHandler &sender);
     void receiveData(const QByteArray &data);
+
+    // the encodings of positions the server supports, from the preferred one
+    QList<QLspPositionEncoding> supportedPositionEncodings() const;
+    void setSupportedPositionEncodings(const QList<QLspPositionEncoding> &encodings);
+    // negotiated by the initialize request, UTF-16 before it
+    QLspPositionEncoding positionEncoding() const;
+
+    // negotiates the position encoding before calling handler, and sets it in the result
+    void registerInitializeRequestHandler(
+            const std::function<void(const QByteArray &, QLspSpecification::InitializeParams,
+                                     QLspSpecification::LSPResponse<
+                                             QLspSpecification::InitializeResult> &&)> &handler);
 };
 
 QT_END_NAMESPACE
@@ -120,6 +120,10 @@ constexpr auto TextDocumentSemanticTokens = "textDocument.semanticTokens";
 using TextDocumentSemanticTokensType = SemanticTokensClientCapabilities;
 constexpr auto WorkspaceSemanticTokens = "workspace.semanticTokens";
 using WorkspaceSemanticTokensType = SemanticTokensWorkspaceClientCapabilities;
+constexpr auto TextDocumentDiagnostic = "textDocument.diagnostic";
+using TextDocumentDiagnosticType = DiagnosticClientCapabilities;
+constexpr auto WorkspaceDiagnostics = "workspace.diagnostics";
+using WorkspaceDiagnosticsType = DiagnosticWorkspaceClientCapabilities;
 }
 
 namespace ServerCapabilitiesInfo {
@@ -206,6 +210,8 @@ using LinkedEditingRangeProviderType =
         std::variant<bool, LinkedEditingRangeOptions, LinkedEditingRangeRegistrationOptions>;
 constexpr auto MonikerProvider = "monikerProvider";
 using MonikerProviderType = std::variant<bool, MonikerOptions, MonikerRegistrationOptions>;
+constexpr auto DiagnosticProvider = "diagnosticProvider";
+using DiagnosticProviderType = std::variant<DiagnosticOptions, DiagnosticRegistrationOptions>;
 }
 
 namespace Requests {
@@ -313,6 +319,12 @@ constexpr auto LinkedEditingRangeMethod = "textDocument/linkedEditingRange";
 using LinkedEditingRangeParamsType = LinkedEditingRangeParams;
 constexpr auto MonikerMethod = "textDocument/moniker";
 using MonikerParamsType = MonikerParams;
+constexpr auto DocumentDiagnosticMethod = "textDocument/diagnostic";
+using DocumentDiagnosticParamsType = DocumentDiagnosticParams;
+constexpr auto WorkspaceDiagnosticMethod = "workspace/diagnostic";
+using WorkspaceDiagnosticParamsType = WorkspaceDiagnosticParams;
+constexpr auto DiagnosticRefreshMethod = "workspace/diagnostic/refresh";
+using DiagnosticRefreshParamsType = std::nullptr_t;
 }
 
 namespace Responses {
@@ -474,6 +486,17 @@ using LinkedEditingRangeResponseType = LSPResponse<LinkedEditingRangeResultType>
 using MonikerResultType = std::variant<QList<Moniker>, std::nullptr_t>;
 using MonikerPartialResultType = QList<Moniker>;
 using MonikerResponseType = LSPPartialResponse<MonikerResultType, MonikerPartialResultType>;
+using DocumentDiagnosticResultType =
+        std::variant<RelatedFullDocumentDiagnosticReport, RelatedUnchangedDocumentDiagnosticReport>;
+using DocumentDiagnosticPartialResultType = DocumentDiagnosticReportPartialResult;
+using DocumentDiagnosticResponseType =
+        LSPPartialResponse<DocumentDiagnosticResultType, DocumentDiagnosticPartialResultType>;
+using WorkspaceDiagnosticResultType = WorkspaceDiagnosticReport;
+using WorkspaceDiagnosticPartialResultType = WorkspaceDiagnosticReportPartialResult;
+using WorkspaceDiagnosticResponseType =
+        LSPPartialResponse<WorkspaceDiagnosticResultType, WorkspaceDiagnosticPartialResultType>;
+using DiagnosticRefreshResultType = std::nullptr_t;
+using DiagnosticRefreshResponseType = LSPResponse<DiagnosticRefreshResultType>;
 }
 
 namespace Notifications {
@@ -535,7 +558,8 @@ using RequestParams = std::variant<
         RenameParams, PrepareRenameParams, FoldingRangeParams, SelectionRangeParams,
         CallHierarchyPrepareParams, CallHierarchyIncomingCallsParams,
         CallHierarchyOutgoingCallsParams, SemanticTokensParams, SemanticTokensDeltaParams,
-        SemanticTokensRangeParams, LinkedEditingRangeParams, MonikerParams, QJsonValue>;
+        SemanticTokensRangeParams, LinkedEditingRangeParams, MonikerParams,
+        DocumentDiagnosticParams, WorkspaceDiagnosticParams, QJsonValue>;
 using NotificationParams = std::variant<
         CancelParams, InitializedParams, std::nullptr_t, LogTraceParams, SetTraceParams,
         ShowMessageParams, LogMessageParams, WorkDoneProgressCancelParams, QJsonObject,
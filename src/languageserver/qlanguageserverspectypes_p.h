@@ -20,8 +20,10 @@
 #include <QtLanguageServer/qtlanguageserverglobal.h>
 #include <QtLanguageServer/private/qlanguageserverprespectypes_p.h>
 #include <QtJsonRpc/private/qtypedjson_p.h>
+#include <QtJsonRpc/private/qtypedjsonlazy_p.h>
 #include <QtCore/QByteArray>
 #include <QtCore/QList>
+#include <QtCore/QMap>
 #include <QtCore/QJsonValue>
 #include <QtCore/QJsonObject>
 #include <QtCore/QString>
@@ -261,9 +263,10 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "code", code);
-        field(w, "message", message);
-        field(w, "data", data);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "code", "message", "data" };
+        field(w, fieldNames[0], code);
+        field(w, fieldNames[1], message);
+        field(w, fieldNames[2], data);
     }
 };
 
@@ -275,7 +278,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "id", id);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "id" };
+        field(w, fieldNames[0], id);
     }
 };
 
@@ -288,8 +292,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "engine", engine);
-        field(w, "version", version);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "engine", "version" };
+        field(w, fieldNames[0], engine);
+        field(w, fieldNames[1], version);
     }
 };
 
@@ -302,8 +307,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "line", line);
-        field(w, "character", character);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "line", "character" };
+        field(w, fieldNames[0], line);
+        field(w, fieldNames[1], character);
     }
 };
 
@@ -316,8 +322,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "start", start);
-        field(w, "end", end);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "start", "end" };
+        field(w, fieldNames[0], start);
+        field(w, fieldNames[1], end);
     }
 };
 
@@ -331,9 +338,10 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "range", range);
-        field(w, "rangeLength", rangeLength);
-        field(w, "text", text);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "range", "rangeLength", "text" };
+        field(w, fieldNames[0], range);
+        field(w, fieldNames[1], rangeLength);
+        field(w, fieldNames[2], text);
     }
 };
 
@@ -363,8 +371,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "range", range);
-        field(w, "parent", parent);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "range", "parent" };
+        field(w, fieldNames[0], range);
+        field(w, fieldNames[1], parent);
     }
 };
 
@@ -377,8 +386,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "range", range);
-        field(w, "placeholder", placeholder);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "range", "placeholder" };
+        field(w, fieldNames[0], range);
+        field(w, fieldNames[1], placeholder);
     }
 };
 
@@ -390,7 +400,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "defaultBehavior", defaultBehavior);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "defaultBehavior" };
+        field(w, fieldNames[0], defaultBehavior);
     }
 };
 class Q_LANGUAGESERVER_EXPORT Location
@@ -402,8 +413,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "uri", uri);
-        field(w, "range", range);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "uri", "range" };
+        field(w, fieldNames[0], uri);
+        field(w, fieldNames[1], range);
     }
 };
 
@@ -418,10 +430,13 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "originSelectionRange", originSelectionRange);
-        field(w, "targetUri", targetUri);
-        field(w, "targetRange", targetRange);
-        field(w, "targetSelectionRange", targetSelectionRange);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "originSelectionRange", "targetUri", "targetRange", "targetSelectionRange"
+        };
+        field(w, fieldNames[0], originSelectionRange);
+        field(w, fieldNames[1], targetUri);
+        field(w, fieldNames[2], targetRange);
+        field(w, fieldNames[3], targetSelectionRange);
     }
 };
 
@@ -434,8 +449,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "location", location);
-        field(w, "message", message);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "location", "message" };
+        field(w, fieldNames[0], location);
+        field(w, fieldNames[1], message);
     }
 };
 
@@ -447,7 +463,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "href", href);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "href" };
+        field(w, fieldNames[0], href);
     }
 };
 
@@ -467,15 +484,19 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "range", range);
-        field(w, "severity", severity);
-        field(w, "code", code);
-        field(w, "codeDescription", codeDescription);
-        field(w, "source", source);
-        field(w, "message", message);
-        field(w, "tags", tags);
-        field(w, "relatedInformation", relatedInformation);
-        field(w, "data", data);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "range", "severity", "code", "codeDescription", "source", "message", "tags",
+            "relatedInformation", "data"
+        };
+        field(w, fieldNames[0], range);
+        field(w, fieldNames[1], severity);
+        field(w, fieldNames[2], code);
+        field(w, fieldNames[3], codeDescription);
+        field(w, fieldNames[4], source);
+        field(w, fieldNames[5], message);
+        field(w, fieldNames[6], tags);
+        field(w, fieldNames[7], relatedInformation);
+        field(w, fieldNames[8], data);
     }
 };
 
@@ -489,9 +510,10 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "title", title);
-        field(w, "command", command);
-        field(w, "arguments", arguments);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "title", "command", "arguments" };
+        field(w, fieldNames[0], title);
+        field(w, fieldNames[1], command);
+        field(w, fieldNames[2], arguments);
     }
 };
 
@@ -504,8 +526,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "range", range);
-        field(w, "newText", newText);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "range", "newText" };
+        field(w, fieldNames[0], range);
+        field(w, fieldNames[1], newText);
     }
 };
 
@@ -519,9 +542,12 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "label", label);
-        field(w, "needsConfirmation", needsConfirmation);
-        field(w, "description", description);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "label", "needsConfirmation", "description"
+        };
+        field(w, fieldNames[0], label);
+        field(w, fieldNames[1], needsConfirmation);
+        field(w, fieldNames[2], description);
     }
 };
 
@@ -534,7 +560,8 @@ public:
     void walk(W &w)
     {
         TextEdit::walk(w);
-        field(w, "annotationId", annotationId);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "annotationId" };
+        field(w, fieldNames[0], annotationId);
     }
 };
 
@@ -546,7 +573,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "uri", uri);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "uri" };
+        field(w, fieldNames[0], uri);
     }
 };
 
@@ -560,7 +588,8 @@ public:
     void walk(W &w)
     {
         TextDocumentIdentifier::walk(w);
-        field(w, "version", version);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "version" };
+        field(w, fieldNames[0], version);
     }
 };
 
@@ -573,8 +602,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "textDocument", textDocument);
-        field(w, "edits", edits);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "textDocument", "edits" };
+        field(w, fieldNames[0], textDocument);
+        field(w, fieldNames[1], edits);
     }
 };
 
@@ -587,8 +617,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "overwrite", overwrite);
-        field(w, "ignoreIfExists", ignoreIfExists);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "overwrite", "ignoreIfExists" };
+        field(w, fieldNames[0], overwrite);
+        field(w, fieldNames[1], ignoreIfExists);
     }
 };
 
@@ -599,14 +630,18 @@ public:
     QByteArray uri = {};
     std::optional<CreateFileOptions> options = {};
     std::optional<QByteArray> annotationId = {};
+    static constexpr QTypedJson::Discriminator jsonDiscriminator = { "kind", "create" };
 
     template<typename W>
     void walk(W &w)
     {
-        field(w, "kind", kind);
-        field(w, "uri", uri);
-        field(w, "options", options);
-        field(w, "annotationId", annotationId);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "kind", "uri", "options", "annotationId"
+        };
+        field(w, fieldNames[0], kind);
+        field(w, fieldNames[1], uri);
+        field(w, fieldNames[2], options);
+        field(w, fieldNames[3], annotationId);
     }
 };
 
@@ -619,8 +654,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "overwrite", overwrite);
-        field(w, "ignoreIfExists", ignoreIfExists);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "overwrite", "ignoreIfExists" };
+        field(w, fieldNames[0], overwrite);
+        field(w, fieldNames[1], ignoreIfExists);
     }
 };
 
@@ -632,15 +668,19 @@ public:
     QByteArray newUri = {};
     std::optional<RenameFileOptions> options = {};
     std::optional<QByteArray> annotationId = {};
+    static constexpr QTypedJson::Discriminator jsonDiscriminator = { "kind", "rename" };
 
     template<typename W>
     void walk(W &w)
     {
-        field(w, "kind", kind);
-        field(w, "oldUri", oldUri);
-        field(w, "newUri", newUri);
-        field(w, "options", options);
-        field(w, "annotationId", annotationId);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "kind", "oldUri", "newUri", "options", "annotationId"
+        };
+        field(w, fieldNames[0], kind);
+        field(w, fieldNames[1], oldUri);
+        field(w, fieldNames[2], newUri);
+        field(w, fieldNames[3], options);
+        field(w, fieldNames[4], annotationId);
     }
 };
 
@@ -653,8 +693,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "recursive", recursive);
-        field(w, "ignoreIfNotExists", ignoreIfNotExists);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "recursive", "ignoreIfNotExists" };
+        field(w, fieldNames[0], recursive);
+        field(w, fieldNames[1], ignoreIfNotExists);
     }
 };
 
@@ -665,14 +706,18 @@ public:
     QByteArray uri = {};
     std::optional<DeleteFileOptions> options = {};
     std::optional<QByteArray> annotationId = {};
+    static constexpr QTypedJson::Discriminator jsonDiscriminator = { "kind", "delete" };
 
     template<typename W>
     void walk(W &w)
     {
-        field(w, "kind", kind);
-        field(w, "uri", uri);
-        field(w, "options", options);
-        field(w, "annotationId", annotationId);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "kind", "uri", "options", "annotationId"
+        };
+        field(w, fieldNames[0], kind);
+        field(w, fieldNames[1], uri);
+        field(w, fieldNames[2], options);
+        field(w, fieldNames[3], annotationId);
     }
 };
 
@@ -687,9 +732,12 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "changes", changes);
-        field(w, "documentChanges", documentChanges);
-        field(w, "changeAnnotations", changeAnnotations);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "changes", "documentChanges", "changeAnnotations"
+        };
+        field(w, fieldNames[0], changes);
+        field(w, fieldNames[1], documentChanges);
+        field(w, fieldNames[2], changeAnnotations);
     }
 };
 
@@ -705,11 +753,15 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "documentChanges", documentChanges);
-        field(w, "resourceOperations", resourceOperations);
-        field(w, "failureHandling", failureHandling);
-        field(w, "normalizesLineEndings", normalizesLineEndings);
-        field(w, "changeAnnotationSupport", changeAnnotationSupport);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "documentChanges", "resourceOperations", "failureHandling", "normalizesLineEndings",
+            "changeAnnotationSupport"
+        };
+        field(w, fieldNames[0], documentChanges);
+        field(w, fieldNames[1], resourceOperations);
+        field(w, fieldNames[2], failureHandling);
+        field(w, fieldNames[3], normalizesLineEndings);
+        field(w, fieldNames[4], changeAnnotationSupport);
     }
 };
 
@@ -724,10 +776,13 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "uri", uri);
-        field(w, "languageId", languageId);
-        field(w, "version", version);
-        field(w, "text", text);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "uri", "languageId", "version", "text"
+        };
+        field(w, fieldNames[0], uri);
+        field(w, fieldNames[1], languageId);
+        field(w, fieldNames[2], version);
+        field(w, fieldNames[3], text);
     }
 };
 
@@ -740,7 +795,8 @@ public:
     void walk(W &w)
     {
         TextDocumentIdentifier::walk(w);
-        field(w, "version", version);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "version" };
+        field(w, fieldNames[0], version);
     }
 };
 
@@ -753,8 +809,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "textDocument", textDocument);
-        field(w, "position", position);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "textDocument", "position" };
+        field(w, fieldNames[0], textDocument);
+        field(w, fieldNames[1], position);
     }
 };
 
@@ -768,9 +825,10 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "language", language);
-        field(w, "scheme", scheme);
-        field(w, "pattern", pattern);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "language", "scheme", "pattern" };
+        field(w, fieldNames[0], language);
+        field(w, fieldNames[1], scheme);
+        field(w, fieldNames[2], pattern);
     }
 };
 
@@ -784,7 +842,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "id", id);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "id" };
+        field(w, fieldNames[0], id);
     }
 };
 
@@ -796,7 +855,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "documentSelector", documentSelector);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "documentSelector" };
+        field(w, fieldNames[0], documentSelector);
     }
 };
 
@@ -809,8 +869,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "kind", kind);
-        field(w, "value", value);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "kind", "value" };
+        field(w, fieldNames[0], kind);
+        field(w, fieldNames[1], value);
     }
 };
 
@@ -823,8 +884,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "parser", parser);
-        field(w, "version", version);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "parser", "version" };
+        field(w, fieldNames[0], parser);
+        field(w, fieldNames[1], version);
     }
 };
 
@@ -836,15 +898,19 @@ public:
     std::optional<bool> cancellable = {};
     std::optional<QByteArray> message = {};
     std::optional<int> percentage = {};
+    static constexpr QTypedJson::Discriminator jsonDiscriminator = { "kind", "begin" };
 
     template<typename W>
     void walk(W &w)
     {
-        field(w, "kind", kind);
-        field(w, "title", title);
-        field(w, "cancellable", cancellable);
-        field(w, "message", message);
-        field(w, "percentage", percentage);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "kind", "title", "cancellable", "message", "percentage"
+        };
+        field(w, fieldNames[0], kind);
+        field(w, fieldNames[1], title);
+        field(w, fieldNames[2], cancellable);
+        field(w, fieldNames[3], message);
+        field(w, fieldNames[4], percentage);
     }
 };
 
@@ -855,14 +921,18 @@ public:
     std::optional<bool> cancellable = {};
     std::optional<QByteArray> message = {};
     std::optional<int> percentage = {};
+    static constexpr QTypedJson::Discriminator jsonDiscriminator = { "kind", "report" };
 
     template<typename W>
     void walk(W &w)
     {
-        field(w, "kind", kind);
-        field(w, "cancellable", cancellable);
-        field(w, "message", message);
-        field(w, "percentage", percentage);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "kind", "cancellable", "message", "percentage"
+        };
+        field(w, fieldNames[0], kind);
+        field(w, fieldNames[1], cancellable);
+        field(w, fieldNames[2], message);
+        field(w, fieldNames[3], percentage);
     }
 };
 
@@ -871,12 +941,14 @@ class Q_LANGUAGESERVER_EXPORT WorkDoneProgressEnd
 public:
     QByteArray kind = {};
     std::optional<QByteArray> message = {};
+    static constexpr QTypedJson::Discriminator jsonDiscriminator = { "kind", "end" };
 
     template<typename W>
     void walk(W &w)
     {
-        field(w, "kind", kind);
-        field(w, "message", message);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "kind", "message" };
+        field(w, fieldNames[0], kind);
+        field(w, fieldNames[1], message);
     }
 };
 
@@ -888,7 +960,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "workDoneToken", workDoneToken);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "workDoneToken" };
+        field(w, fieldNames[0], workDoneToken);
     }
 };
 
@@ -900,7 +973,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "workDoneProgress", workDoneProgress);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "workDoneProgress" };
+        field(w, fieldNames[0], workDoneProgress);
     }
 };
 
@@ -912,7 +986,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "partialResultToken", partialResultToken);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "partialResultToken" };
+        field(w, fieldNames[0], partialResultToken);
     }
 };
 
@@ -927,10 +1002,13 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
-        field(w, "willSave", willSave);
-        field(w, "willSaveWaitUntil", willSaveWaitUntil);
-        field(w, "didSave", didSave);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "dynamicRegistration", "willSave", "willSaveWaitUntil", "didSave"
+        };
+        field(w, fieldNames[0], dynamicRegistration);
+        field(w, fieldNames[1], willSave);
+        field(w, fieldNames[2], willSaveWaitUntil);
+        field(w, fieldNames[3], didSave);
     }
 };
 
@@ -946,11 +1024,15 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "relatedInformation", relatedInformation);
-        field(w, "tagSupport", tagSupport);
-        field(w, "versionSupport", versionSupport);
-        field(w, "codeDescriptionSupport", codeDescriptionSupport);
-        field(w, "dataSupport", dataSupport);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "relatedInformation", "tagSupport", "versionSupport", "codeDescriptionSupport",
+            "dataSupport"
+        };
+        field(w, fieldNames[0], relatedInformation);
+        field(w, fieldNames[1], tagSupport);
+        field(w, fieldNames[2], versionSupport);
+        field(w, fieldNames[3], codeDescriptionSupport);
+        field(w, fieldNames[4], dataSupport);
     }
 };
 
@@ -965,10 +1047,13 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
-        field(w, "completionItem", completionItem);
-        field(w, "completionItemKind", completionItemKind);
-        field(w, "contextSupport", contextSupport);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "dynamicRegistration", "completionItem", "completionItemKind", "contextSupport"
+        };
+        field(w, fieldNames[0], dynamicRegistration);
+        field(w, fieldNames[1], completionItem);
+        field(w, fieldNames[2], completionItemKind);
+        field(w, fieldNames[3], contextSupport);
     }
 };
 
@@ -981,8 +1066,11 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
-        field(w, "contentFormat", contentFormat);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "dynamicRegistration", "contentFormat"
+        };
+        field(w, fieldNames[0], dynamicRegistration);
+        field(w, fieldNames[1], contentFormat);
     }
 };
 
@@ -996,9 +1084,12 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
-        field(w, "signatureInformation", signatureInformation);
-        field(w, "contextSupport", contextSupport);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "dynamicRegistration", "signatureInformation", "contextSupport"
+        };
+        field(w, fieldNames[0], dynamicRegistration);
+        field(w, fieldNames[1], signatureInformation);
+        field(w, fieldNames[2], contextSupport);
     }
 };
 
@@ -1011,8 +1102,11 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
-        field(w, "linkSupport", linkSupport);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "dynamicRegistration", "linkSupport"
+        };
+        field(w, fieldNames[0], dynamicRegistration);
+        field(w, fieldNames[1], linkSupport);
     }
 };
 
@@ -1025,8 +1119,11 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
-        field(w, "linkSupport", linkSupport);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "dynamicRegistration", "linkSupport"
+        };
+        field(w, fieldNames[0], dynamicRegistration);
+        field(w, fieldNames[1], linkSupport);
     }
 };
 
@@ -1039,8 +1136,11 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
-        field(w, "linkSupport", linkSupport);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "dynamicRegistration", "linkSupport"
+        };
+        field(w, fieldNames[0], dynamicRegistration);
+        field(w, fieldNames[1], linkSupport);
     }
 };
 
@@ -1053,8 +1153,11 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
-        field(w, "linkSupport", linkSupport);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "dynamicRegistration", "linkSupport"
+        };
+        field(w, fieldNames[0], dynamicRegistration);
+        field(w, fieldNames[1], linkSupport);
     }
 };
 
@@ -1066,7 +1169,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "dynamicRegistration" };
+        field(w, fieldNames[0], dynamicRegistration);
     }
 };
 
@@ -1078,7 +1182,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "dynamicRegistration" };
+        field(w, fieldNames[0], dynamicRegistration);
     }
 };
 
@@ -1094,11 +1199,15 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
-        field(w, "symbolKind", symbolKind);
-        field(w, "hierarchicalDocumentSymbolSupport", hierarchicalDocumentSymbolSupport);
-        field(w, "tagSupport", tagSupport);
-        field(w, "labelSupport", labelSupport);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "dynamicRegistration", "symbolKind", "hierarchicalDocumentSymbolSupport", "tagSupport",
+            "labelSupport"
+        };
+        field(w, fieldNames[0], dynamicRegistration);
+        field(w, fieldNames[1], symbolKind);
+        field(w, fieldNames[2], hierarchicalDocumentSymbolSupport);
+        field(w, fieldNames[3], tagSupport);
+        field(w, fieldNames[4], labelSupport);
     }
 };
 
@@ -1116,13 +1225,17 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
-        field(w, "codeActionLiteralSupport", codeActionLiteralSupport);
-        field(w, "isPreferredSupport", isPreferredSupport);
-        field(w, "disabledSupport", disabledSupport);
-        field(w, "dataSupport", dataSupport);
-        field(w, "resolveSupport", resolveSupport);
-        field(w, "honorsChangeAnnotations", honorsChangeAnnotations);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "dynamicRegistration", "codeActionLiteralSupport", "isPreferredSupport",
+            "disabledSupport", "dataSupport", "resolveSupport", "honorsChangeAnnotations"
+        };
+        field(w, fieldNames[0], dynamicRegistration);
+        field(w, fieldNames[1], codeActionLiteralSupport);
+        field(w, fieldNames[2], isPreferredSupport);
+        field(w, fieldNames[3], disabledSupport);
+        field(w, fieldNames[4], dataSupport);
+        field(w, fieldNames[5], resolveSupport);
+        field(w, fieldNames[6], honorsChangeAnnotations);
     }
 };
 
@@ -1134,7 +1247,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "dynamicRegistration" };
+        field(w, fieldNames[0], dynamicRegistration);
     }
 };
 
@@ -1147,8 +1261,11 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
-        field(w, "tooltipSupport", tooltipSupport);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "dynamicRegistration", "tooltipSupport"
+        };
+        field(w, fieldNames[0], dynamicRegistration);
+        field(w, fieldNames[1], tooltipSupport);
     }
 };
 
@@ -1160,7 +1277,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "dynamicRegistration" };
+        field(w, fieldNames[0], dynamicRegistration);
     }
 };
 
@@ -1172,7 +1290,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "dynamicRegistration" };
+        field(w, fieldNames[0], dynamicRegistration);
     }
 };
 
@@ -1184,7 +1303,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "dynamicRegistration" };
+        field(w, fieldNames[0], dynamicRegistration);
     }
 };
 
@@ -1196,7 +1316,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "dynamicRegistration" };
+        field(w, fieldNames[0], dynamicRegistration);
     }
 };
 
@@ -1211,10 +1332,14 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
-        field(w, "prepareSupport", prepareSupport);
-        field(w, "prepareSupportDefaultBehavior", prepareSupportDefaultBehavior);
-        field(w, "honorsChangeAnnotations", honorsChangeAnnotations);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "dynamicRegistration", "prepareSupport", "prepareSupportDefaultBehavior",
+            "honorsChangeAnnotations"
+        };
+        field(w, fieldNames[0], dynamicRegistration);
+        field(w, fieldNames[1], prepareSupport);
+        field(w, fieldNames[2], prepareSupportDefaultBehavior);
+        field(w, fieldNames[3], honorsChangeAnnotations);
     }
 };
 
@@ -1228,9 +1353,12 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
-        field(w, "rangeLimit", rangeLimit);
-        field(w, "lineFoldingOnly", lineFoldingOnly);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "dynamicRegistration", "rangeLimit", "lineFoldingOnly"
+        };
+        field(w, fieldNames[0], dynamicRegistration);
+        field(w, fieldNames[1], rangeLimit);
+        field(w, fieldNames[2], lineFoldingOnly);
     }
 };
 
@@ -1242,7 +1370,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "dynamicRegistration" };
+        field(w, fieldNames[0], dynamicRegistration);
     }
 };
 
@@ -1254,7 +1383,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "dynamicRegistration" };
+        field(w, fieldNames[0], dynamicRegistration);
     }
 };
 
@@ -1272,8 +1402,9 @@ public:
         template<typename W>
         void walk(W &w)
         {
-            field(w, "range", range);
-            field(w, "full", full);
+            static constexpr QTypedJson::FieldName fieldNames[] = { "range", "full" };
+            field(w, fieldNames[0], range);
+            field(w, fieldNames[1], full);
         }
     };
 
@@ -1287,13 +1418,17 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
-        field(w, "requests", requests);
-        field(w, "tokenTypes", tokenTypes);
-        field(w, "tokenModifiers", tokenModifiers);
-        field(w, "formats", formats);
-        field(w, "overlappingTokenSupport", overlappingTokenSupport);
-        field(w, "multilineTokenSupport", multilineTokenSupport);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "dynamicRegistration", "requests", "tokenTypes", "tokenModifiers", "formats",
+            "overlappingTokenSupport", "multilineTokenSupport"
+        };
+        field(w, fieldNames[0], dynamicRegistration);
+        field(w, fieldNames[1], requests);
+        field(w, fieldNames[2], tokenTypes);
+        field(w, fieldNames[3], tokenModifiers);
+        field(w, fieldNames[4], formats);
+        field(w, fieldNames[5], overlappingTokenSupport);
+        field(w, fieldNames[6], multilineTokenSupport);
     }
 };
 
@@ -1305,7 +1440,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "dynamicRegistration" };
+        field(w, fieldNames[0], dynamicRegistration);
     }
 };
 
@@ -1317,7 +1453,25 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "dynamicRegistration" };
+        field(w, fieldNames[0], dynamicRegistration);
+    }
+};
+
+class Q_LANGUAGESERVER_EXPORT DiagnosticClientCapabilities
+{
+public:
+    std::optional<bool> dynamicRegistration = {};
+    std::optional<bool> relatedDocumentSupport = {};
+
+    template<typename W>
+    void walk(W &w)
+    {
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "dynamicRegistration", "relatedDocumentSupport"
+        };
+        field(w, fieldNames[0], dynamicRegistration);
+        field(w, fieldNames[1], relatedDocumentSupport);
     }
 };
 
@@ -1350,36 +1504,46 @@ public:
     std::optional<CallHierarchyClientCapabilities> callHierarchy = {};
     std::optional<SemanticTokensClientCapabilities> semanticTokens = {};
     std::optional<MonikerClientCapabilities> moniker = {};
-
-    template<typename W>
-    void walk(W &w)
-    {
-        field(w, "synchronization", synchronization);
-        field(w, "completion", completion);
-        field(w, "hover", hover);
-        field(w, "signatureHelp", signatureHelp);
-        field(w, "declaration", declaration);
-        field(w, "definition", definition);
-        field(w, "typeDefinition", typeDefinition);
-        field(w, "implementation", implementation);
-        field(w, "references", references);
-        field(w, "documentHighlight", documentHighlight);
-        field(w, "documentSymbol", documentSymbol);
-        field(w, "codeAction", codeAction);
-        field(w, "codeLens", codeLens);
-        field(w, "documentLink", documentLink);
-        field(w, "colorProvider", colorProvider);
-        field(w, "formatting", formatting);
-        field(w, "rangeFormatting", rangeFormatting);
-        field(w, "onTypeFormatting", onTypeFormatting);
-        field(w, "rename", rename);
-        field(w, "publishDiagnostics", publishDiagnostics);
-        field(w, "foldingRange", foldingRange);
-        field(w, "selectionRange", selectionRange);
-        field(w, "linkedEditingRange", linkedEditingRange);
-        field(w, "callHierarchy", callHierarchy);
-        field(w, "semanticTokens", semanticTokens);
-        field(w, "moniker", moniker);
+    std::optional<DiagnosticClientCapabilities> diagnostic = {};
+
+    template<typename W>
+    void walk(W &w)
+    {
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "synchronization", "completion", "hover", "signatureHelp", "declaration", "definition",
+            "typeDefinition", "implementation", "references", "documentHighlight", "documentSymbol",
+            "codeAction", "codeLens", "documentLink", "colorProvider", "formatting",
+            "rangeFormatting", "onTypeFormatting", "rename", "publishDiagnostics", "foldingRange",
+            "selectionRange", "linkedEditingRange", "callHierarchy", "semanticTokens", "moniker",
+            "diagnostic"
+        };
+        field(w, fieldNames[0], synchronization);
+        field(w, fieldNames[1], completion);
+        field(w, fieldNames[2], hover);
+        field(w, fieldNames[3], signatureHelp);
+        field(w, fieldNames[4], declaration);
+        field(w, fieldNames[5], definition);
+        field(w, fieldNames[6], typeDefinition);
+        field(w, fieldNames[7], implementation);
+        field(w, fieldNames[8], references);
+        field(w, fieldNames[9], documentHighlight);
+        field(w, fieldNames[10], documentSymbol);
+        field(w, fieldNames[11], codeAction);
+        field(w, fieldNames[12], codeLens);
+        field(w, fieldNames[13], documentLink);
+        field(w, fieldNames[14], colorProvider);
+        field(w, fieldNames[15], formatting);
+        field(w, fieldNames[16], rangeFormatting);
+        field(w, fieldNames[17], onTypeFormatting);
+        field(w, fieldNames[18], rename);
+        field(w, fieldNames[19], publishDiagnostics);
+        field(w, fieldNames[20], foldingRange);
+        field(w, fieldNames[21], selectionRange);
+        field(w, fieldNames[22], linkedEditingRange);
+        field(w, fieldNames[23], callHierarchy);
+        field(w, fieldNames[24], semanticTokens);
+        field(w, fieldNames[25], moniker);
+        field(w, fieldNames[26], diagnostic);
     }
 };
 
@@ -1391,7 +1555,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "messageActionItem", messageActionItem);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "messageActionItem" };
+        field(w, fieldNames[0], messageActionItem);
     }
 };
 
@@ -1403,7 +1568,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "support", support);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "support" };
+        field(w, fieldNames[0], support);
     }
 };
 
@@ -1415,8 +1581,35 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "dynamicRegistration" };
+        field(w, fieldNames[0], dynamicRegistration);
+    }
+};
+
+class Q_LANGUAGESERVER_EXPORT GeneralClientCapabilities
+{
+public:
+    std::optional<RegularExpressionsClientCapabilities> regularExpressions = {};
+    std::optional<MarkdownClientCapabilities> markdown = {};
+    std::optional<QList<QByteArray>> positionEncodings = {};
+    QJsonObject extraFields;
+
+    template<typename W>
+    void walk(W &w)
+    {
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "regularExpressions", "markdown", "positionEncodings"
+        };
+        field(w, fieldNames[0], regularExpressions);
+        field(w, fieldNames[1], markdown);
+        field(w, fieldNames[2], positionEncodings);
     }
+    template<typename W>
+    void walkExtra(W &w)
+    {
+        w.handleExtras(extraFields);
+    }
+    void setExtraFields(const QJsonObject &e) { extraFields = e; }
 };
 
 class Q_LANGUAGESERVER_EXPORT ClientCapabilities
@@ -1425,17 +1618,20 @@ public:
     std::optional<QJsonObject> workspace = {};
     std::optional<TextDocumentClientCapabilities> textDocument = {};
     std::optional<QJsonObject> window = {};
-    std::optional<QJsonObject> general = {};
+    std::optional<GeneralClientCapabilities> general = {};
     std::optional<QJsonValue> experimental = {};
 
     template<typename W>
     void walk(W &w)
     {
-        field(w, "workspace", workspace);
-        field(w, "textDocument", textDocument);
-        field(w, "window", window);
-        field(w, "general", general);
-        field(w, "experimental", experimental);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "workspace", "textDocument", "window", "general", "experimental"
+        };
+        field(w, fieldNames[0], workspace);
+        field(w, fieldNames[1], textDocument);
+        field(w, fieldNames[2], window);
+        field(w, fieldNames[3], general);
+        field(w, fieldNames[4], experimental);
     }
 };
 
@@ -1448,8 +1644,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "uri", uri);
-        field(w, "name", name);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "uri", "name" };
+        field(w, fieldNames[0], uri);
+        field(w, fieldNames[1], name);
     }
 };
 
@@ -1462,7 +1659,7 @@ public:
     std::optional<std::variant<QByteArray, std::nullptr_t>> rootPath = nullptr;
     std::variant<QByteArray, std::nullptr_t> rootUri = nullptr;
     std::optional<QJsonValue> initializationOptions = {};
-    ClientCapabilities capabilities = {};
+    QTypedJson::Lazy<ClientCapabilities> capabilities = {};
     std::optional<TraceValue> trace = {};
     std::optional<std::variant<QList<WorkspaceFolder>, std::nullptr_t>> workspaceFolders = nullptr;
 
@@ -1470,15 +1667,19 @@ public:
     void walk(W &w)
     {
         WorkDoneProgressParams::walk(w);
-        field(w, "processId", processId);
-        field(w, "clientInfo", clientInfo);
-        field(w, "locale", locale);
-        field(w, "rootPath", rootPath);
-        field(w, "rootUri", rootUri);
-        field(w, "initializationOptions", initializationOptions);
-        field(w, "capabilities", capabilities);
-        field(w, "trace", trace);
-        field(w, "workspaceFolders", workspaceFolders);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "processId", "clientInfo", "locale", "rootPath", "rootUri", "initializationOptions",
+            "capabilities", "trace", "workspaceFolders"
+        };
+        field(w, fieldNames[0], processId);
+        field(w, fieldNames[1], clientInfo);
+        field(w, fieldNames[2], locale);
+        field(w, fieldNames[3], rootPath);
+        field(w, fieldNames[4], rootUri);
+        field(w, fieldNames[5], initializationOptions);
+        field(w, fieldNames[6], capabilities);
+        field(w, fieldNames[7], trace);
+        field(w, fieldNames[8], workspaceFolders);
     }
 };
 
@@ -1491,8 +1692,11 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "supported", supported);
-        field(w, "changeNotifications", changeNotifications);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "supported", "changeNotifications"
+        };
+        field(w, fieldNames[0], supported);
+        field(w, fieldNames[1], changeNotifications);
     }
 };
 
@@ -1515,7 +1719,8 @@ public:
     void walk(W &w)
     {
         WorkDoneProgressOptions::walk(w);
-        field(w, "commands", commands);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "commands" };
+        field(w, fieldNames[0], commands);
     }
 };
 
@@ -1527,7 +1732,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "ignoreCase", ignoreCase);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "ignoreCase" };
+        field(w, fieldNames[0], ignoreCase);
     }
 };
 
@@ -1541,9 +1747,10 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "glob", glob);
-        field(w, "matches", matches);
-        field(w, "options", options);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "glob", "matches", "options" };
+        field(w, fieldNames[0], glob);
+        field(w, fieldNames[1], matches);
+        field(w, fieldNames[2], options);
     }
 };
 
@@ -1556,8 +1763,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "scheme", scheme);
-        field(w, "pattern", pattern);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "scheme", "pattern" };
+        field(w, fieldNames[0], scheme);
+        field(w, fieldNames[1], pattern);
     }
 };
 
@@ -1569,7 +1777,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "filters", filters);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "filters" };
+        field(w, fieldNames[0], filters);
     }
 };
 
@@ -1582,8 +1791,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "openClose", openClose);
-        field(w, "change", change);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "openClose", "change" };
+        field(w, fieldNames[0], openClose);
+        field(w, fieldNames[1], change);
     }
 };
 
@@ -1598,9 +1808,12 @@ public:
     void walk(W &w)
     {
         WorkDoneProgressOptions::walk(w);
-        field(w, "triggerCharacters", triggerCharacters);
-        field(w, "allCommitCharacters", allCommitCharacters);
-        field(w, "resolveProvider", resolveProvider);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "triggerCharacters", "allCommitCharacters", "resolveProvider"
+        };
+        field(w, fieldNames[0], triggerCharacters);
+        field(w, fieldNames[1], allCommitCharacters);
+        field(w, fieldNames[2], resolveProvider);
     }
 };
 
@@ -1624,8 +1837,11 @@ public:
     void walk(W &w)
     {
         WorkDoneProgressOptions::walk(w);
-        field(w, "triggerCharacters", triggerCharacters);
-        field(w, "retriggerCharacters", retriggerCharacters);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "triggerCharacters", "retriggerCharacters"
+        };
+        field(w, fieldNames[0], triggerCharacters);
+        field(w, fieldNames[1], retriggerCharacters);
     }
 };
 
@@ -1639,9 +1855,10 @@ public:
     }
 };
 
-class Q_LANGUAGESERVER_EXPORT DeclarationRegistrationOptions : public DeclarationOptions,
-                                                               TextDocumentRegistrationOptions,
-                                                               StaticRegistrationOptions
+class Q_LANGUAGESERVER_EXPORT DeclarationRegistrationOptions
+    : public DeclarationOptions,
+      public TextDocumentRegistrationOptions,
+      public StaticRegistrationOptions
 {
 public:
     template<typename W>
@@ -1675,8 +1892,8 @@ public:
 
 class Q_LANGUAGESERVER_EXPORT TypeDefinitionRegistrationOptions
     : public TextDocumentRegistrationOptions,
-      TypeDefinitionOptions,
-      StaticRegistrationOptions
+      public TypeDefinitionOptions,
+      public StaticRegistrationOptions
 {
 public:
     template<typename W>
@@ -1700,8 +1917,8 @@ public:
 
 class Q_LANGUAGESERVER_EXPORT ImplementationRegistrationOptions
     : public TextDocumentRegistrationOptions,
-      ImplementationOptions,
-      StaticRegistrationOptions
+      public ImplementationOptions,
+      public StaticRegistrationOptions
 {
 public:
     template<typename W>
@@ -1742,7 +1959,8 @@ public:
     void walk(W &w)
     {
         WorkDoneProgressOptions::walk(w);
-        field(w, "label", label);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "label" };
+        field(w, fieldNames[0], label);
     }
 };
 
@@ -1756,8 +1974,11 @@ public:
     void walk(W &w)
     {
         WorkDoneProgressOptions::walk(w);
-        field(w, "codeActionKinds", codeActionKinds);
-        field(w, "resolveProvider", resolveProvider);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "codeActionKinds", "resolveProvider"
+        };
+        field(w, fieldNames[0], codeActionKinds);
+        field(w, fieldNames[1], resolveProvider);
     }
 };
 
@@ -1770,7 +1991,8 @@ public:
     void walk(W &w)
     {
         WorkDoneProgressOptions::walk(w);
-        field(w, "resolveProvider", resolveProvider);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "resolveProvider" };
+        field(w, fieldNames[0], resolveProvider);
     }
 };
 
@@ -1783,7 +2005,8 @@ public:
     void walk(W &w)
     {
         WorkDoneProgressOptions::walk(w);
-        field(w, "resolveProvider", resolveProvider);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "resolveProvider" };
+        field(w, fieldNames[0], resolveProvider);
     }
 };
 
@@ -1799,8 +2022,8 @@ public:
 
 class Q_LANGUAGESERVER_EXPORT DocumentColorRegistrationOptions
     : public TextDocumentRegistrationOptions,
-      StaticRegistrationOptions,
-      DocumentColorOptions
+      public StaticRegistrationOptions,
+      public DocumentColorOptions
 {
 public:
     template<typename W>
@@ -1841,8 +2064,11 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "firstTriggerCharacter", firstTriggerCharacter);
-        field(w, "moreTriggerCharacter", moreTriggerCharacter);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "firstTriggerCharacter", "moreTriggerCharacter"
+        };
+        field(w, fieldNames[0], firstTriggerCharacter);
+        field(w, fieldNames[1], moreTriggerCharacter);
     }
 };
 
@@ -1855,7 +2081,8 @@ public:
     void walk(W &w)
     {
         WorkDoneProgressOptions::walk(w);
-        field(w, "prepareProvider", prepareProvider);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "prepareProvider" };
+        field(w, fieldNames[0], prepareProvider);
     }
 };
 
@@ -1871,8 +2098,8 @@ public:
 
 class Q_LANGUAGESERVER_EXPORT FoldingRangeRegistrationOptions
     : public TextDocumentRegistrationOptions,
-      FoldingRangeOptions,
-      StaticRegistrationOptions
+      public FoldingRangeOptions,
+      public StaticRegistrationOptions
 {
 public:
     template<typename W>
@@ -1894,9 +2121,10 @@ public:
     }
 };
 
-class Q_LANGUAGESERVER_EXPORT SelectionRangeRegistrationOptions : public SelectionRangeOptions,
-                                                                  TextDocumentRegistrationOptions,
-                                                                  StaticRegistrationOptions
+class Q_LANGUAGESERVER_EXPORT SelectionRangeRegistrationOptions
+    : public SelectionRangeOptions,
+      public TextDocumentRegistrationOptions,
+      public StaticRegistrationOptions
 {
 public:
     template<typename W>
@@ -1920,8 +2148,8 @@ public:
 
 class Q_LANGUAGESERVER_EXPORT CallHierarchyRegistrationOptions
     : public TextDocumentRegistrationOptions,
-      CallHierarchyOptions,
-      StaticRegistrationOptions
+      public CallHierarchyOptions,
+      public StaticRegistrationOptions
 {
 public:
     template<typename W>
@@ -1942,8 +2170,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "tokenTypes", tokenTypes);
-        field(w, "tokenModifiers", tokenModifiers);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "tokenTypes", "tokenModifiers" };
+        field(w, fieldNames[0], tokenTypes);
+        field(w, fieldNames[1], tokenModifiers);
     }
 };
 
@@ -1958,16 +2187,17 @@ public:
     void walk(W &w)
     {
         WorkDoneProgressOptions::walk(w);
-        field(w, "legend", legend);
-        field(w, "range", range);
-        field(w, "full", full);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "legend", "range", "full" };
+        field(w, fieldNames[0], legend);
+        field(w, fieldNames[1], range);
+        field(w, fieldNames[2], full);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT SemanticTokensRegistrationOptions
     : public TextDocumentRegistrationOptions,
-      SemanticTokensOptions,
-      StaticRegistrationOptions
+      public SemanticTokensOptions,
+      public StaticRegistrationOptions
 {
 public:
     template<typename W>
@@ -1991,8 +2221,8 @@ public:
 
 class Q_LANGUAGESERVER_EXPORT LinkedEditingRangeRegistrationOptions
     : public TextDocumentRegistrationOptions,
-      LinkedEditingRangeOptions,
-      StaticRegistrationOptions
+      public LinkedEditingRangeOptions,
+      public StaticRegistrationOptions
 {
 public:
     template<typename W>
@@ -2015,7 +2245,7 @@ public:
 };
 
 class Q_LANGUAGESERVER_EXPORT MonikerRegistrationOptions : public TextDocumentRegistrationOptions,
-                                                           MonikerOptions
+                                                           public MonikerOptions
 {
 public:
     template<typename W>
@@ -2026,6 +2256,41 @@ public:
     }
 };
 
+class Q_LANGUAGESERVER_EXPORT DiagnosticOptions : public WorkDoneProgressOptions
+{
+public:
+    std::optional<QByteArray> identifier = {};
+    bool interFileDependencies = {};
+    bool workspaceDiagnostics = {};
+
+    template<typename W>
+    void walk(W &w)
+    {
+        WorkDoneProgressOptions::walk(w);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "identifier", "interFileDependencies", "workspaceDiagnostics"
+        };
+        field(w, fieldNames[0], identifier);
+        field(w, fieldNames[1], interFileDependencies);
+        field(w, fieldNames[2], workspaceDiagnostics);
+    }
+};
+
+class Q_LANGUAGESERVER_EXPORT DiagnosticRegistrationOptions
+    : public TextDocumentRegistrationOptions,
+      public DiagnosticOptions,
+      public StaticRegistrationOptions
+{
+public:
+    template<typename W>
+    void walk(W &w)
+    {
+        TextDocumentRegistrationOptions::walk(w);
+        DiagnosticOptions::walk(w);
+        StaticRegistrationOptions::walk(w);
+    }
+};
+
 class Q_LANGUAGESERVER_EXPORT ServerCapabilities
 {
 public:
@@ -2071,39 +2336,56 @@ public:
     std::optional<std::variant<bool, WorkspaceSymbolOptions>> workspaceSymbolProvider = {};
     std::optional<QJsonObject> workspace = {};
     std::optional<QJsonValue> experimental = {};
-
-    template<typename W>
-    void walk(W &w)
-    {
-        field(w, "textDocumentSync", textDocumentSync);
-        field(w, "completionProvider", completionProvider);
-        field(w, "hoverProvider", hoverProvider);
-        field(w, "signatureHelpProvider", signatureHelpProvider);
-        field(w, "declarationProvider", declarationProvider);
-        field(w, "definitionProvider", definitionProvider);
-        field(w, "typeDefinitionProvider", typeDefinitionProvider);
-        field(w, "implementationProvider", implementationProvider);
-        field(w, "referencesProvider", referencesProvider);
-        field(w, "documentHighlightProvider", documentHighlightProvider);
-        field(w, "documentSymbolProvider", documentSymbolProvider);
-        field(w, "codeActionProvider", codeActionProvider);
-        field(w, "codeLensProvider", codeLensProvider);
-        field(w, "documentLinkProvider", documentLinkProvider);
-        field(w, "colorProvider", colorProvider);
-        field(w, "documentFormattingProvider", documentFormattingProvider);
-        field(w, "documentRangeFormattingProvider", documentRangeFormattingProvider);
-        field(w, "documentOnTypeFormattingProvider", documentOnTypeFormattingProvider);
-        field(w, "renameProvider", renameProvider);
-        field(w, "foldingRangeProvider", foldingRangeProvider);
-        field(w, "executeCommandProvider", executeCommandProvider);
-        field(w, "selectionRangeProvider", selectionRangeProvider);
-        field(w, "linkedEditingRangeProvider", linkedEditingRangeProvider);
-        field(w, "callHierarchyProvider", callHierarchyProvider);
-        field(w, "semanticTokensProvider", semanticTokensProvider);
-        field(w, "monikerProvider", monikerProvider);
-        field(w, "workspaceSymbolProvider", workspaceSymbolProvider);
-        field(w, "workspace", workspace);
-        field(w, "experimental", experimental);
+    std::optional<QByteArray> positionEncoding = {};
+    std::optional<std::variant<DiagnosticOptions, DiagnosticRegistrationOptions>>
+            diagnosticProvider = {};
+
+    template<typename W>
+    void walk(W &w)
+    {
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "textDocumentSync", "completionProvider", "hoverProvider", "signatureHelpProvider",
+            "declarationProvider", "definitionProvider", "typeDefinitionProvider",
+            "implementationProvider", "referencesProvider", "documentHighlightProvider",
+            "documentSymbolProvider", "codeActionProvider", "codeLensProvider",
+            "documentLinkProvider", "colorProvider", "documentFormattingProvider",
+            "documentRangeFormattingProvider", "documentOnTypeFormattingProvider", "renameProvider",
+            "foldingRangeProvider", "executeCommandProvider", "selectionRangeProvider",
+            "linkedEditingRangeProvider", "callHierarchyProvider", "semanticTokensProvider",
+            "monikerProvider", "workspaceSymbolProvider", "workspace", "experimental",
+            "positionEncoding", "diagnosticProvider"
+        };
+        field(w, fieldNames[0], textDocumentSync);
+        field(w, fieldNames[1], completionProvider);
+        field(w, fieldNames[2], hoverProvider);
+        field(w, fieldNames[3], signatureHelpProvider);
+        field(w, fieldNames[4], declarationProvider);
+        field(w, fieldNames[5], definitionProvider);
+        field(w, fieldNames[6], typeDefinitionProvider);
+        field(w, fieldNames[7], implementationProvider);
+        field(w, fieldNames[8], referencesProvider);
+        field(w, fieldNames[9], documentHighlightProvider);
+        field(w, fieldNames[10], documentSymbolProvider);
+        field(w, fieldNames[11], codeActionProvider);
+        field(w, fieldNames[12], codeLensProvider);
+        field(w, fieldNames[13], documentLinkProvider);
+        field(w, fieldNames[14], colorProvider);
+        field(w, fieldNames[15], documentFormattingProvider);
+        field(w, fieldNames[16], documentRangeFormattingProvider);
+        field(w, fieldNames[17], documentOnTypeFormattingProvider);
+        field(w, fieldNames[18], renameProvider);
+        field(w, fieldNames[19], foldingRangeProvider);
+        field(w, fieldNames[20], executeCommandProvider);
+        field(w, fieldNames[21], selectionRangeProvider);
+        field(w, fieldNames[22], linkedEditingRangeProvider);
+        field(w, fieldNames[23], callHierarchyProvider);
+        field(w, fieldNames[24], semanticTokensProvider);
+        field(w, fieldNames[25], monikerProvider);
+        field(w, fieldNames[26], workspaceSymbolProvider);
+        field(w, fieldNames[27], workspace);
+        field(w, fieldNames[28], experimental);
+        field(w, fieldNames[29], positionEncoding);
+        field(w, fieldNames[30], diagnosticProvider);
     }
 };
 
@@ -2116,8 +2398,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "capabilities", capabilities);
-        field(w, "serverInfo", serverInfo);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "capabilities", "serverInfo" };
+        field(w, fieldNames[0], capabilities);
+        field(w, fieldNames[1], serverInfo);
     }
 };
 
@@ -2129,7 +2412,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "retry", retry);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "retry" };
+        field(w, fieldNames[0], retry);
     }
 };
 
@@ -2151,8 +2435,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "message", message);
-        field(w, "verbose", verbose);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "message", "verbose" };
+        field(w, fieldNames[0], message);
+        field(w, fieldNames[1], verbose);
     }
 };
 
@@ -2164,7 +2449,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "value", value);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "value" };
+        field(w, fieldNames[0], value);
     }
 };
 
@@ -2177,8 +2463,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "type", type);
-        field(w, "message", message);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "type", "message" };
+        field(w, fieldNames[0], type);
+        field(w, fieldNames[1], message);
     }
 };
 
@@ -2190,7 +2477,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "title", title);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "title" };
+        field(w, fieldNames[0], title);
     }
 };
 
@@ -2204,9 +2492,10 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "type", type);
-        field(w, "message", message);
-        field(w, "actions", actions);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "type", "message", "actions" };
+        field(w, fieldNames[0], type);
+        field(w, fieldNames[1], message);
+        field(w, fieldNames[2], actions);
     }
 };
 
@@ -2221,10 +2510,13 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "uri", uri);
-        field(w, "external", external);
-        field(w, "takeFocus", takeFocus);
-        field(w, "selection", selection);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "uri", "external", "takeFocus", "selection"
+        };
+        field(w, fieldNames[0], uri);
+        field(w, fieldNames[1], external);
+        field(w, fieldNames[2], takeFocus);
+        field(w, fieldNames[3], selection);
     }
 };
 
@@ -2236,7 +2528,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "success", success);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "success" };
+        field(w, fieldNames[0], success);
     }
 };
 
@@ -2249,8 +2542,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "type", type);
-        field(w, "message", message);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "type", "message" };
+        field(w, fieldNames[0], type);
+        field(w, fieldNames[1], message);
     }
 };
 
@@ -2262,7 +2556,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "token", token);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "token" };
+        field(w, fieldNames[0], token);
     }
 };
 
@@ -2274,7 +2569,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "token", token);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "token" };
+        field(w, fieldNames[0], token);
     }
 };
 
@@ -2288,9 +2584,10 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "id", id);
-        field(w, "method", method);
-        field(w, "registerOptions", registerOptions);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "id", "method", "registerOptions" };
+        field(w, fieldNames[0], id);
+        field(w, fieldNames[1], method);
+        field(w, fieldNames[2], registerOptions);
     }
 };
 
@@ -2302,7 +2599,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "registrations", registrations);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "registrations" };
+        field(w, fieldNames[0], registrations);
     }
 };
 
@@ -2315,8 +2613,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "id", id);
-        field(w, "method", method);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "id", "method" };
+        field(w, fieldNames[0], id);
+        field(w, fieldNames[1], method);
     }
 };
 
@@ -2328,7 +2627,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "unregisterations", unregisterations);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "unregisterations" };
+        field(w, fieldNames[0], unregisterations);
     }
 };
 
@@ -2341,8 +2641,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "added", added);
-        field(w, "removed", removed);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "added", "removed" };
+        field(w, fieldNames[0], added);
+        field(w, fieldNames[1], removed);
     }
 };
 
@@ -2354,7 +2655,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "event", event);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "event" };
+        field(w, fieldNames[0], event);
     }
 };
 
@@ -2366,7 +2668,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "settings", settings);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "settings" };
+        field(w, fieldNames[0], settings);
     }
 };
 
@@ -2379,8 +2682,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "scopeUri", scopeUri);
-        field(w, "section", section);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "scopeUri", "section" };
+        field(w, fieldNames[0], scopeUri);
+        field(w, fieldNames[1], section);
     }
 };
 
@@ -2392,7 +2696,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "items", items);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "items" };
+        field(w, fieldNames[0], items);
     }
 };
 
@@ -2404,7 +2709,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "dynamicRegistration" };
+        field(w, fieldNames[0], dynamicRegistration);
     }
 };
 
@@ -2417,8 +2723,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "globPattern", globPattern);
-        field(w, "kind", kind);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "globPattern", "kind" };
+        field(w, fieldNames[0], globPattern);
+        field(w, fieldNames[1], kind);
     }
 };
 
@@ -2430,7 +2737,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "watchers", watchers);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "watchers" };
+        field(w, fieldNames[0], watchers);
     }
 };
 
@@ -2443,8 +2751,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "uri", uri);
-        field(w, "type", type);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "uri", "type" };
+        field(w, fieldNames[0], uri);
+        field(w, fieldNames[1], type);
     }
 };
 
@@ -2456,7 +2765,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "changes", changes);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "changes" };
+        field(w, fieldNames[0], changes);
     }
 };
 
@@ -2470,9 +2780,12 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
-        field(w, "symbolKind", symbolKind);
-        field(w, "tagSupport", tagSupport);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "dynamicRegistration", "symbolKind", "tagSupport"
+        };
+        field(w, fieldNames[0], dynamicRegistration);
+        field(w, fieldNames[1], symbolKind);
+        field(w, fieldNames[2], tagSupport);
     }
 };
 
@@ -2487,7 +2800,7 @@ public:
 };
 
 class Q_LANGUAGESERVER_EXPORT WorkspaceSymbolParams : public WorkDoneProgressParams,
-                                                      PartialResultParams
+                                                      public PartialResultParams
 {
 public:
     QByteArray query = {};
@@ -2497,7 +2810,8 @@ public:
     {
         WorkDoneProgressParams::walk(w);
         PartialResultParams::walk(w);
-        field(w, "query", query);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "query" };
+        field(w, fieldNames[0], query);
     }
 };
 
@@ -2509,7 +2823,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "dynamicRegistration", dynamicRegistration);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "dynamicRegistration" };
+        field(w, fieldNames[0], dynamicRegistration);
     }
 };
 
@@ -2533,8 +2848,9 @@ public:
     void walk(W &w)
     {
         WorkDoneProgressParams::walk(w);
-        field(w, "command", command);
-        field(w, "arguments", arguments);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "command", "arguments" };
+        field(w, fieldNames[0], command);
+        field(w, fieldNames[1], arguments);
     }
 };
 
@@ -2547,8 +2863,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "label", label);
-        field(w, "edit", edit);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "label", "edit" };
+        field(w, fieldNames[0], label);
+        field(w, fieldNames[1], edit);
     }
 };
 
@@ -2562,9 +2879,12 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "applied", applied);
-        field(w, "failureReason", failureReason);
-        field(w, "failedChange", failedChange);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "applied", "failureReason", "failedChange"
+        };
+        field(w, fieldNames[0], applied);
+        field(w, fieldNames[1], failureReason);
+        field(w, fieldNames[2], failedChange);
     }
 };
 
@@ -2576,7 +2896,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "uri", uri);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "uri" };
+        field(w, fieldNames[0], uri);
     }
 };
 
@@ -2588,7 +2909,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "files", files);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "files" };
+        field(w, fieldNames[0], files);
     }
 };
 
@@ -2601,8 +2923,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "oldUri", oldUri);
-        field(w, "newUri", newUri);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "oldUri", "newUri" };
+        field(w, fieldNames[0], oldUri);
+        field(w, fieldNames[1], newUri);
     }
 };
 
@@ -2614,7 +2937,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "files", files);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "files" };
+        field(w, fieldNames[0], files);
     }
 };
 
@@ -2626,7 +2950,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "uri", uri);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "uri" };
+        field(w, fieldNames[0], uri);
     }
 };
 
@@ -2638,7 +2963,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "files", files);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "files" };
+        field(w, fieldNames[0], files);
     }
 };
 
@@ -2650,7 +2976,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "textDocument", textDocument);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "textDocument" };
+        field(w, fieldNames[0], textDocument);
     }
 };
 
@@ -2664,7 +2991,8 @@ public:
     void walk(W &w)
     {
         TextDocumentRegistrationOptions::walk(w);
-        field(w, "syncKind", syncKind);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "syncKind" };
+        field(w, fieldNames[0], syncKind);
     }
 };
 
@@ -2677,8 +3005,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "textDocument", textDocument);
-        field(w, "contentChanges", contentChanges);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "textDocument", "contentChanges" };
+        field(w, fieldNames[0], textDocument);
+        field(w, fieldNames[1], contentChanges);
     }
 };
 
@@ -2691,8 +3020,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "textDocument", textDocument);
-        field(w, "reason", reason);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "textDocument", "reason" };
+        field(w, fieldNames[0], textDocument);
+        field(w, fieldNames[1], reason);
     }
 };
 
@@ -2704,7 +3034,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "includeText", includeText);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "includeText" };
+        field(w, fieldNames[0], includeText);
     }
 };
 
@@ -2718,7 +3049,8 @@ public:
     void walk(W &w)
     {
         TextDocumentRegistrationOptions::walk(w);
-        field(w, "includeText", includeText);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "includeText" };
+        field(w, fieldNames[0], includeText);
     }
 };
 
@@ -2731,8 +3063,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "textDocument", textDocument);
-        field(w, "text", text);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "textDocument", "text" };
+        field(w, fieldNames[0], textDocument);
+        field(w, fieldNames[1], text);
     }
 };
 
@@ -2744,7 +3077,8 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "textDocument", textDocument);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "textDocument" };
+        field(w, fieldNames[0], textDocument);
     }
 };
 
@@ -2758,15 +3092,16 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "uri", uri);
-        field(w, "version", version);
-        field(w, "diagnostics", diagnostics);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "uri", "version", "diagnostics" };
+        field(w, fieldNames[0], uri);
+        field(w, fieldNames[1], version);
+        field(w, fieldNames[2], diagnostics);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT CompletionRegistrationOptions
     : public TextDocumentRegistrationOptions,
-      CompletionOptions
+      public CompletionOptions
 {
 public:
     template<typename W>
@@ -2786,14 +3121,15 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "triggerKind", triggerKind);
-        field(w, "triggerCharacter", triggerCharacter);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "triggerKind", "triggerCharacter" };
+        field(w, fieldNames[0], triggerKind);
+        field(w, fieldNames[1], triggerCharacter);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT CompletionParams : public TextDocumentPositionParams,
-                                                 WorkDoneProgressParams,
-                                                 PartialResultParams
+                                                 public WorkDoneProgressParams,
+                                                 public PartialResultParams
 {
 public:
     std::optional<CompletionContext> context = {};
@@ -2804,7 +3140,8 @@ public:
         TextDocumentPositionParams::walk(w);
         WorkDoneProgressParams::walk(w);
         PartialResultParams::walk(w);
-        field(w, "context", context);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "context" };
+        field(w, fieldNames[0], context);
     }
 };
 
@@ -2818,9 +3155,10 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "newText", newText);
-        field(w, "insert", insert);
-        field(w, "replace", replace);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "newText", "insert", "replace" };
+        field(w, fieldNames[0], newText);
+        field(w, fieldNames[1], insert);
+        field(w, fieldNames[2], replace);
     }
 };
 
@@ -2848,23 +3186,28 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "label", label);
-        field(w, "kind", kind);
-        field(w, "tags", tags);
-        field(w, "detail", detail);
-        field(w, "documentation", documentation);
-        field(w, "deprecated", deprecated);
-        field(w, "preselect", preselect);
-        field(w, "sortText", sortText);
-        field(w, "filterText", filterText);
-        field(w, "insertText", insertText);
-        field(w, "insertTextFormat", insertTextFormat);
-        field(w, "insertTextMode", insertTextMode);
-        field(w, "textEdit", textEdit);
-        field(w, "additionalTextEdits", additionalTextEdits);
-        field(w, "commitCharacters", commitCharacters);
-        field(w, "command", command);
-        field(w, "data", data);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "label", "kind", "tags", "detail", "documentation", "deprecated", "preselect",
+            "sortText", "filterText", "insertText", "insertTextFormat", "insertTextMode",
+            "textEdit", "additionalTextEdits", "commitCharacters", "command", "data"
+        };
+        field(w, fieldNames[0], label);
+        field(w, fieldNames[1], kind);
+        field(w, fieldNames[2], tags);
+        field(w, fieldNames[3], detail);
+        field(w, fieldNames[4], documentation);
+        field(w, fieldNames[5], deprecated);
+        field(w, fieldNames[6], preselect);
+        field(w, fieldNames[7], sortText);
+        field(w, fieldNames[8], filterText);
+        field(w, fieldNames[9], insertText);
+        field(w, fieldNames[10], insertTextFormat);
+        field(w, fieldNames[11], insertTextMode);
+        field(w, fieldNames[12], textEdit);
+        field(w, fieldNames[13], additionalTextEdits);
+        field(w, fieldNames[14], commitCharacters);
+        field(w, fieldNames[15], command);
+        field(w, fieldNames[16], data);
     }
 };
 
@@ -2877,13 +3220,14 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "isIncomplete", isIncomplete);
-        field(w, "items", items);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "isIncomplete", "items" };
+        field(w, fieldNames[0], isIncomplete);
+        field(w, fieldNames[1], items);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT HoverRegistrationOptions : public TextDocumentRegistrationOptions,
-                                                         HoverOptions
+                                                         public HoverOptions
 {
 public:
     template<typename W>
@@ -2895,7 +3239,7 @@ public:
 };
 
 class Q_LANGUAGESERVER_EXPORT HoverParams : public TextDocumentPositionParams,
-                                            WorkDoneProgressParams
+                                            public WorkDoneProgressParams
 {
 public:
     template<typename W>
@@ -2915,14 +3259,15 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "contents", contents);
-        field(w, "range", range);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "contents", "range" };
+        field(w, fieldNames[0], contents);
+        field(w, fieldNames[1], range);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT SignatureHelpRegistrationOptions
     : public TextDocumentRegistrationOptions,
-      SignatureHelpOptions
+      public SignatureHelpOptions
 {
 public:
     template<typename W>
@@ -2942,8 +3287,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "label", label);
-        field(w, "documentation", documentation);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "label", "documentation" };
+        field(w, fieldNames[0], label);
+        field(w, fieldNames[1], documentation);
     }
 };
 
@@ -2958,10 +3304,13 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "label", label);
-        field(w, "documentation", documentation);
-        field(w, "parameters", parameters);
-        field(w, "activeParameter", activeParameter);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "label", "documentation", "parameters", "activeParameter"
+        };
+        field(w, fieldNames[0], label);
+        field(w, fieldNames[1], documentation);
+        field(w, fieldNames[2], parameters);
+        field(w, fieldNames[3], activeParameter);
     }
 };
 
@@ -2975,9 +3324,12 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "signatures", signatures);
-        field(w, "activeSignature", activeSignature);
-        field(w, "activeParameter", activeParameter);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "signatures", "activeSignature", "activeParameter"
+        };
+        field(w, fieldNames[0], signatures);
+        field(w, fieldNames[1], activeSignature);
+        field(w, fieldNames[2], activeParameter);
     }
 };
 
@@ -2992,15 +3344,18 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "triggerKind", triggerKind);
-        field(w, "triggerCharacter", triggerCharacter);
-        field(w, "isRetrigger", isRetrigger);
-        field(w, "activeSignatureHelp", activeSignatureHelp);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "triggerKind", "triggerCharacter", "isRetrigger", "activeSignatureHelp"
+        };
+        field(w, fieldNames[0], triggerKind);
+        field(w, fieldNames[1], triggerCharacter);
+        field(w, fieldNames[2], isRetrigger);
+        field(w, fieldNames[3], activeSignatureHelp);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT SignatureHelpParams : public TextDocumentPositionParams,
-                                                    WorkDoneProgressParams
+                                                    public WorkDoneProgressParams
 {
 public:
     std::optional<SignatureHelpContext> context = {};
@@ -3010,13 +3365,14 @@ public:
     {
         TextDocumentPositionParams::walk(w);
         WorkDoneProgressParams::walk(w);
-        field(w, "context", context);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "context" };
+        field(w, fieldNames[0], context);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT DeclarationParams : public TextDocumentPositionParams,
-                                                  WorkDoneProgressParams,
-                                                  PartialResultParams
+                                                  public WorkDoneProgressParams,
+                                                  public PartialResultParams
 {
 public:
     template<typename W>
@@ -3030,7 +3386,7 @@ public:
 
 class Q_LANGUAGESERVER_EXPORT DefinitionRegistrationOptions
     : public TextDocumentRegistrationOptions,
-      DefinitionOptions
+      public DefinitionOptions
 {
 public:
     template<typename W>
@@ -3042,8 +3398,8 @@ public:
 };
 
 class Q_LANGUAGESERVER_EXPORT DefinitionParams : public TextDocumentPositionParams,
-                                                 WorkDoneProgressParams,
-                                                 PartialResultParams
+                                                 public WorkDoneProgressParams,
+                                                 public PartialResultParams
 {
 public:
     template<typename W>
@@ -3056,8 +3412,8 @@ public:
 };
 
 class Q_LANGUAGESERVER_EXPORT TypeDefinitionParams : public TextDocumentPositionParams,
-                                                     WorkDoneProgressParams,
-                                                     PartialResultParams
+                                                     public WorkDoneProgressParams,
+                                                     public PartialResultParams
 {
 public:
     template<typename W>
@@ -3070,8 +3426,8 @@ public:
 };
 
 class Q_LANGUAGESERVER_EXPORT ImplementationParams : public TextDocumentPositionParams,
-                                                     WorkDoneProgressParams,
-                                                     PartialResultParams
+                                                     public WorkDoneProgressParams,
+                                                     public PartialResultParams
 {
 public:
     template<typename W>
@@ -3084,7 +3440,7 @@ public:
 };
 
 class Q_LANGUAGESERVER_EXPORT ReferenceRegistrationOptions : public TextDocumentRegistrationOptions,
-                                                             ReferenceOptions
+                                                             public ReferenceOptions
 {
 public:
     template<typename W>
@@ -3103,13 +3459,14 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "includeDeclaration", includeDeclaration);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "includeDeclaration" };
+        field(w, fieldNames[0], includeDeclaration);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT ReferenceParams : public TextDocumentPositionParams,
-                                                WorkDoneProgressParams,
-                                                PartialResultParams
+                                                public WorkDoneProgressParams,
+                                                public PartialResultParams
 {
 public:
     ReferenceContext context = {};
@@ -3120,13 +3477,14 @@ public:
         TextDocumentPositionParams::walk(w);
         WorkDoneProgressParams::walk(w);
         PartialResultParams::walk(w);
-        field(w, "context", context);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "context" };
+        field(w, fieldNames[0], context);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT DocumentHighlightRegistrationOptions
     : public TextDocumentRegistrationOptions,
-      DocumentHighlightOptions
+      public DocumentHighlightOptions
 {
 public:
     template<typename W>
@@ -3138,8 +3496,8 @@ public:
 };
 
 class Q_LANGUAGESERVER_EXPORT DocumentHighlightParams : public TextDocumentPositionParams,
-                                                        WorkDoneProgressParams,
-                                                        PartialResultParams
+                                                        public WorkDoneProgressParams,
+                                                        public PartialResultParams
 {
 public:
     template<typename W>
@@ -3160,14 +3518,15 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "range", range);
-        field(w, "kind", kind);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "range", "kind" };
+        field(w, fieldNames[0], range);
+        field(w, fieldNames[1], kind);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT DocumentSymbolRegistrationOptions
     : public TextDocumentRegistrationOptions,
-      DocumentSymbolOptions
+      public DocumentSymbolOptions
 {
 public:
     template<typename W>
@@ -3179,7 +3538,7 @@ public:
 };
 
 class Q_LANGUAGESERVER_EXPORT DocumentSymbolParams : public WorkDoneProgressParams,
-                                                     PartialResultParams
+                                                     public PartialResultParams
 {
 public:
     TextDocumentIdentifier textDocument = {};
@@ -3189,7 +3548,8 @@ public:
     {
         WorkDoneProgressParams::walk(w);
         PartialResultParams::walk(w);
-        field(w, "textDocument", textDocument);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "textDocument" };
+        field(w, fieldNames[0], textDocument);
     }
 };
 
@@ -3208,14 +3568,17 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "name", name);
-        field(w, "detail", detail);
-        field(w, "kind", kind);
-        field(w, "tags", tags);
-        field(w, "deprecated", deprecated);
-        field(w, "range", range);
-        field(w, "selectionRange", selectionRange);
-        field(w, "children", children);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "name", "detail", "kind", "tags", "deprecated", "range", "selectionRange", "children"
+        };
+        field(w, fieldNames[0], name);
+        field(w, fieldNames[1], detail);
+        field(w, fieldNames[2], kind);
+        field(w, fieldNames[3], tags);
+        field(w, fieldNames[4], deprecated);
+        field(w, fieldNames[5], range);
+        field(w, fieldNames[6], selectionRange);
+        field(w, fieldNames[7], children);
     }
 };
 
@@ -3232,18 +3595,21 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "name", name);
-        field(w, "kind", kind);
-        field(w, "tags", tags);
-        field(w, "deprecated", deprecated);
-        field(w, "location", location);
-        field(w, "containerName", containerName);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "name", "kind", "tags", "deprecated", "location", "containerName"
+        };
+        field(w, fieldNames[0], name);
+        field(w, fieldNames[1], kind);
+        field(w, fieldNames[2], tags);
+        field(w, fieldNames[3], deprecated);
+        field(w, fieldNames[4], location);
+        field(w, fieldNames[5], containerName);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT CodeActionRegistrationOptions
     : public TextDocumentRegistrationOptions,
-      CodeActionOptions
+      public CodeActionOptions
 {
 public:
     template<typename W>
@@ -3263,26 +3629,31 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "diagnostics", diagnostics);
-        field(w, "only", only);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "diagnostics", "only" };
+        field(w, fieldNames[0], diagnostics);
+        field(w, fieldNames[1], only);
     }
 };
 
-class Q_LANGUAGESERVER_EXPORT CodeActionParams : public WorkDoneProgressParams, PartialResultParams
+class Q_LANGUAGESERVER_EXPORT CodeActionParams : public WorkDoneProgressParams,
+                                                 public PartialResultParams
 {
 public:
     TextDocumentIdentifier textDocument = {};
     Range range = {};
-    CodeActionContext context = {};
+    QTypedJson::Lazy<CodeActionContext> context = {};
 
     template<typename W>
     void walk(W &w)
     {
         WorkDoneProgressParams::walk(w);
         PartialResultParams::walk(w);
-        field(w, "textDocument", textDocument);
-        field(w, "range", range);
-        field(w, "context", context);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "textDocument", "range", "context"
+        };
+        field(w, fieldNames[0], textDocument);
+        field(w, fieldNames[1], range);
+        field(w, fieldNames[2], context);
     }
 };
 
@@ -3301,19 +3672,22 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "title", title);
-        field(w, "kind", kind);
-        field(w, "diagnostics", diagnostics);
-        field(w, "isPreferred", isPreferred);
-        field(w, "disabled", disabled);
-        field(w, "edit", edit);
-        field(w, "command", command);
-        field(w, "data", data);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "title", "kind", "diagnostics", "isPreferred", "disabled", "edit", "command", "data"
+        };
+        field(w, fieldNames[0], title);
+        field(w, fieldNames[1], kind);
+        field(w, fieldNames[2], diagnostics);
+        field(w, fieldNames[3], isPreferred);
+        field(w, fieldNames[4], disabled);
+        field(w, fieldNames[5], edit);
+        field(w, fieldNames[6], command);
+        field(w, fieldNames[7], data);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT CodeLensRegistrationOptions : public TextDocumentRegistrationOptions,
-                                                            CodeLensOptions
+                                                            public CodeLensOptions
 {
 public:
     template<typename W>
@@ -3324,7 +3698,8 @@ public:
     }
 };
 
-class Q_LANGUAGESERVER_EXPORT CodeLensParams : public WorkDoneProgressParams, PartialResultParams
+class Q_LANGUAGESERVER_EXPORT CodeLensParams : public WorkDoneProgressParams,
+                                               public PartialResultParams
 {
 public:
     TextDocumentIdentifier textDocument = {};
@@ -3334,7 +3709,8 @@ public:
     {
         WorkDoneProgressParams::walk(w);
         PartialResultParams::walk(w);
-        field(w, "textDocument", textDocument);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "textDocument" };
+        field(w, fieldNames[0], textDocument);
     }
 };
 
@@ -3348,9 +3724,10 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "range", range);
-        field(w, "command", command);
-        field(w, "data", data);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "range", "command", "data" };
+        field(w, fieldNames[0], range);
+        field(w, fieldNames[1], command);
+        field(w, fieldNames[2], data);
     }
 };
 
@@ -3362,13 +3739,14 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "refreshSupport", refreshSupport);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "refreshSupport" };
+        field(w, fieldNames[0], refreshSupport);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT DocumentLinkRegistrationOptions
     : public TextDocumentRegistrationOptions,
-      DocumentLinkOptions
+      public DocumentLinkOptions
 {
 public:
     template<typename W>
@@ -3380,7 +3758,7 @@ public:
 };
 
 class Q_LANGUAGESERVER_EXPORT DocumentLinkParams : public WorkDoneProgressParams,
-                                                   PartialResultParams
+                                                   public PartialResultParams
 {
 public:
     TextDocumentIdentifier textDocument = {};
@@ -3390,7 +3768,8 @@ public:
     {
         WorkDoneProgressParams::walk(w);
         PartialResultParams::walk(w);
-        field(w, "textDocument", textDocument);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "textDocument" };
+        field(w, fieldNames[0], textDocument);
     }
 };
 
@@ -3405,15 +3784,18 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "range", range);
-        field(w, "target", target);
-        field(w, "tooltip", tooltip);
-        field(w, "data", data);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "range", "target", "tooltip", "data"
+        };
+        field(w, fieldNames[0], range);
+        field(w, fieldNames[1], target);
+        field(w, fieldNames[2], tooltip);
+        field(w, fieldNames[3], data);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT DocumentColorParams : public WorkDoneProgressParams,
-                                                    PartialResultParams
+                                                    public PartialResultParams
 {
 public:
     TextDocumentIdentifier textDocument = {};
@@ -3423,7 +3805,8 @@ public:
     {
         WorkDoneProgressParams::walk(w);
         PartialResultParams::walk(w);
-        field(w, "textDocument", textDocument);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "textDocument" };
+        field(w, fieldNames[0], textDocument);
     }
 };
 
@@ -3438,10 +3821,11 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "red", red);
-        field(w, "green", green);
-        field(w, "blue", blue);
-        field(w, "alpha", alpha);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "red", "green", "blue", "alpha" };
+        field(w, fieldNames[0], red);
+        field(w, fieldNames[1], green);
+        field(w, fieldNames[2], blue);
+        field(w, fieldNames[3], alpha);
     }
 };
 
@@ -3454,13 +3838,14 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "range", range);
-        field(w, "color", color);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "range", "color" };
+        field(w, fieldNames[0], range);
+        field(w, fieldNames[1], color);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT ColorPresentationParams : public WorkDoneProgressParams,
-                                                        PartialResultParams
+                                                        public PartialResultParams
 {
 public:
     TextDocumentIdentifier textDocument = {};
@@ -3472,9 +3857,10 @@ public:
     {
         WorkDoneProgressParams::walk(w);
         PartialResultParams::walk(w);
-        field(w, "textDocument", textDocument);
-        field(w, "color", color);
-        field(w, "range", range);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "textDocument", "color", "range" };
+        field(w, fieldNames[0], textDocument);
+        field(w, fieldNames[1], color);
+        field(w, fieldNames[2], range);
     }
 };
 
@@ -3488,15 +3874,18 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "label", label);
-        field(w, "textEdit", textEdit);
-        field(w, "additionalTextEdits", additionalTextEdits);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "label", "textEdit", "additionalTextEdits"
+        };
+        field(w, fieldNames[0], label);
+        field(w, fieldNames[1], textEdit);
+        field(w, fieldNames[2], additionalTextEdits);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT DocumentFormattingRegistrationOptions
     : public TextDocumentRegistrationOptions,
-      DocumentFormattingOptions
+      public DocumentFormattingOptions
 {
 public:
     template<typename W>
@@ -3520,17 +3909,22 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "tabSize", tabSize);
-        field(w, "insertSpaces", insertSpaces);
-        field(w, "trimTrailingWhitespace", trimTrailingWhitespace);
-        field(w, "insertFinalNewline", insertFinalNewline);
-        field(w, "trimFinalNewlines", trimFinalNewlines);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "tabSize", "insertSpaces", "trimTrailingWhitespace", "insertFinalNewline",
+            "trimFinalNewlines"
+        };
+        field(w, fieldNames[0], tabSize);
+        field(w, fieldNames[1], insertSpaces);
+        field(w, fieldNames[2], trimTrailingWhitespace);
+        field(w, fieldNames[3], insertFinalNewline);
+        field(w, fieldNames[4], trimFinalNewlines);
     }
     template<typename W>
     void walkExtra(W &w)
     {
         w.handleExtras(extraFields);
     }
+    void setExtraFields(const QJsonObject &e) { extraFields = e; }
 };
 
 class Q_LANGUAGESERVER_EXPORT DocumentFormattingParams : public WorkDoneProgressParams
@@ -3543,14 +3937,15 @@ public:
     void walk(W &w)
     {
         WorkDoneProgressParams::walk(w);
-        field(w, "textDocument", textDocument);
-        field(w, "options", options);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "textDocument", "options" };
+        field(w, fieldNames[0], textDocument);
+        field(w, fieldNames[1], options);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT DocumentRangeFormattingRegistrationOptions
     : public TextDocumentRegistrationOptions,
-      DocumentRangeFormattingOptions
+      public DocumentRangeFormattingOptions
 {
 public:
     template<typename W>
@@ -3572,15 +3967,18 @@ public:
     void walk(W &w)
     {
         WorkDoneProgressParams::walk(w);
-        field(w, "textDocument", textDocument);
-        field(w, "range", range);
-        field(w, "options", options);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "textDocument", "range", "options"
+        };
+        field(w, fieldNames[0], textDocument);
+        field(w, fieldNames[1], range);
+        field(w, fieldNames[2], options);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT DocumentOnTypeFormattingRegistrationOptions
     : public TextDocumentRegistrationOptions,
-      DocumentOnTypeFormattingOptions
+      public DocumentOnTypeFormattingOptions
 {
 public:
     template<typename W>
@@ -3601,13 +3999,14 @@ public:
     void walk(W &w)
     {
         TextDocumentPositionParams::walk(w);
-        field(w, "ch", ch);
-        field(w, "options", options);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "ch", "options" };
+        field(w, fieldNames[0], ch);
+        field(w, fieldNames[1], options);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT RenameRegistrationOptions : public TextDocumentRegistrationOptions,
-                                                          RenameOptions
+                                                          public RenameOptions
 {
 public:
     template<typename W>
@@ -3619,7 +4018,7 @@ public:
 };
 
 class Q_LANGUAGESERVER_EXPORT RenameParams : public TextDocumentPositionParams,
-                                             WorkDoneProgressParams
+                                             public WorkDoneProgressParams
 {
 public:
     QByteArray newName = {};
@@ -3629,7 +4028,8 @@ public:
     {
         TextDocumentPositionParams::walk(w);
         WorkDoneProgressParams::walk(w);
-        field(w, "newName", newName);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "newName" };
+        field(w, fieldNames[0], newName);
     }
 };
 
@@ -3644,7 +4044,7 @@ public:
 };
 
 class Q_LANGUAGESERVER_EXPORT FoldingRangeParams : public WorkDoneProgressParams,
-                                                   PartialResultParams
+                                                   public PartialResultParams
 {
 public:
     TextDocumentIdentifier textDocument = {};
@@ -3654,7 +4054,8 @@ public:
     {
         WorkDoneProgressParams::walk(w);
         PartialResultParams::walk(w);
-        field(w, "textDocument", textDocument);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "textDocument" };
+        field(w, fieldNames[0], textDocument);
     }
 };
 
@@ -3670,16 +4071,19 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "startLine", startLine);
-        field(w, "startCharacter", startCharacter);
-        field(w, "endLine", endLine);
-        field(w, "endCharacter", endCharacter);
-        field(w, "kind", kind);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "startLine", "startCharacter", "endLine", "endCharacter", "kind"
+        };
+        field(w, fieldNames[0], startLine);
+        field(w, fieldNames[1], startCharacter);
+        field(w, fieldNames[2], endLine);
+        field(w, fieldNames[3], endCharacter);
+        field(w, fieldNames[4], kind);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT SelectionRangeParams : public WorkDoneProgressParams,
-                                                     PartialResultParams
+                                                     public PartialResultParams
 {
 public:
     TextDocumentIdentifier textDocument = {};
@@ -3690,13 +4094,14 @@ public:
     {
         WorkDoneProgressParams::walk(w);
         PartialResultParams::walk(w);
-        field(w, "textDocument", textDocument);
-        field(w, "positions", positions);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "textDocument", "positions" };
+        field(w, fieldNames[0], textDocument);
+        field(w, fieldNames[1], positions);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT CallHierarchyPrepareParams : public TextDocumentPositionParams,
-                                                           WorkDoneProgressParams
+                                                           public WorkDoneProgressParams
 {
 public:
     template<typename W>
@@ -3722,19 +4127,22 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "name", name);
-        field(w, "kind", kind);
-        field(w, "tags", tags);
-        field(w, "detail", detail);
-        field(w, "uri", uri);
-        field(w, "range", range);
-        field(w, "selectionRange", selectionRange);
-        field(w, "data", data);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "name", "kind", "tags", "detail", "uri", "range", "selectionRange", "data"
+        };
+        field(w, fieldNames[0], name);
+        field(w, fieldNames[1], kind);
+        field(w, fieldNames[2], tags);
+        field(w, fieldNames[3], detail);
+        field(w, fieldNames[4], uri);
+        field(w, fieldNames[5], range);
+        field(w, fieldNames[6], selectionRange);
+        field(w, fieldNames[7], data);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT CallHierarchyIncomingCallsParams : public WorkDoneProgressParams,
-                                                                 PartialResultParams
+                                                                 public PartialResultParams
 {
 public:
     CallHierarchyItem item = {};
@@ -3744,7 +4152,8 @@ public:
     {
         WorkDoneProgressParams::walk(w);
         PartialResultParams::walk(w);
-        field(w, "item", item);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "item" };
+        field(w, fieldNames[0], item);
     }
 };
 
@@ -3757,13 +4166,14 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "from", from);
-        field(w, "fromRanges", fromRanges);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "from", "fromRanges" };
+        field(w, fieldNames[0], from);
+        field(w, fieldNames[1], fromRanges);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT CallHierarchyOutgoingCallsParams : public WorkDoneProgressParams,
-                                                                 PartialResultParams
+                                                                 public PartialResultParams
 {
 public:
     CallHierarchyItem item = {};
@@ -3773,7 +4183,8 @@ public:
     {
         WorkDoneProgressParams::walk(w);
         PartialResultParams::walk(w);
-        field(w, "item", item);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "item" };
+        field(w, fieldNames[0], item);
     }
 };
 
@@ -3786,13 +4197,14 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "to", to);
-        field(w, "fromRanges", fromRanges);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "to", "fromRanges" };
+        field(w, fieldNames[0], to);
+        field(w, fieldNames[1], fromRanges);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT SemanticTokensParams : public WorkDoneProgressParams,
-                                                     PartialResultParams
+                                                     public PartialResultParams
 {
 public:
     TextDocumentIdentifier textDocument = {};
@@ -3802,7 +4214,8 @@ public:
     {
         WorkDoneProgressParams::walk(w);
         PartialResultParams::walk(w);
-        field(w, "textDocument", textDocument);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "textDocument" };
+        field(w, fieldNames[0], textDocument);
     }
 };
 
@@ -3815,8 +4228,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "resultId", resultId);
-        field(w, "data", data);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "resultId", "data" };
+        field(w, fieldNames[0], resultId);
+        field(w, fieldNames[1], data);
     }
 };
 
@@ -3828,12 +4242,13 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "data", data);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "data" };
+        field(w, fieldNames[0], data);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT SemanticTokensDeltaParams : public WorkDoneProgressParams,
-                                                          PartialResultParams
+                                                          public PartialResultParams
 {
 public:
     TextDocumentIdentifier textDocument = {};
@@ -3844,8 +4259,11 @@ public:
     {
         WorkDoneProgressParams::walk(w);
         PartialResultParams::walk(w);
-        field(w, "textDocument", textDocument);
-        field(w, "previousResultId", previousResultId);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "textDocument", "previousResultId"
+        };
+        field(w, fieldNames[0], textDocument);
+        field(w, fieldNames[1], previousResultId);
     }
 };
 
@@ -3859,9 +4277,10 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "start", start);
-        field(w, "deleteCount", deleteCount);
-        field(w, "data", data);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "start", "deleteCount", "data" };
+        field(w, fieldNames[0], start);
+        field(w, fieldNames[1], deleteCount);
+        field(w, fieldNames[2], data);
     }
 };
 
@@ -3874,8 +4293,9 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "resultId", resultId);
-        field(w, "edits", edits);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "resultId", "edits" };
+        field(w, fieldNames[0], resultId);
+        field(w, fieldNames[1], edits);
     }
 };
 
@@ -3887,12 +4307,13 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "edits", edits);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "edits" };
+        field(w, fieldNames[0], edits);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT SemanticTokensRangeParams : public WorkDoneProgressParams,
-                                                          PartialResultParams
+                                                          public PartialResultParams
 {
 public:
     TextDocumentIdentifier textDocument = {};
@@ -3903,8 +4324,9 @@ public:
     {
         WorkDoneProgressParams::walk(w);
         PartialResultParams::walk(w);
-        field(w, "textDocument", textDocument);
-        field(w, "range", range);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "textDocument", "range" };
+        field(w, fieldNames[0], textDocument);
+        field(w, fieldNames[1], range);
     }
 };
 
@@ -3916,12 +4338,13 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "refreshSupport", refreshSupport);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "refreshSupport" };
+        field(w, fieldNames[0], refreshSupport);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT LinkedEditingRangeParams : public TextDocumentPositionParams,
-                                                         WorkDoneProgressParams
+                                                         public WorkDoneProgressParams
 {
 public:
     template<typename W>
@@ -3941,14 +4364,15 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "ranges", ranges);
-        field(w, "wordPattern", wordPattern);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "ranges", "wordPattern" };
+        field(w, fieldNames[0], ranges);
+        field(w, fieldNames[1], wordPattern);
     }
 };
 
 class Q_LANGUAGESERVER_EXPORT MonikerParams : public TextDocumentPositionParams,
-                                              WorkDoneProgressParams,
-                                              PartialResultParams
+                                              public WorkDoneProgressParams,
+                                              public PartialResultParams
 {
 public:
     template<typename W>
@@ -3971,10 +4395,229 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "scheme", scheme);
-        field(w, "identifier", identifier);
-        field(w, "unique", unique);
-        field(w, "kind", kind);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "scheme", "identifier", "unique", "kind"
+        };
+        field(w, fieldNames[0], scheme);
+        field(w, fieldNames[1], identifier);
+        field(w, fieldNames[2], unique);
+        field(w, fieldNames[3], kind);
+    }
+};
+
+class Q_LANGUAGESERVER_EXPORT DocumentDiagnosticParams : public WorkDoneProgressParams,
+                                                         public PartialResultParams
+{
+public:
+    TextDocumentIdentifier textDocument = {};
+    std::optional<QByteArray> identifier = {};
+    std::optional<QByteArray> previousResultId = {};
+
+    template<typename W>
+    void walk(W &w)
+    {
+        WorkDoneProgressParams::walk(w);
+        PartialResultParams::walk(w);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "textDocument", "identifier", "previousResultId"
+        };
+        field(w, fieldNames[0], textDocument);
+        field(w, fieldNames[1], identifier);
+        field(w, fieldNames[2], previousResultId);
+    }
+};
+
+class Q_LANGUAGESERVER_EXPORT FullDocumentDiagnosticReport
+{
+public:
+    QByteArray kind = {};
+    std::optional<QByteArray> resultId = {};
+    QList<Diagnostic> items = {};
+    static constexpr QTypedJson::Discriminator jsonDiscriminator = { "kind", "full" };
+
+    template<typename W>
+    void walk(W &w)
+    {
+        static constexpr QTypedJson::FieldName fieldNames[] = { "kind", "resultId", "items" };
+        field(w, fieldNames[0], kind);
+        field(w, fieldNames[1], resultId);
+        field(w, fieldNames[2], items);
+    }
+};
+
+class Q_LANGUAGESERVER_EXPORT UnchangedDocumentDiagnosticReport
+{
+public:
+    QByteArray kind = {};
+    QByteArray resultId = {};
+    static constexpr QTypedJson::Discriminator jsonDiscriminator = { "kind", "unchanged" };
+
+    template<typename W>
+    void walk(W &w)
+    {
+        static constexpr QTypedJson::FieldName fieldNames[] = { "kind", "resultId" };
+        field(w, fieldNames[0], kind);
+        field(w, fieldNames[1], resultId);
+    }
+};
+
+class Q_LANGUAGESERVER_EXPORT RelatedFullDocumentDiagnosticReport
+    : public FullDocumentDiagnosticReport
+{
+public:
+    std::optional<QMap<
+            QByteArray, std::variant<FullDocumentDiagnosticReport, UnchangedDocumentDiagnosticReport>>>
+            relatedDocuments = {};
+
+    template<typename W>
+    void walk(W &w)
+    {
+        FullDocumentDiagnosticReport::walk(w);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "relatedDocuments" };
+        field(w, fieldNames[0], relatedDocuments);
+    }
+};
+
+class Q_LANGUAGESERVER_EXPORT RelatedUnchangedDocumentDiagnosticReport
+    : public UnchangedDocumentDiagnosticReport
+{
+public:
+    std::optional<QMap<
+            QByteArray, std::variant<FullDocumentDiagnosticReport, UnchangedDocumentDiagnosticReport>>>
+            relatedDocuments = {};
+
+    template<typename W>
+    void walk(W &w)
+    {
+        UnchangedDocumentDiagnosticReport::walk(w);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "relatedDocuments" };
+        field(w, fieldNames[0], relatedDocuments);
+    }
+};
+
+class Q_LANGUAGESERVER_EXPORT DocumentDiagnosticReportPartialResult
+{
+public:
+    QMap<QByteArray, std::variant<FullDocumentDiagnosticReport, UnchangedDocumentDiagnosticReport>>
+            relatedDocuments = {};
+
+    template<typename W>
+    void walk(W &w)
+    {
+        static constexpr QTypedJson::FieldName fieldNames[] = { "relatedDocuments" };
+        field(w, fieldNames[0], relatedDocuments);
+    }
+};
+
+class Q_LANGUAGESERVER_EXPORT PreviousResultId
+{
+public:
+    QByteArray uri = {};
+    QByteArray value = {};
+
+    template<typename W>
+    void walk(W &w)
+    {
+        static constexpr QTypedJson::FieldName fieldNames[] = { "uri", "value" };
+        field(w, fieldNames[0], uri);
+        field(w, fieldNames[1], value);
+    }
+};
+
+class Q_LANGUAGESERVER_EXPORT WorkspaceDiagnosticParams : public WorkDoneProgressParams,
+                                                          public PartialResultParams
+{
+public:
+    std::optional<QByteArray> identifier = {};
+    QList<PreviousResultId> previousResultIds = {};
+
+    template<typename W>
+    void walk(W &w)
+    {
+        WorkDoneProgressParams::walk(w);
+        PartialResultParams::walk(w);
+        static constexpr QTypedJson::FieldName fieldNames[] = {
+            "identifier", "previousResultIds"
+        };
+        field(w, fieldNames[0], identifier);
+        field(w, fieldNames[1], previousResultIds);
+    }
+};
+
+class Q_LANGUAGESERVER_EXPORT WorkspaceFullDocumentDiagnosticReport
+    : public FullDocumentDiagnosticReport
+{
+public:
+    QByteArray uri = {};
+    std::variant<int, std::nullptr_t> version = nullptr;
+
+    template<typename W>
+    void walk(W &w)
+    {
+        FullDocumentDiagnosticReport::walk(w);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "uri", "version" };
+        field(w, fieldNames[0], uri);
+        field(w, fieldNames[1], version);
+    }
+};
+
+class Q_LANGUAGESERVER_EXPORT WorkspaceUnchangedDocumentDiagnosticReport
+    : public UnchangedDocumentDiagnosticReport
+{
+public:
+    QByteArray uri = {};
+    std::variant<int, std::nullptr_t> version = nullptr;
+
+    template<typename W>
+    void walk(W &w)
+    {
+        UnchangedDocumentDiagnosticReport::walk(w);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "uri", "version" };
+        field(w, fieldNames[0], uri);
+        field(w, fieldNames[1], version);
+    }
+};
+
+class Q_LANGUAGESERVER_EXPORT WorkspaceDiagnosticReport
+{
+public:
+    QList<std::variant<WorkspaceFullDocumentDiagnosticReport,
+                       WorkspaceUnchangedDocumentDiagnosticReport>>
+            items = {};
+
+    template<typename W>
+    void walk(W &w)
+    {
+        static constexpr QTypedJson::FieldName fieldNames[] = { "items" };
+        field(w, fieldNames[0], items);
+    }
+};
+
+class Q_LANGUAGESERVER_EXPORT WorkspaceDiagnosticReportPartialResult
+{
+public:
+    QList<std::variant<WorkspaceFullDocumentDiagnosticReport,
+                       WorkspaceUnchangedDocumentDiagnosticReport>>
+            items = {};
+
+    template<typename W>
+    void walk(W &w)
+    {
+        static constexpr QTypedJson::FieldName fieldNames[] = { "items" };
+        field(w, fieldNames[0], items);
+    }
+};
+
+class Q_LANGUAGESERVER_EXPORT DiagnosticWorkspaceClientCapabilities
+{
+public:
+    std::optional<bool> refreshSupport = {};
+
+    template<typename W>
+    void walk(W &w)
+    {
+        static constexpr QTypedJson::FieldName fieldNames[] = { "refreshSupport" };
+        field(w, fieldNames[0], refreshSupport);
     }
 };
 
@@ -3983,402 +4626,370 @@ public:
 namespace QTypedJson {
 
 template<>
-inline QString enumToString<QLspSpecification::TraceValue>(QLspSpecification::TraceValue value)
+struct EnumTraits<QLspSpecification::TraceValue>
 {
-    switch (value) {
-    case QLspSpecification::TraceValue::Off:
-        return QLatin1String("off");
-    case QLspSpecification::TraceValue::Messages:
-        return QLatin1String("messages");
-    case QLspSpecification::TraceValue::Verbose:
-        return QLatin1String("verbose");
-    }
-    return QString();
-}
+    static constexpr bool isNumber = false;
+    static constexpr QByteArrayView names[] = {
+        "off",
+        "messages",
+        "verbose",
+    };
+    static constexpr EnumEntry<QLspSpecification::TraceValue> sortedEntries[] = {
+        { "messages", QLspSpecification::TraceValue::Messages },
+        { "off", QLspSpecification::TraceValue::Off },
+        { "verbose", QLspSpecification::TraceValue::Verbose },
+    };
+};
 
 template<>
-inline QString enumToString<QLspSpecification::ErrorCodes>(QLspSpecification::ErrorCodes value)
+struct EnumTraits<QLspSpecification::ErrorCodes>
 {
-    return enumToIntString<QLspSpecification::ErrorCodes>(value);
-}
+    static constexpr bool isNumber = true;
+};
 
 template<>
-inline QString
-enumToString<QLspSpecification::DiagnosticSeverity>(QLspSpecification::DiagnosticSeverity value)
+struct EnumTraits<QLspSpecification::DiagnosticSeverity>
 {
-    return enumToIntString<QLspSpecification::DiagnosticSeverity>(value);
-}
+    static constexpr bool isNumber = true;
+};
 
 template<>
-inline QString
-enumToString<QLspSpecification::DiagnosticTag>(QLspSpecification::DiagnosticTag value)
+struct EnumTraits<QLspSpecification::DiagnosticTag>
 {
-    return enumToIntString<QLspSpecification::DiagnosticTag>(value);
-}
+    static constexpr bool isNumber = true;
+};
 
 template<>
-inline QString enumToString<QLspSpecification::ResourceOperationKind>(
-        QLspSpecification::ResourceOperationKind value)
+struct EnumTraits<QLspSpecification::ResourceOperationKind>
 {
-    switch (value) {
-    case QLspSpecification::ResourceOperationKind::Create:
-        return QLatin1String("create");
-    case QLspSpecification::ResourceOperationKind::Rename:
-        return QLatin1String("rename");
-    case QLspSpecification::ResourceOperationKind::Delete:
-        return QLatin1String("delete");
-    default:
-        return QString::number(int(value));
-    }
-}
+    static constexpr bool isNumber = false;
+    static constexpr QByteArrayView names[] = {
+        "create",
+        "rename",
+        "delete",
+    };
+    static constexpr EnumEntry<QLspSpecification::ResourceOperationKind> sortedEntries[] = {
+        { "create", QLspSpecification::ResourceOperationKind::Create },
+        { "delete", QLspSpecification::ResourceOperationKind::Delete },
+        { "rename", QLspSpecification::ResourceOperationKind::Rename },
+    };
+};
 
 template<>
-inline QString
-enumToString<QLspSpecification::FailureHandlingKind>(QLspSpecification::FailureHandlingKind value)
-{
-    switch (value) {
-    case QLspSpecification::FailureHandlingKind::Abort:
-        return QLatin1String("abort");
-    case QLspSpecification::FailureHandlingKind::Transactional:
-        return QLatin1String("transactional");
-    case QLspSpecification::FailureHandlingKind::TextOnlyTransactional:
-        return QLatin1String("textOnlyTransactional");
-    case QLspSpecification::FailureHandlingKind::Undo:
-        return QLatin1String("undo");
-    default:
-        return QString::number(int(value));
-    }
-}
+struct EnumTraits<QLspSpecification::FailureHandlingKind>
+{
+    static constexpr bool isNumber = false;
+    static constexpr QByteArrayView names[] = {
+        "abort",
+        "transactional",
+        "textOnlyTransactional",
+        "undo",
+    };
+    static constexpr EnumEntry<QLspSpecification::FailureHandlingKind> sortedEntries[] = {
+        { "abort", QLspSpecification::FailureHandlingKind::Abort },
+        { "textOnlyTransactional", QLspSpecification::FailureHandlingKind::TextOnlyTransactional },
+        { "transactional", QLspSpecification::FailureHandlingKind::Transactional },
+        { "undo", QLspSpecification::FailureHandlingKind::Undo },
+    };
+};
 
 template<>
-inline QString enumToString<QLspSpecification::MarkupKind>(QLspSpecification::MarkupKind value)
+struct EnumTraits<QLspSpecification::MarkupKind>
 {
-    switch (value) {
-    case QLspSpecification::MarkupKind::PlainText:
-        return QLatin1String("plaintext");
-    case QLspSpecification::MarkupKind::Markdown:
-        return QLatin1String("markdown");
-    default:
-        return QString::number(int(value));
-    }
-}
+    static constexpr bool isNumber = false;
+    static constexpr QByteArrayView names[] = {
+        "plaintext",
+        "markdown",
+    };
+    static constexpr EnumEntry<QLspSpecification::MarkupKind> sortedEntries[] = {
+        { "markdown", QLspSpecification::MarkupKind::Markdown },
+        { "plaintext", QLspSpecification::MarkupKind::PlainText },
+    };
+};
 
 template<>
-inline QString
-enumToString<QLspSpecification::InitializeErrorCode>(QLspSpecification::InitializeErrorCode value)
+struct EnumTraits<QLspSpecification::InitializeErrorCode>
 {
-    return enumToIntString<QLspSpecification::InitializeErrorCode>(value);
-}
+    static constexpr bool isNumber = true;
+};
 
 template<>
-inline QString enumToString<QLspSpecification::MessageType>(QLspSpecification::MessageType value)
+struct EnumTraits<QLspSpecification::MessageType>
 {
-    return enumToIntString<QLspSpecification::MessageType>(value);
-}
+    static constexpr bool isNumber = true;
+};
 
 template<>
-inline QString enumToString<QLspSpecification::WatchKind>(QLspSpecification::WatchKind value)
+struct EnumTraits<QLspSpecification::WatchKind>
 {
-    return enumToIntString<QLspSpecification::WatchKind>(value);
-}
+    static constexpr bool isNumber = true;
+};
 
 template<>
-inline QString
-enumToString<QLspSpecification::FileChangeType>(QLspSpecification::FileChangeType value)
+struct EnumTraits<QLspSpecification::FileChangeType>
 {
-    return enumToIntString<QLspSpecification::FileChangeType>(value);
-}
+    static constexpr bool isNumber = true;
+};
 
 template<>
-inline QString enumToString<QLspSpecification::FileOperationPatternKind>(
-        QLspSpecification::FileOperationPatternKind value)
+struct EnumTraits<QLspSpecification::FileOperationPatternKind>
 {
-    switch (value) {
-    case QLspSpecification::FileOperationPatternKind::File:
-        return QLatin1String("file");
-    case QLspSpecification::FileOperationPatternKind::Folder:
-        return QLatin1String("folder");
-    default:
-        return QString::number(int(value));
-    }
-}
+    static constexpr bool isNumber = false;
+    static constexpr QByteArrayView names[] = {
+        "file",
+        "folder",
+    };
+    static constexpr EnumEntry<QLspSpecification::FileOperationPatternKind> sortedEntries[] = {
+        { "file", QLspSpecification::FileOperationPatternKind::File },
+        { "folder", QLspSpecification::FileOperationPatternKind::Folder },
+    };
+};
 
 template<>
-inline QString
-enumToString<QLspSpecification::TextDocumentSyncKind>(QLspSpecification::TextDocumentSyncKind value)
+struct EnumTraits<QLspSpecification::TextDocumentSyncKind>
 {
-    return enumToIntString<QLspSpecification::TextDocumentSyncKind>(value);
-}
+    static constexpr bool isNumber = true;
+};
 
 template<>
-inline QString enumToString<QLspSpecification::TextDocumentSaveReason>(
-        QLspSpecification::TextDocumentSaveReason value)
+struct EnumTraits<QLspSpecification::TextDocumentSaveReason>
 {
-    return enumToIntString<QLspSpecification::TextDocumentSaveReason>(value);
-}
+    static constexpr bool isNumber = true;
+};
 
 template<>
-inline QString enumToString<QLspSpecification::CompletionTriggerKind>(
-        QLspSpecification::CompletionTriggerKind value)
+struct EnumTraits<QLspSpecification::CompletionTriggerKind>
 {
-    return enumToIntString<QLspSpecification::CompletionTriggerKind>(value);
-}
+    static constexpr bool isNumber = true;
+};
 
 template<>
-inline QString
-enumToString<QLspSpecification::InsertTextFormat>(QLspSpecification::InsertTextFormat value)
+struct EnumTraits<QLspSpecification::InsertTextFormat>
 {
-    return enumToIntString<QLspSpecification::InsertTextFormat>(value);
-}
+    static constexpr bool isNumber = true;
+};
 
 template<>
-inline QString
-enumToString<QLspSpecification::CompletionItemTag>(QLspSpecification::CompletionItemTag value)
+struct EnumTraits<QLspSpecification::CompletionItemTag>
 {
-    return enumToIntString<QLspSpecification::CompletionItemTag>(value);
-}
+    static constexpr bool isNumber = true;
+};
 
 template<>
-inline QString
-enumToString<QLspSpecification::InsertTextMode>(QLspSpecification::InsertTextMode value)
+struct EnumTraits<QLspSpecification::InsertTextMode>
 {
-    return enumToIntString<QLspSpecification::InsertTextMode>(value);
-}
+    static constexpr bool isNumber = true;
+};
 
 template<>
-inline QString
-enumToString<QLspSpecification::CompletionItemKind>(QLspSpecification::CompletionItemKind value)
+struct EnumTraits<QLspSpecification::CompletionItemKind>
 {
-    return enumToIntString<QLspSpecification::CompletionItemKind>(value);
-}
+    static constexpr bool isNumber = true;
+};
 
 template<>
-inline QString enumToString<QLspSpecification::SignatureHelpTriggerKind>(
-        QLspSpecification::SignatureHelpTriggerKind value)
+struct EnumTraits<QLspSpecification::SignatureHelpTriggerKind>
 {
-    return enumToIntString<QLspSpecification::SignatureHelpTriggerKind>(value);
-}
+    static constexpr bool isNumber = true;
+};
 
 template<>
-inline QString enumToString<QLspSpecification::DocumentHighlightKind>(
-        QLspSpecification::DocumentHighlightKind value)
+struct EnumTraits<QLspSpecification::DocumentHighlightKind>
 {
-    return enumToIntString<QLspSpecification::DocumentHighlightKind>(value);
-}
+    static constexpr bool isNumber = true;
+};
 
 template<>
-inline QString enumToString<QLspSpecification::SymbolKind>(QLspSpecification::SymbolKind value)
+struct EnumTraits<QLspSpecification::SymbolKind>
 {
-    return enumToIntString<QLspSpecification::SymbolKind>(value);
-}
+    static constexpr bool isNumber = true;
+};
 
 template<>
-inline QString enumToString<QLspSpecification::SymbolTag>(QLspSpecification::SymbolTag value)
+struct EnumTraits<QLspSpecification::SymbolTag>
 {
-    return enumToIntString<QLspSpecification::SymbolTag>(value);
-}
-
-template<>
-inline QString
-enumToString<QLspSpecification::CodeActionKind>(QLspSpecification::CodeActionKind value)
-{
-    switch (value) {
-    case QLspSpecification::CodeActionKind::Empty:
-        return QLatin1String("");
-    case QLspSpecification::CodeActionKind::QuickFix:
-        return QLatin1String("quickfix");
-    case QLspSpecification::CodeActionKind::Refactor:
-        return QLatin1String("refactor");
-    case QLspSpecification::CodeActionKind::RefactorExtract:
-        return QLatin1String("refactor.extract");
-    case QLspSpecification::CodeActionKind::RefactorInline:
-        return QLatin1String("refactor.inline");
-    case QLspSpecification::CodeActionKind::RefactorRewrite:
-        return QLatin1String("refactor.rewrite");
-    case QLspSpecification::CodeActionKind::Source:
-        return QLatin1String("source");
-    case QLspSpecification::CodeActionKind::SourceOrganizeImports:
-        return QLatin1String("source.organizeImports");
-    default:
-        return QString::number(int(value));
-    }
-}
+    static constexpr bool isNumber = true;
+};
 
 template<>
-inline QLspSpecification::CodeActionKind
-enumFromString<QLspSpecification::CodeActionKind>(const QString &string)
-{
-    if (string.compare(QLatin1String(""), Qt::CaseInsensitive) == 0)
-        return QLspSpecification::CodeActionKind::Empty;
-    else if (string.compare(QLatin1String("quickfix"), Qt::CaseInsensitive) == 0)
-        return QLspSpecification::CodeActionKind::QuickFix;
-    else if (string.compare(QLatin1String("refactor"), Qt::CaseInsensitive) == 0)
-        return QLspSpecification::CodeActionKind::Refactor;
-    else if (string.compare(QLatin1String("refactor.extract"), Qt::CaseInsensitive) == 0)
-        return QLspSpecification::CodeActionKind::RefactorExtract;
-    else if (string.compare(QLatin1String("refactor.inline"), Qt::CaseInsensitive) == 0)
-        return QLspSpecification::CodeActionKind::RefactorInline;
-    else if (string.compare(QLatin1String("refactor.rewrite"), Qt::CaseInsensitive) == 0)
-        return QLspSpecification::CodeActionKind::RefactorRewrite;
-    else if (string.compare(QLatin1String("source"), Qt::CaseInsensitive) == 0)
-        return QLspSpecification::CodeActionKind::Source;
-    else if (string.compare(QLatin1String("source.organizeImports"), Qt::CaseInsensitive) == 0)
-        return QLspSpecification::CodeActionKind::SourceOrganizeImports;
-    return QLspSpecification::CodeActionKind{};
-}
+struct EnumTraits<QLspSpecification::CodeActionKind>
+{
+    static constexpr bool isNumber = false;
+    static constexpr QByteArrayView names[] = {
+        "",
+        "quickfix",
+        "refactor",
+        "refactor.extract",
+        "refactor.inline",
+        "refactor.rewrite",
+        "source",
+        "source.organizeImports",
+    };
+    static constexpr EnumEntry<QLspSpecification::CodeActionKind> sortedEntries[] = {
+        { "", QLspSpecification::CodeActionKind::Empty },
+        { "quickfix", QLspSpecification::CodeActionKind::QuickFix },
+        { "refactor", QLspSpecification::CodeActionKind::Refactor },
+        { "refactor.extract", QLspSpecification::CodeActionKind::RefactorExtract },
+        { "refactor.inline", QLspSpecification::CodeActionKind::RefactorInline },
+        { "refactor.rewrite", QLspSpecification::CodeActionKind::RefactorRewrite },
+        { "source", QLspSpecification::CodeActionKind::Source },
+        { "source.organizeImports", QLspSpecification::CodeActionKind::SourceOrganizeImports },
+    };
+};
 
 template<>
-inline QString enumToString<QLspSpecification::PrepareSupportDefaultBehavior>(
-        QLspSpecification::PrepareSupportDefaultBehavior value)
+struct EnumTraits<QLspSpecification::PrepareSupportDefaultBehavior>
 {
-    return enumToIntString<QLspSpecification::PrepareSupportDefaultBehavior>(value);
-}
+    static constexpr bool isNumber = true;
+};
 
 template<>
-inline QString
-enumToString<QLspSpecification::FoldingRangeKind>(QLspSpecification::FoldingRangeKind value)
+struct EnumTraits<QLspSpecification::FoldingRangeKind>
 {
-    switch (value) {
-    case QLspSpecification::FoldingRangeKind::Comment:
-        return QLatin1String("comment");
-    case QLspSpecification::FoldingRangeKind::Imports:
-        return QLatin1String("imports");
-    case QLspSpecification::FoldingRangeKind::Region:
-        return QLatin1String("region");
-    default:
-        return QString::number(int(value));
-    }
-}
+    static constexpr bool isNumber = false;
+    static constexpr QByteArrayView names[] = {
+        "comment",
+        "imports",
+        "region",
+    };
+    static constexpr EnumEntry<QLspSpecification::FoldingRangeKind> sortedEntries[] = {
+        { "comment", QLspSpecification::FoldingRangeKind::Comment },
+        { "imports", QLspSpecification::FoldingRangeKind::Imports },
+        { "region", QLspSpecification::FoldingRangeKind::Region },
+    };
+};
 
 template<>
-inline QString
-enumToString<QLspSpecification::SemanticTokenTypes>(QLspSpecification::SemanticTokenTypes value)
-{
-    switch (value) {
-    case QLspSpecification::SemanticTokenTypes::Namespace:
-        return QLatin1String("namespace");
-    case QLspSpecification::SemanticTokenTypes::Type:
-        return QLatin1String("type");
-    case QLspSpecification::SemanticTokenTypes::Class:
-        return QLatin1String("class");
-    case QLspSpecification::SemanticTokenTypes::Enum:
-        return QLatin1String("enum");
-    case QLspSpecification::SemanticTokenTypes::Interface:
-        return QLatin1String("interface");
-    case QLspSpecification::SemanticTokenTypes::Struct:
-        return QLatin1String("struct");
-    case QLspSpecification::SemanticTokenTypes::TypeParameter:
-        return QLatin1String("typeParameter");
-    case QLspSpecification::SemanticTokenTypes::Parameter:
-        return QLatin1String("parameter");
-    case QLspSpecification::SemanticTokenTypes::Variable:
-        return QLatin1String("variable");
-    case QLspSpecification::SemanticTokenTypes::Property:
-        return QLatin1String("property");
-    case QLspSpecification::SemanticTokenTypes::EnumMember:
-        return QLatin1String("enumMember");
-    case QLspSpecification::SemanticTokenTypes::Event:
-        return QLatin1String("event");
-    case QLspSpecification::SemanticTokenTypes::Function:
-        return QLatin1String("function");
-    case QLspSpecification::SemanticTokenTypes::Method:
-        return QLatin1String("method");
-    case QLspSpecification::SemanticTokenTypes::Macro:
-        return QLatin1String("macro");
-    case QLspSpecification::SemanticTokenTypes::Keyword:
-        return QLatin1String("keyword");
-    case QLspSpecification::SemanticTokenTypes::Modifier:
-        return QLatin1String("modifier");
-    case QLspSpecification::SemanticTokenTypes::Comment:
-        return QLatin1String("comment");
-    case QLspSpecification::SemanticTokenTypes::String:
-        return QLatin1String("string");
-    case QLspSpecification::SemanticTokenTypes::Number:
-        return QLatin1String("number");
-    case QLspSpecification::SemanticTokenTypes::Regexp:
-        return QLatin1String("regexp");
-    case QLspSpecification::SemanticTokenTypes::Operator:
-        return QLatin1String("operator");
-    default:
-        return QString::number(int(value));
-    }
-}
+struct EnumTraits<QLspSpecification::SemanticTokenTypes>
+{
+    static constexpr bool isNumber = false;
+    static constexpr QByteArrayView names[] = {
+        "namespace",
+        "type",
+        "class",
+        "enum",
+        "interface",
+        "struct",
+        "typeParameter",
+        "parameter",
+        "variable",
+        "property",
+        "enumMember",
+        "event",
+        "function",
+        "method",
+        "macro",
+        "keyword",
+        "modifier",
+        "comment",
+        "string",
+        "number",
+        "regexp",
+        "operator",
+    };
+    static constexpr EnumEntry<QLspSpecification::SemanticTokenTypes> sortedEntries[] = {
+        { "class", QLspSpecification::SemanticTokenTypes::Class },
+        { "comment", QLspSpecification::SemanticTokenTypes::Comment },
+        { "enum", QLspSpecification::SemanticTokenTypes::Enum },
+        { "enumMember", QLspSpecification::SemanticTokenTypes::EnumMember },
+        { "event", QLspSpecification::SemanticTokenTypes::Event },
+        { "function", QLspSpecification::SemanticTokenTypes::Function },
+        { "interface", QLspSpecification::SemanticTokenTypes::Interface },
+        { "keyword", QLspSpecification::SemanticTokenTypes::Keyword },
+        { "macro", QLspSpecification::SemanticTokenTypes::Macro },
+        { "method", QLspSpecification::SemanticTokenTypes::Method },
+        { "modifier", QLspSpecification::SemanticTokenTypes::Modifier },
+        { "namespace", QLspSpecification::SemanticTokenTypes::Namespace },
+        { "number", QLspSpecification::SemanticTokenTypes::Number },
+        { "operator", QLspSpecification::SemanticTokenTypes::Operator },
+        { "parameter", QLspSpecification::SemanticTokenTypes::Parameter },
+        { "property", QLspSpecification::SemanticTokenTypes::Property },
+        { "regexp", QLspSpecification::SemanticTokenTypes::Regexp },
+        { "string", QLspSpecification::SemanticTokenTypes::String },
+        { "struct", QLspSpecification::SemanticTokenTypes::Struct },
+        { "type", QLspSpecification::SemanticTokenTypes::Type },
+        { "typeParameter", QLspSpecification::SemanticTokenTypes::TypeParameter },
+        { "variable", QLspSpecification::SemanticTokenTypes::Variable },
+    };
+};
 
 template<>
-inline QString enumToString<QLspSpecification::SemanticTokenModifiers>(
-        QLspSpecification::SemanticTokenModifiers value)
-{
-    switch (value) {
-    case QLspSpecification::SemanticTokenModifiers::Declaration:
-        return QLatin1String("declaration");
-    case QLspSpecification::SemanticTokenModifiers::Definition:
-        return QLatin1String("definition");
-    case QLspSpecification::SemanticTokenModifiers::Readonly:
-        return QLatin1String("readonly");
-    case QLspSpecification::SemanticTokenModifiers::Static:
-        return QLatin1String("static");
-    case QLspSpecification::SemanticTokenModifiers::Deprecated:
-        return QLatin1String("deprecated");
-    case QLspSpecification::SemanticTokenModifiers::Abstract:
-        return QLatin1String("abstract");
-    case QLspSpecification::SemanticTokenModifiers::Async:
-        return QLatin1String("async");
-    case QLspSpecification::SemanticTokenModifiers::Modification:
-        return QLatin1String("modification");
-    case QLspSpecification::SemanticTokenModifiers::Documentation:
-        return QLatin1String("documentation");
-    case QLspSpecification::SemanticTokenModifiers::DefaultLibrary:
-        return QLatin1String("defaultLibrary");
-    default:
-        return QString::number(int(value));
-    }
-}
+struct EnumTraits<QLspSpecification::SemanticTokenModifiers>
+{
+    static constexpr bool isNumber = false;
+    static constexpr QByteArrayView names[] = {
+        "declaration",
+        "definition",
+        "readonly",
+        "static",
+        "deprecated",
+        "abstract",
+        "async",
+        "modification",
+        "documentation",
+        "defaultLibrary",
+    };
+    static constexpr EnumEntry<QLspSpecification::SemanticTokenModifiers> sortedEntries[] = {
+        { "abstract", QLspSpecification::SemanticTokenModifiers::Abstract },
+        { "async", QLspSpecification::SemanticTokenModifiers::Async },
+        { "declaration", QLspSpecification::SemanticTokenModifiers::Declaration },
+        { "defaultLibrary", QLspSpecification::SemanticTokenModifiers::DefaultLibrary },
+        { "definition", QLspSpecification::SemanticTokenModifiers::Definition },
+        { "deprecated", QLspSpecification::SemanticTokenModifiers::Deprecated },
+        { "documentation", QLspSpecification::SemanticTokenModifiers::Documentation },
+        { "modification", QLspSpecification::SemanticTokenModifiers::Modification },
+        { "readonly", QLspSpecification::SemanticTokenModifiers::Readonly },
+        { "static", QLspSpecification::SemanticTokenModifiers::Static },
+    };
+};
 
 template<>
-inline QString enumToString<QLspSpecification::TokenFormat>(QLspSpecification::TokenFormat value)
+struct EnumTraits<QLspSpecification::TokenFormat>
 {
-    switch (value) {
-    case QLspSpecification::TokenFormat::Relative:
-        return QLatin1String("relative");
-    default:
-        return QString::number(int(value));
-    }
-}
+    static constexpr bool isNumber = false;
+    static constexpr QByteArrayView names[] = {
+        "relative",
+    };
+    static constexpr EnumEntry<QLspSpecification::TokenFormat> sortedEntries[] = {
+        { "relative", QLspSpecification::TokenFormat::Relative },
+    };
+};
 
 template<>
-inline QString
-enumToString<QLspSpecification::UniquenessLevel>(QLspSpecification::UniquenessLevel value)
-{
-    switch (value) {
-    case QLspSpecification::UniquenessLevel::Document:
-        return QLatin1String("document");
-    case QLspSpecification::UniquenessLevel::Project:
-        return QLatin1String("project");
-    case QLspSpecification::UniquenessLevel::Group:
-        return QLatin1String("group");
-    case QLspSpecification::UniquenessLevel::Scheme:
-        return QLatin1String("scheme");
-    case QLspSpecification::UniquenessLevel::Global:
-        return QLatin1String("global");
-    default:
-        return QString::number(int(value));
-    }
-}
+struct EnumTraits<QLspSpecification::UniquenessLevel>
+{
+    static constexpr bool isNumber = false;
+    static constexpr QByteArrayView names[] = {
+        "document",
+        "project",
+        "group",
+        "scheme",
+        "global",
+    };
+    static constexpr EnumEntry<QLspSpecification::UniquenessLevel> sortedEntries[] = {
+        { "document", QLspSpecification::UniquenessLevel::Document },
+        { "global", QLspSpecification::UniquenessLevel::Global },
+        { "group", QLspSpecification::UniquenessLevel::Group },
+        { "project", QLspSpecification::UniquenessLevel::Project },
+        { "scheme", QLspSpecification::UniquenessLevel::Scheme },
+    };
+};
 
 template<>
-inline QString enumToString<QLspSpecification::MonikerKind>(QLspSpecification::MonikerKind value)
-{
-    switch (value) {
-    case QLspSpecification::MonikerKind::Import:
-        return QLatin1String("import");
-    case QLspSpecification::MonikerKind::Export:
-        return QLatin1String("export");
-    case QLspSpecification::MonikerKind::Local:
-        return QLatin1String("local");
-    default:
-        return QString::number(int(value));
-    }
-}
+struct EnumTraits<QLspSpecification::MonikerKind>
+{
+    static constexpr bool isNumber = false;
+    static constexpr QByteArrayView names[] = {
+        "import",
+        "export",
+        "local",
+    };
+    static constexpr EnumEntry<QLspSpecification::MonikerKind> sortedEntries[] = {
+        { "export", QLspSpecification::MonikerKind::Export },
+        { "import", QLspSpecification::MonikerKind::Import },
+        { "local", QLspSpecification::MonikerKind::Local },
+    };
+};
 
 } // namespace QTypedJson
 QT_END_NAMESPACE
@@ -0,0 +1,41 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QLSPASCII_P_H
+#define QLSPASCII_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtLanguageServer/qtlanguageserverglobal.h>
+
+#include <cstring>
+
+QT_BEGIN_NAMESPACE
+
+// helpers scanning UTF-8 text eight bytes at a time
+namespace QLspAscii {
+
+constexpr quint64 HighBits = 0x8080808080808080ULL;
+
+// whether the 8 bytes starting at it are all ASCII
+inline bool isAsciiWord(const char *it)
+{
+    quint64 word;
+    std::memcpy(&word, it, sizeof(word));
+    return !(word & HighBits);
+}
+
+} // namespace QLspAscii
+
+QT_END_NAMESPACE
+
+#endif // QLSPASCII_P_H
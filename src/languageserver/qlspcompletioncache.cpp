@@ -0,0 +1,241 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qlspcompletioncache_p.h"
+#include "qlspnotifysignals_p.h"
+
+#include <QtCore/QObject>
+
+#include <algorithm>
+#include <utility>
+#include <variant>
+
+QT_BEGIN_NAMESPACE
+
+using namespace QLspSpecification;
+
+/*!
+\internal
+\class QLspCompletionCache
+\brief Filters the completion candidates of a word on the server while the user types it
+
+Computing the candidates of a completion is often expensive, and the word being completed
+changes with each keystroke. The server computes the candidates once for the start of the word,
+and gives them to setCandidates(). The following textDocument/completion requests for the same
+word start are answered by complete(), which filters the cached candidates with a fuzzy match of
+the typed part of the word, and sends the best maxItems() of them.
+
+When more candidates match, the list is marked isIncomplete, so the client asks again while the
+user types, and gets the best matches of the longer word. Otherwise the client can filter the
+list by itself. The items are sent from the best to the worst match, with a sortText keeping
+that order.
+
+The candidates of a document are kept as long as it is edited only after the start of the word,
+on its line: documentChanged(), or connectNotifications() for the didChange notifications,
+drops them on other edits, and documentClosed() when the document is closed. The candidates
+belong to a version of the document, and documentChanged() advances it with the edits it
+follows, so candidates that missed a change are not used for a later version. The text edits
+of the items are computed for the cursor at the time of setCandidates(), complete() moves their
+end to the current cursor, so that they replace the whole typed part of the word.
+
+\code
+protocol.registerCompletionRequestHandler(
+        [&cache, &store](const QByteArray &, const CompletionParams &params,
+                         CompletionResponseType &&response) {
+            const QByteArray &uri = params.textDocument.uri;
+            const int version = store.snapshot(uri).version();
+            const Position start = wordStart(params);
+            if (!cache.contains(uri, version, start))
+                cache.setCandidates(uri, version, start, computeCandidates(params));
+            response.sendResponse(*cache.complete(uri, version, start, params.position,
+                                                  typedWord(params)));
+        });
+\endcode
+*/
+
+namespace {
+
+// scores of a character of the pattern, depending on where it matches
+constexpr int StartBonus = 8; // the start of the word
+constexpr int BoundaryBonus = 6; // after a non alphanumeric character, or a camelCase hump
+constexpr int ConsecutiveBonus = 4; // right after the previous match
+constexpr int CaseBonus = 1; // with the same case
+constexpr int MaxGapPenalty = 3; // characters skipped since the previous match
+
+constexpr char asciiLower(char c)
+{
+    return (c >= 'A' && c <= 'Z') ? char(c - 'A' + 'a') : c;
+}
+
+constexpr bool isAsciiAlphaNumeric(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+}
+
+// one bit for each character (ignoring case) in text, a word containing all characters of a
+// pattern has all its bits, so most words are rejected without looking at them
+quint64 characterMask(QByteArrayView text)
+{
+    quint64 mask = 0;
+    for (char c : text)
+        mask |= quint64(1) << (uchar(asciiLower(c)) & 63);
+    return mask;
+}
+
+// the edits of an item end at the cursor of the request computing the candidates, the word
+// has been typed further since then
+void moveEditEnd(std::variant<TextEdit, InsertReplaceEdit> &edit, const Position &cursor)
+{
+    if (TextEdit *textEdit = std::get_if<TextEdit>(&edit)) {
+        textEdit->range.end = cursor;
+        return;
+    }
+    InsertReplaceEdit &insertReplace = std::get<InsertReplaceEdit>(edit);
+    // the text replaced after the cursor moved with the typed characters
+    if (insertReplace.replace.end.line == cursor.line) {
+        insertReplace.replace.end.character +=
+                cursor.character - insertReplace.insert.end.character;
+    }
+    insertReplace.insert.end = cursor;
+}
+
+} // namespace
+
+void QLspCompletionCache::setCandidates(const QByteArray &uri, int version,
+                                        const Position &wordStart,
+                                        QList<CompletionItem> candidates)
+{
+    Session &session = m_sessions[uri];
+    session.wordStart = wordStart;
+    session.version = version;
+    session.keys.clear();
+    session.keys.reserve(candidates.size());
+    session.masks.clear();
+    session.masks.reserve(candidates.size());
+    for (const CompletionItem &item : std::as_const(candidates)) {
+        session.keys.append(item.filterText ? *item.filterText : item.label);
+        session.masks.append(characterMask(session.keys.constLast()));
+    }
+    session.items = std::move(candidates);
+}
+
+bool QLspCompletionCache::contains(const QByteArray &uri, int version,
+                                   const Position &wordStart) const
+{
+    auto it = m_sessions.constFind(uri);
+    return it != m_sessions.constEnd() && it->version == version
+            && it->wordStart.line == wordStart.line
+            && it->wordStart.character == wordStart.character;
+}
+
+std::optional<CompletionList> QLspCompletionCache::complete(const QByteArray &uri, int version,
+                                                            const Position &wordStart,
+                                                            const Position &cursor,
+                                                            QByteArrayView pattern) const
+{
+    if (!contains(uri, version, wordStart))
+        return std::nullopt;
+    const Session &session = *m_sessions.constFind(uri);
+
+    struct Match
+    {
+        int score;
+        qsizetype index;
+    };
+    QList<Match> matches;
+    const quint64 patternMask = characterMask(pattern);
+    for (qsizetype i = 0; i < session.items.size(); ++i) {
+        if ((patternMask & ~session.masks.at(i)) != 0)
+            continue;
+        if (const std::optional<int> itemScore = score(pattern, session.keys.at(i)))
+            matches.append(Match { *itemScore, i });
+    }
+    // equal matches keep the order of the candidates
+    const auto better = [](const Match &a, const Match &b) {
+        return a.score > b.score || (a.score == b.score && a.index < b.index);
+    };
+    const qsizetype count = std::min(matches.size(), m_maxItems);
+    std::partial_sort(matches.begin(), matches.begin() + count, matches.end(), better);
+
+    CompletionList res;
+    res.isIncomplete = matches.size() > count;
+    res.items.reserve(count);
+    const qsizetype digits = QByteArray::number(count).size();
+    for (qsizetype rank = 0; rank < count; ++rank) {
+        CompletionItem item = session.items.at(matches.at(rank).index);
+        item.sortText = QByteArray::number(rank).rightJustified(digits, '0');
+        if (item.textEdit)
+            moveEditEnd(*item.textEdit, cursor);
+        res.items.append(std::move(item));
+    }
+    return res;
+}
+
+void QLspCompletionCache::documentChanged(const DidChangeTextDocumentParams &params)
+{
+    auto it = m_sessions.find(params.textDocument.uri);
+    if (it == m_sessions.end())
+        return;
+    // a version not following the candidates' one means that some changes were missed
+    if (params.textDocument.version <= it->version) {
+        m_sessions.erase(it);
+        return;
+    }
+    const Position &start = it->wordStart;
+    for (const TextDocumentContentChangeEvent &change : params.contentChanges) {
+        const bool inWord = change.range && change.range->start.line == start.line
+                && change.range->end.line == start.line
+                && change.range->start.character >= start.character
+                && !change.text.contains('\n');
+        if (!inWord) {
+            m_sessions.erase(it);
+            return;
+        }
+    }
+    it->version = params.textDocument.version;
+}
+
+void QLspCompletionCache::connectNotifications(QLspNotifySignals *notifySignals)
+{
+    QObject::connect(notifySignals, &QLspNotifySignals::receivedDidChangeTextDocumentNotification,
+                     &m_context, [this](const DidChangeTextDocumentParams &params) {
+                         documentChanged(params);
+                     });
+    QObject::connect(notifySignals, &QLspNotifySignals::receivedDidCloseTextDocumentNotification,
+                     &m_context, [this](const DidCloseTextDocumentParams &params) {
+                         documentClosed(params.textDocument.uri);
+                     });
+}
+
+std::optional<int> QLspCompletionCache::score(QByteArrayView pattern, QByteArrayView word)
+{
+    int res = 0;
+    qsizetype next = 0;
+    qsizetype previous = -1;
+    for (const char p : pattern) {
+        const char lowerP = asciiLower(p);
+        while (next < word.size() && asciiLower(word.at(next)) != lowerP)
+            ++next;
+        if (next == word.size())
+            return std::nullopt;
+        const char c = word.at(next);
+        if (next == 0) {
+            res += StartBonus;
+        } else if (next == previous + 1) {
+            res += ConsecutiveBonus;
+        } else {
+            const char before = word.at(next - 1);
+            if (!isAsciiAlphaNumeric(before)
+                || (asciiLower(before) == before && asciiLower(c) != c)) {
+                res += BoundaryBonus;
+            }
+            res -= int(std::min(next - previous - 1, qsizetype(MaxGapPenalty)));
+        }
+        if (c == p)
+            res += CaseBonus;
+        previous = next++;
+    }
+    return res;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,82 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QLSPCOMPLETIONCACHE_P_H
+#define QLSPCOMPLETIONCACHE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtLanguageServer/qtlanguageserverglobal.h>
+#include <QtLanguageServer/private/qlanguageserverspec_p.h>
+#include <QtCore/QByteArray>
+#include <QtCore/QByteArrayView>
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QObject>
+
+#include <optional>
+
+QT_BEGIN_NAMESPACE
+
+class QLspNotifySignals;
+
+class Q_LANGUAGESERVER_EXPORT QLspCompletionCache
+{
+    Q_DISABLE_COPY_MOVE(QLspCompletionCache)
+public:
+    QLspCompletionCache() = default;
+
+    // the number of items sent at most, the rest is left to later requests
+    qsizetype maxItems() const { return m_maxItems; }
+    void setMaxItems(qsizetype maxItems) { m_maxItems = maxItems; }
+    qsizetype size() const { return m_sessions.size(); }
+    void clear() { m_sessions.clear(); }
+
+    // remembers the candidates computed for the word starting at wordStart in version of uri
+    void setCandidates(const QByteArray &uri, int version,
+                       const QLspSpecification::Position &wordStart,
+                       QList<QLspSpecification::CompletionItem> candidates);
+    bool contains(const QByteArray &uri, int version,
+                  const QLspSpecification::Position &wordStart) const;
+    // the best cached candidates matching pattern (the part of the word typed so far, up to
+    // cursor), if the candidates for the word are known in this version of the document
+    std::optional<QLspSpecification::CompletionList>
+    complete(const QByteArray &uri, int version, const QLspSpecification::Position &wordStart,
+             const QLspSpecification::Position &cursor, QByteArrayView pattern) const;
+
+    // follows the edits of the word being completed, drops the candidates on other edits
+    void documentChanged(const QLspSpecification::DidChangeTextDocumentParams &params);
+    void documentClosed(const QByteArray &uri) { m_sessions.remove(uri); }
+    void connectNotifications(QLspNotifySignals *notifySignals);
+
+    // the fuzzy match score of word for pattern, higher is better, none if it does not match
+    static std::optional<int> score(QByteArrayView pattern, QByteArrayView word);
+
+private:
+    struct Session
+    {
+        QLspSpecification::Position wordStart;
+        int version = 0; // of the document, advanced by documentChanged()
+        QList<QLspSpecification::CompletionItem> items;
+        QList<QByteArray> keys; // the filterText, or label, of each item
+        QList<quint64> masks; // the characters of each key, see characterMask()
+    };
+
+    QHash<QByteArray, Session> m_sessions;
+    qsizetype m_maxItems = 100;
+    // context of the notification connections, destroyed first, which disconnects them
+    QObject m_context;
+};
+
+QT_END_NAMESPACE
+
+#endif // QLSPCOMPLETIONCACHE_P_H
@@ -0,0 +1,160 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qlspdiagnosticreports_p.h"
+
+#include <QtJsonRpc/private/qtypedjsonhash_p.h>
+#include <QtCore/QSet>
+
+#include <utility>
+
+QT_BEGIN_NAMESPACE
+
+using namespace QLspSpecification;
+
+/*!
+\internal
+\class QLspDiagnosticReports
+\brief Answers the LSP 3.17 pull diagnostics requests, reporting unchanged documents by resultId
+
+With pull diagnostics the client asks for the diagnostics of a document (textDocument/diagnostic)
+or of the whole workspace (workspace/diagnostic), passing the resultId of the diagnostics it
+already has. QLspDiagnosticReports keeps the current diagnostics of each document, set by the
+analyzers with setDiagnostics(), and answers with an "unchanged" report, which carries no
+diagnostics, when the resultId of the client is still current. So the client decides when and
+how often the diagnostics are sent, and the unchanged documents cost only their uri.
+
+The resultId is the contentHash() of the diagnostics: it does not depend on the order of the
+updates, a document whose diagnostics return to a previous state gets back the resultId the
+client has, and the ids stay valid after a restart of the server. Documents without diagnostics
+are not stored, their resultId is the one of the empty list.
+
+setDiagnostics() returns true when the diagnostics of the document changed: the server can then
+ask the client to pull them again with requestDiagnosticRefresh(), if it has refreshSupport.
+
+\code
+protocol.registerDocumentDiagnosticRequestHandler(
+        [&reports](const QByteArray &, const DocumentDiagnosticParams &params,
+                   DocumentDiagnosticResponseType &&response) {
+            response.sendResponse(reports.documentReport(params));
+        });
+\endcode
+*/
+
+namespace {
+
+template<typename Report>
+Report fullReport(const QByteArray &resultId, const QList<Diagnostic> &diagnostics)
+{
+    Report report;
+    report.kind = "full";
+    report.resultId = resultId;
+    report.items = diagnostics;
+    return report;
+}
+
+template<typename Report>
+Report unchangedReport(const QByteArray &resultId)
+{
+    Report report;
+    report.kind = "unchanged";
+    report.resultId = resultId;
+    return report;
+}
+
+} // namespace
+
+bool QLspDiagnosticReports::setDiagnostics(const QByteArray &uri, QList<Diagnostic> diagnostics,
+                                           std::optional<int> version)
+{
+    const QByteArray newId = resultIdFor(diagnostics);
+    if (diagnostics.isEmpty()) {
+        const bool changed = m_documents.contains(uri);
+        m_documents.remove(uri);
+        return changed;
+    }
+    Document &doc = m_documents[uri];
+    doc.version = version;
+    if (doc.resultId == newId)
+        return false;
+    doc.resultId = newId;
+    doc.diagnostics = std::move(diagnostics);
+    return true;
+}
+
+void QLspDiagnosticReports::remove(const QByteArray &uri)
+{
+    m_documents.remove(uri);
+}
+
+QList<Diagnostic> QLspDiagnosticReports::diagnostics(const QByteArray &uri) const
+{
+    auto it = m_documents.constFind(uri);
+    return (it == m_documents.constEnd()) ? QList<Diagnostic>() : it->diagnostics;
+}
+
+QByteArray QLspDiagnosticReports::resultId(const QByteArray &uri) const
+{
+    auto it = m_documents.constFind(uri);
+    return (it == m_documents.constEnd()) ? resultIdFor({}) : it->resultId;
+}
+
+Responses::DocumentDiagnosticResultType
+QLspDiagnosticReports::documentReport(const DocumentDiagnosticParams &params) const
+{
+    const QByteArray &uri = params.textDocument.uri;
+    const QByteArray currentId = resultId(uri);
+    if (params.previousResultId && *params.previousResultId == currentId)
+        return unchangedReport<RelatedUnchangedDocumentDiagnosticReport>(currentId);
+    return fullReport<RelatedFullDocumentDiagnosticReport>(currentId, diagnostics(uri));
+}
+
+WorkspaceDiagnosticReport
+QLspDiagnosticReports::workspaceReport(const WorkspaceDiagnosticParams &params) const
+{
+    WorkspaceDiagnosticReport res;
+    res.items.reserve(m_documents.size() + params.previousResultIds.size());
+    QSet<QByteArray> reported;
+    reported.reserve(params.previousResultIds.size());
+    // the documents known by the client, including the ones that lost their diagnostics
+    for (const PreviousResultId &previous : params.previousResultIds) {
+        if (reported.contains(previous.uri))
+            continue;
+        reported.insert(previous.uri);
+        const auto it = m_documents.constFind(previous.uri);
+        const bool known = it != m_documents.constEnd();
+        const QByteArray currentId = known ? it->resultId : resultIdFor({});
+        if (previous.value == currentId) {
+            auto report = unchangedReport<WorkspaceUnchangedDocumentDiagnosticReport>(currentId);
+            report.uri = previous.uri;
+            if (known && it->version)
+                report.version = *it->version;
+            res.items.append(std::move(report));
+        } else {
+            auto report = fullReport<WorkspaceFullDocumentDiagnosticReport>(
+                    currentId, known ? it->diagnostics : QList<Diagnostic>());
+            report.uri = previous.uri;
+            if (known && it->version)
+                report.version = *it->version;
+            res.items.append(std::move(report));
+        }
+    }
+    for (auto it = m_documents.cbegin(), end = m_documents.cend(); it != end; ++it) {
+        if (reported.contains(it.key()))
+            continue;
+        auto report = fullReport<WorkspaceFullDocumentDiagnosticReport>(it->resultId,
+                                                                         it->diagnostics);
+        report.uri = it.key();
+        if (it->version)
+            report.version = *it->version;
+        res.items.append(std::move(report));
+    }
+    return res;
+}
+
+QByteArray QLspDiagnosticReports::resultIdFor(const QList<Diagnostic> &diagnostics)
+{
+    return QByteArray::number(QTypedJson::contentHash(diagnostics), 16);
+}
+
+QT_END_NAMESPACE
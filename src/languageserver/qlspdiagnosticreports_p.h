@@ -0,0 +1,68 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QLSPDIAGNOSTICREPORTS_P_H
+#define QLSPDIAGNOSTICREPORTS_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtLanguageServer/qtlanguageserverglobal.h>
+#include <QtLanguageServer/private/qlanguageserverspec_p.h>
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
+#include <QtCore/QList>
+
+#include <optional>
+
+QT_BEGIN_NAMESPACE
+
+class Q_LANGUAGESERVER_EXPORT QLspDiagnosticReports
+{
+public:
+    QLspDiagnosticReports() = default;
+
+    // replaces the diagnostics of uri, and the version they belong to, returns true if the
+    // diagnostics changed
+    bool setDiagnostics(const QByteArray &uri, QList<QLspSpecification::Diagnostic> diagnostics,
+                        std::optional<int> version = std::nullopt);
+    void remove(const QByteArray &uri);
+    void clear() { m_documents.clear(); }
+
+    bool contains(const QByteArray &uri) const { return m_documents.contains(uri); }
+    qsizetype size() const { return m_documents.size(); }
+    QList<QLspSpecification::Diagnostic> diagnostics(const QByteArray &uri) const;
+    // the id of the current diagnostics of uri, empty if it has none
+    QByteArray resultId(const QByteArray &uri) const;
+
+    // the result of textDocument/diagnostic
+    QLspSpecification::Responses::DocumentDiagnosticResultType
+    documentReport(const QLspSpecification::DocumentDiagnosticParams &params) const;
+    // the result of workspace/diagnostic
+    QLspSpecification::WorkspaceDiagnosticReport
+    workspaceReport(const QLspSpecification::WorkspaceDiagnosticParams &params) const;
+
+    static QByteArray resultIdFor(const QList<QLspSpecification::Diagnostic> &diagnostics);
+
+private:
+    struct Document
+    {
+        QByteArray resultId;
+        QList<QLspSpecification::Diagnostic> diagnostics;
+        std::optional<int> version;
+    };
+
+    QHash<QByteArray, Document> m_documents;
+};
+
+QT_END_NAMESPACE
+
+#endif // QLSPDIAGNOSTICREPORTS_P_H
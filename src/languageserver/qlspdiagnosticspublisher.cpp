@@ -0,0 +1,154 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qlspdiagnosticspublisher_p.h"
+
+#include <QtJsonRpc/private/qtypedjsonhash_p.h>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+QT_BEGIN_NAMESPACE
+
+using namespace QLspSpecification;
+
+/*!
+\internal
+\class QLspDiagnosticsPublisher
+\brief Publishes the diagnostics of several analyzers, skipping unchanged and repeated updates
+
+Each analyzer sets the diagnostics it found for a document with setDiagnostics(). The publisher
+merges the diagnostics of all analyzers of a document (ordered by analyzer name) and sends them
+with textDocument/publishDiagnostics once the document had no updates for delay() milliseconds,
+so a burst of updates for the same file becomes a single notification.
+
+The last diagnostics published for each document are kept: if the merged set is the same (the
+contentHash() matches and contentEquals() confirms it) for the same document version, nothing
+is sent. This avoids the flood of identical notifications when a change triggers the analysis
+of many files. An empty set is sent only to clear diagnostics that were published before.
+
+The version of a document is the one passed with its last setDiagnostics() call, none if that
+call had no version.
+*/
+
+QLspDiagnosticsPublisher::QLspDiagnosticsPublisher(QLanguageServerProtocol *protocol,
+                                                   QObject *parent)
+    : QObject(parent), m_protocol(protocol)
+{
+    m_clock.start();
+    m_publishTimer.setSingleShot(true);
+    connect(&m_publishTimer, &QTimer::timeout, this, &QLspDiagnosticsPublisher::publishDue);
+}
+
+QLspDiagnosticsPublisher::~QLspDiagnosticsPublisher() = default;
+
+void QLspDiagnosticsPublisher::setDiagnostics(const QByteArray &analyzer, const QByteArray &uri,
+                                              QList<Diagnostic> diagnostics,
+                                              std::optional<int> version)
+{
+    Document &doc = m_documents[uri];
+    if (diagnostics.isEmpty())
+        doc.byAnalyzer.remove(analyzer);
+    else
+        doc.byAnalyzer.insert(analyzer, std::move(diagnostics));
+    doc.version = version;
+    schedule(uri);
+}
+
+void QLspDiagnosticsPublisher::clearDiagnostics(const QByteArray &analyzer, const QByteArray &uri)
+{
+    auto it = m_documents.find(uri);
+    if (it != m_documents.end() && it->byAnalyzer.remove(analyzer))
+        schedule(uri);
+}
+
+void QLspDiagnosticsPublisher::clearAnalyzer(const QByteArray &analyzer)
+{
+    // schedule() can publish, and remove documents, right away
+    QList<QByteArray> changed;
+    for (auto it = m_documents.begin(), end = m_documents.end(); it != end; ++it) {
+        if (it->byAnalyzer.remove(analyzer))
+            changed.append(it.key());
+    }
+    for (const QByteArray &uri : std::as_const(changed))
+        schedule(uri);
+}
+
+QList<Diagnostic> QLspDiagnosticsPublisher::publishedDiagnostics(const QByteArray &uri) const
+{
+    auto it = m_documents.constFind(uri);
+    return (it == m_documents.constEnd()) ? QList<Diagnostic>() : it->published;
+}
+
+void QLspDiagnosticsPublisher::flush()
+{
+    m_publishTimer.stop();
+    const QList<QByteArray> uris = m_pending.keys();
+    m_pending.clear();
+    for (const QByteArray &uri : uris)
+        publish(uri);
+}
+
+void QLspDiagnosticsPublisher::schedule(const QByteArray &uri)
+{
+    if (m_delay <= 0) {
+        m_pending.remove(uri);
+        publish(uri);
+        return;
+    }
+    // the delay restarts with each update of the document
+    m_pending.insert(uri, m_clock.elapsed() + m_delay);
+    // a running timer expires earlier, and is restarted for the later documents
+    if (!m_publishTimer.isActive())
+        m_publishTimer.start(m_delay);
+}
+
+void QLspDiagnosticsPublisher::publishDue()
+{
+    const qint64 now = m_clock.elapsed();
+    QList<QByteArray> due;
+    qint64 next = std::numeric_limits<qint64>::max();
+    for (auto it = m_pending.cbegin(), end = m_pending.cend(); it != end; ++it) {
+        if (it.value() <= now)
+            due.append(it.key());
+        else
+            next = std::min(next, it.value());
+    }
+    for (const QByteArray &uri : std::as_const(due)) {
+        m_pending.remove(uri);
+        publish(uri);
+    }
+    if (!m_pending.isEmpty())
+        m_publishTimer.start(int(next - now));
+}
+
+void QLspDiagnosticsPublisher::publish(const QByteArray &uri)
+{
+    auto it = m_documents.find(uri);
+    if (it == m_documents.end())
+        return;
+    QList<Diagnostic> merged;
+    for (const QList<Diagnostic> &diagnostics : std::as_const(it->byAnalyzer))
+        merged.append(diagnostics);
+    const quint64 hash = QTypedJson::contentHash(merged);
+    const bool unchanged = it->publishedHash
+            ? (*it->publishedHash == hash && it->publishedVersion == it->version
+               && QTypedJson::contentEquals(merged, it->published))
+            : merged.isEmpty();
+    if (!unchanged) {
+        PublishDiagnosticsParams params;
+        params.uri = uri;
+        params.version = it->version;
+        params.diagnostics = merged;
+        m_protocol->notifyPublishDiagnostics(params);
+        it->published = std::move(merged);
+        it->publishedHash = hash;
+        it->publishedVersion = it->version;
+    }
+    // nothing left to remember once the client has no diagnostics for the document
+    if (it->byAnalyzer.isEmpty() && it->published.isEmpty())
+        m_documents.erase(it);
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,82 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QLSPDIAGNOSTICSPUBLISHER_P_H
+#define QLSPDIAGNOSTICSPUBLISHER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtLanguageServer/qtlanguageserverglobal.h>
+#include <QtLanguageServer/private/qlanguageserverprotocol_p.h>
+#include <QtCore/QByteArray>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QMap>
+#include <QtCore/QObject>
+#include <QtCore/QTimer>
+
+#include <optional>
+
+QT_BEGIN_NAMESPACE
+
+class Q_LANGUAGESERVER_EXPORT QLspDiagnosticsPublisher : public QObject
+{
+    Q_OBJECT
+public:
+    QLspDiagnosticsPublisher(QLanguageServerProtocol *protocol, QObject *parent = nullptr);
+    ~QLspDiagnosticsPublisher() override;
+
+    // milliseconds without updates of a document before its diagnostics are published
+    int delay() const { return m_delay; }
+    void setDelay(int delay) { m_delay = delay; }
+
+    // replaces the diagnostics of uri found by analyzer, and the version of uri
+    void setDiagnostics(const QByteArray &analyzer, const QByteArray &uri,
+                        QList<QLspSpecification::Diagnostic> diagnostics,
+                        std::optional<int> version = std::nullopt);
+    void clearDiagnostics(const QByteArray &analyzer, const QByteArray &uri);
+    // clears the diagnostics of analyzer in all documents
+    void clearAnalyzer(const QByteArray &analyzer);
+
+    // the diagnostics of all analyzers for uri, as last published
+    QList<QLspSpecification::Diagnostic> publishedDiagnostics(const QByteArray &uri) const;
+    qsizetype pendingCount() const { return m_pending.size(); }
+    // publishes the pending documents without waiting
+    void flush();
+
+private:
+    struct Document
+    {
+        QMap<QByteArray, QList<QLspSpecification::Diagnostic>> byAnalyzer;
+        std::optional<int> version;
+        QList<QLspSpecification::Diagnostic> published;
+        std::optional<quint64> publishedHash;
+        std::optional<int> publishedVersion;
+    };
+
+    void schedule(const QByteArray &uri);
+    void publishDue();
+    void publish(const QByteArray &uri);
+
+    QLanguageServerProtocol *m_protocol;
+    int m_delay = 200;
+    QHash<QByteArray, Document> m_documents;
+    // time at which the pending documents are published, on m_clock
+    QHash<QByteArray, qint64> m_pending;
+    QElapsedTimer m_clock;
+    QTimer m_publishTimer;
+};
+
+QT_END_NAMESPACE
+
+#endif // QLSPDIAGNOSTICSPUBLISHER_P_H
@@ -0,0 +1,330 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qlspdocumentstore_p.h"
+#include "qlspnotifysignals_p.h"
+#include "qlanguageserverbase_p.h"
+#include "qlsppositionencoding_p.h"
+
+#include <QtCore/QObject>
+
+#include <algorithm>
+#include <utility>
+
+QT_BEGIN_NAMESPACE
+
+using namespace QLspSpecification;
+
+/*!
+\internal
+\class QLspDocumentStore
+\brief Keeps the text of the open documents, updated with the sync notifications
+
+The store applies didOpen, didChange (full or with ranges) and didClose. Connect it to the
+notifications with connectNotifications(), or call open(), change() and close() from the
+registered handlers.
+
+The text of a document is kept in a persistent balanced rope: the leaves hold up to a KiB of
+UTF-8, and each node knows the size and the number of newlines of its subtree. Finding the
+offset of a line, or applying a ranged change, touches only O(log n) nodes, and creates new
+nodes only along those paths. The old nodes are never modified, so a QLspDocumentSnapshot
+just keeps the root it was taken from. Snapshots are cheap to copy, and as they are immutable
+they can be read from several threads while the store keeps applying changes.
+*/
+
+/*!
+\internal
+\class QLspDocumentSnapshot
+\brief An immutable version of a document in QLspDocumentStore
+
+Lines are terminated by \\n (or \\r\\n). The character of positions counts code units of the
+position encoding of the store, UTF-16 unless another one was negotiated.
+*/
+
+struct QLspRopeNode
+{
+    QByteArray text; // only in leaves
+    std::shared_ptr<const QLspRopeNode> left;
+    std::shared_ptr<const QLspRopeNode> right;
+    qsizetype size = 0;
+    qsizetype newlines = 0;
+    int height = 1;
+
+    bool isLeaf() const { return !left; }
+};
+
+namespace {
+
+using NodePtr = std::shared_ptr<const QLspRopeNode>;
+
+constexpr qsizetype MaxLeafSize = 1024;
+
+int height(const NodePtr &node)
+{
+    return node ? node->height : 0;
+}
+
+NodePtr makeLeaf(const QByteArray &text)
+{
+    if (text.isEmpty())
+        return nullptr;
+    auto node = std::make_shared<QLspRopeNode>();
+    node->text = text;
+    node->size = text.size();
+    node->newlines = text.count('\n');
+    return node;
+}
+
+NodePtr makeNode(const NodePtr &left, const NodePtr &right)
+{
+    auto node = std::make_shared<QLspRopeNode>();
+    node->left = left;
+    node->right = right;
+    node->size = left->size + right->size;
+    node->newlines = left->newlines + right->newlines;
+    node->height = std::max(left->height, right->height) + 1;
+    return node;
+}
+
+// joins two balanced trees whose heights differ by at most 2
+NodePtr balance(const NodePtr &a, const NodePtr &b)
+{
+    if (a->height > b->height + 1) {
+        if (height(a->left) >= height(a->right))
+            return makeNode(a->left, makeNode(a->right, b));
+        return makeNode(makeNode(a->left, a->right->left), makeNode(a->right->right, b));
+    }
+    if (b->height > a->height + 1) {
+        if (height(b->right) >= height(b->left))
+            return makeNode(makeNode(a, b->left), b->right);
+        return makeNode(makeNode(a, b->left->left), makeNode(b->left->right, b->right));
+    }
+    return makeNode(a, b);
+}
+
+NodePtr concat(const NodePtr &left, const NodePtr &right)
+{
+    if (!left)
+        return right;
+    if (!right)
+        return left;
+    // merge small leaves, so that typing does not create a leaf per character
+    if (left->isLeaf() && right->isLeaf() && left->size + right->size <= MaxLeafSize)
+        return makeLeaf(left->text + right->text);
+    if (left->height > right->height + 1)
+        return balance(left->left, concat(left->right, right));
+    if (right->height > left->height + 1)
+        return balance(concat(left, right->left), right->right);
+    return makeNode(left, right);
+}
+
+NodePtr buildBalanced(const QList<NodePtr> &leaves, qsizetype begin, qsizetype end)
+{
+    if (begin == end)
+        return nullptr;
+    if (end - begin == 1)
+        return leaves.at(begin);
+    const qsizetype middle = begin + (end - begin) / 2;
+    return makeNode(buildBalanced(leaves, begin, middle), buildBalanced(leaves, middle, end));
+}
+
+NodePtr fromText(const QByteArray &text)
+{
+    if (text.size() <= MaxLeafSize)
+        return makeLeaf(text);
+    QList<NodePtr> leaves;
+    leaves.reserve(text.size() / MaxLeafSize + 1);
+    for (qsizetype i = 0; i < text.size(); i += MaxLeafSize)
+        leaves.append(makeLeaf(text.mid(i, MaxLeafSize)));
+    return buildBalanced(leaves, 0, leaves.size());
+}
+
+std::pair<NodePtr, NodePtr> split(const NodePtr &node, qsizetype offset)
+{
+    if (!node)
+        return {};
+    if (offset <= 0)
+        return { nullptr, node };
+    if (offset >= node->size)
+        return { node, nullptr };
+    if (node->isLeaf())
+        return { makeLeaf(node->text.left(offset)), makeLeaf(node->text.mid(offset)) };
+    if (offset <= node->left->size) {
+        auto [first, second] = split(node->left, offset);
+        return { first, concat(second, node->right) };
+    }
+    auto [first, second] = split(node->right, offset - node->left->size);
+    return { concat(node->left, first), second };
+}
+
+void appendText(const NodePtr &node, qsizetype offset, qsizetype length, QByteArray *out)
+{
+    if (!node || length <= 0 || offset >= node->size)
+        return;
+    if (node->isLeaf()) {
+        const qsizetype count = std::min(length, node->size - offset);
+        out->append(QByteArrayView(node->text).sliced(offset, count));
+        return;
+    }
+    const qsizetype leftSize = node->left->size;
+    if (offset < leftSize)
+        appendText(node->left, offset, length, out);
+    if (offset + length > leftSize)
+        appendText(node->right, std::max(offset - leftSize, qsizetype(0)),
+                   offset + length - std::max(offset, leftSize), out);
+}
+
+qsizetype ropeLineOffset(const NodePtr &root, int line)
+{
+    if (line <= 0 || !root)
+        return 0;
+    if (line > root->newlines)
+        return root->size;
+    // the offset after the line-th newline
+    const QLspRopeNode *node = root.get();
+    qsizetype offset = 0;
+    qsizetype remaining = line;
+    while (!node->isLeaf()) {
+        if (node->left->newlines >= remaining) {
+            node = node->left.get();
+        } else {
+            remaining -= node->left->newlines;
+            offset += node->left->size;
+            node = node->right.get();
+        }
+    }
+    qsizetype i = -1;
+    while (remaining-- > 0)
+        i = node->text.indexOf('\n', i + 1);
+    return offset + i + 1;
+}
+
+qsizetype ropeOffsetAt(const NodePtr &root, const Position &position,
+                       QLspPositionEncoding encoding)
+{
+    const qsizetype start = ropeLineOffset(root, position.line);
+    if (!root || position.line > root->newlines)
+        return start;
+    QByteArray lineText;
+    appendText(root, start, ropeLineOffset(root, position.line + 1) - start, &lineText);
+    if (lineText.endsWith('\n'))
+        lineText.chop(1);
+    if (lineText.endsWith('\r'))
+        lineText.chop(1);
+    return start + qLspPositionBytes(lineText, position.character, encoding);
+}
+
+} // namespace
+
+qsizetype QLspDocumentSnapshot::size() const
+{
+    return m_root ? m_root->size : 0;
+}
+
+int QLspDocumentSnapshot::lineCount() const
+{
+    return m_root ? int(m_root->newlines) + 1 : 1;
+}
+
+QByteArray QLspDocumentSnapshot::text() const
+{
+    return mid(0, size());
+}
+
+QByteArray QLspDocumentSnapshot::mid(qsizetype offset, qsizetype length) const
+{
+    QByteArray res;
+    if (offset < 0 || offset >= size() || length <= 0)
+        return res;
+    length = std::min(length, size() - offset);
+    res.reserve(length);
+    appendText(m_root, offset, length, &res);
+    return res;
+}
+
+qsizetype QLspDocumentSnapshot::lineOffset(int line) const
+{
+    return ropeLineOffset(m_root, line);
+}
+
+QByteArray QLspDocumentSnapshot::line(int line) const
+{
+    const qsizetype start = lineOffset(line);
+    QByteArray res = mid(start, lineOffset(line + 1) - start);
+    if (res.endsWith('\n'))
+        res.chop(1);
+    if (res.endsWith('\r'))
+        res.chop(1);
+    return res;
+}
+
+qsizetype QLspDocumentSnapshot::offsetAt(const Position &position) const
+{
+    return ropeOffsetAt(m_root, position, m_encoding);
+}
+
+void QLspDocumentStore::open(const DidOpenTextDocumentParams &params)
+{
+    QLspDocumentSnapshot &doc = m_documents[params.textDocument.uri];
+    doc.m_uri = params.textDocument.uri;
+    doc.m_languageId = params.textDocument.languageId;
+    doc.m_version = params.textDocument.version;
+    doc.m_encoding = m_encoding;
+    doc.m_root = fromText(params.textDocument.text);
+}
+
+bool QLspDocumentStore::change(const DidChangeTextDocumentParams &params)
+{
+    auto it = m_documents.find(params.textDocument.uri);
+    if (it == m_documents.end()) {
+        qCWarning(lspLog) << "Ignoring change of document" << params.textDocument.uri
+                          << "that is not open";
+        return false;
+    }
+    NodePtr root = it->m_root;
+    for (const TextDocumentContentChangeEvent &change : params.contentChanges) {
+        if (!change.range) {
+            root = fromText(change.text);
+            continue;
+        }
+        const qsizetype start = ropeOffsetAt(root, change.range->start, m_encoding);
+        const qsizetype end = ropeOffsetAt(root, change.range->end, m_encoding);
+        if (end < start) {
+            qCWarning(lspLog) << "Ignoring change of document" << params.textDocument.uri
+                              << "with an invalid range";
+            return false;
+        }
+        auto [before, rest] = split(root, start);
+        root = concat(concat(before, fromText(change.text)), split(rest, end - start).second);
+    }
+    it->m_root = root;
+    it->m_version = params.textDocument.version;
+    return true;
+}
+
+void QLspDocumentStore::close(const DidCloseTextDocumentParams &params)
+{
+    m_documents.remove(params.textDocument.uri);
+}
+
+void QLspDocumentStore::setPositionEncoding(QLspPositionEncoding encoding)
+{
+    m_encoding = encoding;
+    for (QLspDocumentSnapshot &doc : m_documents)
+        doc.m_encoding = encoding;
+}
+
+void QLspDocumentStore::connectNotifications(QLspNotifySignals *notifySignals)
+{
+    QObject::connect(notifySignals, &QLspNotifySignals::receivedDidOpenTextDocumentNotification,
+                     &m_context,
+                     [this](const DidOpenTextDocumentParams &params) { open(params); });
+    QObject::connect(notifySignals, &QLspNotifySignals::receivedDidChangeTextDocumentNotification,
+                     &m_context,
+                     [this](const DidChangeTextDocumentParams &params) { change(params); });
+    QObject::connect(notifySignals, &QLspNotifySignals::receivedDidCloseTextDocumentNotification,
+                     &m_context,
+                     [this](const DidCloseTextDocumentParams &params) { close(params); });
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,98 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QLSPDOCUMENTSTORE_P_H
+#define QLSPDOCUMENTSTORE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtLanguageServer/qtlanguageserverglobal.h>
+#include <QtLanguageServer/private/qlanguageserverspectypes_p.h>
+#include <QtLanguageServer/private/qlsppositionencoding_p.h>
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QObject>
+
+#include <memory>
+
+QT_BEGIN_NAMESPACE
+
+class QLspNotifySignals;
+struct QLspRopeNode;
+
+class Q_LANGUAGESERVER_EXPORT QLspDocumentSnapshot
+{
+public:
+    QLspDocumentSnapshot() = default;
+
+    bool isValid() const { return !m_uri.isEmpty(); }
+    QByteArray uri() const { return m_uri; }
+    int version() const { return m_version; }
+    QByteArray languageId() const { return m_languageId; }
+    QLspPositionEncoding positionEncoding() const { return m_encoding; }
+
+    // sizes and offsets are in bytes of the UTF-8 text
+    qsizetype size() const;
+    int lineCount() const;
+    QByteArray text() const;
+    QByteArray mid(qsizetype offset, qsizetype length) const;
+    // offset of the start of line, or size() if there are less lines
+    qsizetype lineOffset(int line) const;
+    // the line without its line terminator
+    QByteArray line(int line) const;
+    // character counts code units of positionEncoding()
+    qsizetype offsetAt(const QLspSpecification::Position &position) const;
+
+private:
+    friend class QLspDocumentStore;
+
+    QByteArray m_uri;
+    QByteArray m_languageId;
+    int m_version = 0;
+    QLspPositionEncoding m_encoding = QLspPositionEncoding::Utf16;
+    std::shared_ptr<const QLspRopeNode> m_root;
+};
+
+class Q_LANGUAGESERVER_EXPORT QLspDocumentStore
+{
+    Q_DISABLE_COPY_MOVE(QLspDocumentStore)
+public:
+    QLspDocumentStore() = default;
+
+    void open(const QLspSpecification::DidOpenTextDocumentParams &params);
+    // returns false if a change could not be applied, the document then keeps its last version
+    bool change(const QLspSpecification::DidChangeTextDocumentParams &params);
+    void close(const QLspSpecification::DidCloseTextDocumentParams &params);
+    void connectNotifications(QLspNotifySignals *notifySignals);
+    // the negotiated encoding of the positions in the changes and of the snapshots
+    QLspPositionEncoding positionEncoding() const { return m_encoding; }
+    void setPositionEncoding(QLspPositionEncoding encoding);
+
+    bool contains(const QByteArray &uri) const { return m_documents.contains(uri); }
+    QList<QByteArray> uris() const { return m_documents.keys(); }
+    // the current content of uri, an invalid snapshot if it is not open
+    QLspDocumentSnapshot snapshot(const QByteArray &uri) const
+    {
+        return m_documents.value(uri);
+    }
+
+private:
+    QHash<QByteArray, QLspDocumentSnapshot> m_documents;
+    QLspPositionEncoding m_encoding = QLspPositionEncoding::Utf16;
+    // context of the notification connections, destroyed first, which disconnects them
+    QObject m_context;
+};
+
+QT_END_NAMESPACE
+
+#endif // QLSPDOCUMENTSTORE_P_H
@@ -0,0 +1,201 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qlsplineindex_p.h"
+#include "qlspdocumentstore_p.h"
+#include "qlsppositionencoding_p.h"
+#include "qlspascii_p.h"
+
+#include <algorithm>
+#include <cstring>
+
+QT_BEGIN_NAMESPACE
+
+using namespace QLspSpecification;
+using QLspAscii::isAsciiWord;
+
+/*!
+\internal
+\class QLspLineIndex
+\brief Converts between byte offsets in UTF-8 text and LSP positions
+
+The character of a Position counts UTF-16 code units (unless another QLspPositionEncoding was
+negotiated), while the text of the documents is UTF-8. The index keeps the start offset of each
+line, found with memchr, and whether the line is pure ASCII. On ASCII lines, or with
+QLspPositionEncoding::Utf8, the character is the byte offset in the line, the other lines are
+scanned eight bytes at a time, skipping the words without a byte >= 0x80.
+
+offsetsAt() and positionsAt() convert whole lists (for example the starts and ends of the
+ranges of a QList<Diagnostic>) and, as long as the input is sorted, continue from the previous
+result instead of rescanning the line from its start.
+*/
+
+namespace {
+
+bool isAscii(const char *begin, const char *end)
+{
+    const char *it = begin;
+    for (; end - it >= 8; it += 8) {
+        if (!isAsciiWord(it))
+            return false;
+    }
+    for (; it != end; ++it) {
+        if (uchar(*it) >= 0x80)
+            return false;
+    }
+    return true;
+}
+
+} // namespace
+
+QLspLineIndex::QLspLineIndex(const QByteArray &text, QLspPositionEncoding encoding)
+    : m_text(text), m_encoding(encoding)
+{
+    const char *begin = m_text.constData();
+    const char *end = begin + m_text.size();
+    m_lineStarts.append(0);
+    const char *lineBegin = begin;
+    while (const void *newline = std::memchr(lineBegin, '\n', end - lineBegin)) {
+        lineBegin = static_cast<const char *>(newline) + 1;
+        m_lineStarts.append(lineBegin - begin);
+    }
+    m_asciiLines.resize(m_lineStarts.size());
+    for (int line = 0; line < lineCount(); ++line)
+        m_asciiLines.setBit(line, isAscii(begin + lineStart(line), begin + lineEnd(line)));
+}
+
+QLspLineIndex::QLspLineIndex(const QLspDocumentSnapshot &snapshot)
+    : QLspLineIndex(snapshot.text(), snapshot.positionEncoding())
+{
+}
+
+qsizetype QLspLineIndex::lineStart(int line) const
+{
+    if (line < 0)
+        return 0;
+    if (line >= lineCount())
+        return m_text.size();
+    return m_lineStarts.at(line);
+}
+
+qsizetype QLspLineIndex::lineEnd(int line) const
+{
+    if (line < 0)
+        return 0;
+    if (line >= lineCount())
+        return m_text.size();
+    qsizetype end = lineStart(line + 1);
+    if (end > m_lineStarts.at(line) && m_text.at(end - 1) == '\n')
+        --end;
+    if (end > m_lineStarts.at(line) && m_text.at(end - 1) == '\r')
+        --end;
+    return end;
+}
+
+int QLspLineIndex::lineAt(qsizetype offset) const
+{
+    auto it = std::upper_bound(m_lineStarts.cbegin(), m_lineStarts.cend(), offset);
+    return int(it - m_lineStarts.cbegin()) - 1;
+}
+
+bool QLspLineIndex::isAsciiLine(int line) const
+{
+    return line >= 0 && line < lineCount() && m_asciiLines.testBit(line);
+}
+
+void QLspLineIndex::setPositionEncoding(QLspPositionEncoding encoding)
+{
+    m_encoding = encoding;
+}
+
+qsizetype QLspLineIndex::offsetAt(const Position &position) const
+{
+    if (position.line >= lineCount())
+        return m_text.size();
+    return advance(position.line, lineStart(position.line), position.character);
+}
+
+Position QLspLineIndex::positionAt(qsizetype offset) const
+{
+    offset = qBound(qsizetype(0), offset, m_text.size());
+    const int line = lineAt(offset);
+    return Position { line, unitsBetween(line, lineStart(line), offset) };
+}
+
+QList<qsizetype> QLspLineIndex::offsetsAt(const QList<Position> &positions) const
+{
+    QList<qsizetype> res;
+    res.reserve(positions.size());
+    // the last converted position, later characters on the same line continue from it
+    int line = -1;
+    int character = 0;
+    qsizetype offset = 0;
+    for (const Position &position : positions) {
+        if (position.line >= lineCount()) {
+            res.append(m_text.size());
+            continue;
+        }
+        const int target = std::max(position.character, 0);
+        if (position.line != line || target < character) {
+            line = position.line;
+            character = 0;
+            offset = lineStart(line);
+        }
+        offset = advance(line, offset, target - character);
+        character = target;
+        res.append(offset);
+    }
+    return res;
+}
+
+QList<Position> QLspLineIndex::positionsAt(const QList<qsizetype> &offsets) const
+{
+    QList<Position> res;
+    res.reserve(offsets.size());
+    // the last converted offset, later offsets on the same line continue from it
+    int line = 0;
+    int character = 0;
+    qsizetype lastOffset = 0;
+    for (qsizetype offset : offsets) {
+        offset = qBound(qsizetype(0), offset, m_text.size());
+        if (offset < lastOffset || offset >= lineStart(line + 1)) {
+            if (offset >= lastOffset) {
+                // sorted input: only look at the following lines
+                auto it = std::upper_bound(m_lineStarts.cbegin() + line, m_lineStarts.cend(),
+                                           offset);
+                line = int(it - m_lineStarts.cbegin()) - 1;
+            } else {
+                line = lineAt(offset);
+            }
+            character = 0;
+            lastOffset = lineStart(line);
+        }
+        character += unitsBetween(line, lastOffset, offset);
+        lastOffset = std::max(lastOffset, std::min(offset, lineEnd(line)));
+        res.append(Position { line, character });
+    }
+    return res;
+}
+
+qsizetype QLspLineIndex::advance(int line, qsizetype from, qsizetype units) const
+{
+    const qsizetype end = lineEnd(line);
+    if (units <= 0 || from >= end)
+        return std::min(from, end);
+    if (isAsciiLine(line))
+        return std::min(from + units, end);
+    return from + qLspPositionBytes(QByteArrayView(m_text).sliced(from, end - from), units,
+                                    m_encoding);
+}
+
+int QLspLineIndex::unitsBetween(int line, qsizetype from, qsizetype to) const
+{
+    to = std::min(to, lineEnd(line));
+    if (to <= from)
+        return 0;
+    if (isAsciiLine(line))
+        return int(to - from);
+    return int(qLspPositionUnits(QByteArrayView(m_text).sliced(from, to - from), m_encoding));
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,66 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QLSPLINEINDEX_P_H
+#define QLSPLINEINDEX_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtLanguageServer/qtlanguageserverglobal.h>
+#include <QtLanguageServer/private/qlanguageserverspectypes_p.h>
+#include <QtLanguageServer/private/qlsppositionencoding_p.h>
+#include <QtCore/QBitArray>
+#include <QtCore/QByteArray>
+#include <QtCore/QList>
+
+QT_BEGIN_NAMESPACE
+
+class QLspDocumentSnapshot;
+
+class Q_LANGUAGESERVER_EXPORT QLspLineIndex
+{
+public:
+    QLspLineIndex() : QLspLineIndex(QByteArray()) { }
+    explicit QLspLineIndex(const QByteArray &text,
+                           QLspPositionEncoding encoding = QLspPositionEncoding::Utf16);
+    explicit QLspLineIndex(const QLspDocumentSnapshot &snapshot);
+
+    QByteArray text() const { return m_text; }
+    int lineCount() const { return int(m_lineStarts.size()); }
+    // byte offset of the start of line, or the size of the text if there are less lines
+    qsizetype lineStart(int line) const;
+    // byte offset of the end of line, before its line terminator
+    qsizetype lineEnd(int line) const;
+    int lineAt(qsizetype offset) const;
+    bool isAsciiLine(int line) const;
+    QLspPositionEncoding positionEncoding() const { return m_encoding; }
+    void setPositionEncoding(QLspPositionEncoding encoding);
+
+    qsizetype offsetAt(const QLspSpecification::Position &position) const;
+    QLspSpecification::Position positionAt(qsizetype offset) const;
+    // bulk conversions, in a single pass if the input is sorted
+    QList<qsizetype> offsetsAt(const QList<QLspSpecification::Position> &positions) const;
+    QList<QLspSpecification::Position> positionsAt(const QList<qsizetype> &offsets) const;
+
+private:
+    qsizetype advance(int line, qsizetype from, qsizetype units) const;
+    int unitsBetween(int line, qsizetype from, qsizetype to) const;
+
+    QByteArray m_text;
+    QList<qsizetype> m_lineStarts;
+    QBitArray m_asciiLines;
+    QLspPositionEncoding m_encoding = QLspPositionEncoding::Utf16;
+};
+
+QT_END_NAMESPACE
+
+#endif // QLSPLINEINDEX_P_H
@@ -0,0 +1,142 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QLSPPARTIALRESULTSTREAMER_P_H
+#define QLSPPARTIALRESULTSTREAMER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtLanguageServer/private/qlanguageserverprespectypes_p.h>
+#include <QtJsonRpc/private/qtypedjsontextwriter_p.h>
+#include <QtCore/QByteArray>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QList>
+
+#include <chrono>
+#include <type_traits>
+
+QT_BEGIN_NAMESPACE
+namespace QLspSpecification {
+
+/*!
+ * \internal
+ * \class QLspSpecification::QLspPartialResultStreamer
+ * \brief Sends the result of a request in batches while it is being computed
+ *
+ * Response is one of the LSPPartialResponse types whose partial result is a list, for example
+ * ReferenceResponseType. If the client sent a partialResultToken the items appended are
+ * serialized right away and sent in $/progress notifications as soon as a batch reaches
+ * maxItems(), maxBytes() or is older than maxDelay(). The time limit is checked when an item
+ * is appended, there is no timer. finish() sends the remaining batch and, as the specification
+ * requires once partial results were sent, an empty final response.
+ *
+ * Without a partialResultToken the items are collected and finish() sends them all in the
+ * response, so the handler does not need to know if the client supports partial results.
+ *
+ * The streamer owns the response, and finishes it when it is destroyed.
+ */
+template<typename Response>
+class QLspPartialResultStreamer
+{
+    Q_DISABLE_COPY_MOVE(QLspPartialResultStreamer)
+public:
+    using ResultType = typename Response::ResponseType;
+    using PartialResultType = typename Response::PartialResponseType;
+    static_assert(QTypedJson::IsResizableList<PartialResultType>::value,
+                  "only list partial results can be streamed");
+    static_assert(std::is_constructible_v<ResultType, PartialResultType>,
+                  "the result must be constructible from the partial result");
+    using Item = typename PartialResultType::value_type;
+
+    explicit QLspPartialResultStreamer(Response &&response) : m_response(std::move(response))
+    {
+        if (m_response.partialResultToken())
+            m_tokenText = QTypedJson::toJsonText(*m_response.partialResultToken());
+    }
+    ~QLspPartialResultStreamer() { finish(); }
+
+    bool isStreaming() const { return !m_tokenText.isNull(); }
+    bool isFinished() const { return m_finished; }
+
+    qsizetype maxItems() const { return m_maxItems; }
+    void setMaxItems(qsizetype maxItems) { m_maxItems = maxItems; }
+    qsizetype maxBytes() const { return m_maxBytes; }
+    void setMaxBytes(qsizetype maxBytes) { m_maxBytes = maxBytes; }
+    std::chrono::milliseconds maxDelay() const { return m_maxDelay; }
+    void setMaxDelay(std::chrono::milliseconds maxDelay) { m_maxDelay = maxDelay; }
+
+    void append(const Item &item)
+    {
+        Q_ASSERT(!m_finished);
+        if (!isStreaming()) {
+            m_items.append(item);
+            return;
+        }
+        if (m_batchSize == 0)
+            m_batchTimer.start();
+        else
+            m_batch.append(',');
+        m_batch.append(QTypedJson::toJsonText(item));
+        ++m_batchSize;
+        if ((m_maxItems > 0 && m_batchSize >= m_maxItems)
+            || (m_maxBytes > 0 && m_batch.size() >= m_maxBytes)
+            || (m_maxDelay.count() >= 0 && m_batchTimer.durationElapsed() >= m_maxDelay))
+            flush();
+    }
+
+    // sends the current batch, if any
+    void flush()
+    {
+        if (m_batchSize == 0)
+            return;
+        QByteArray params;
+        params.reserve(m_tokenText.size() + m_batch.size() + 22);
+        params.append("{\"token\":");
+        params.append(m_tokenText);
+        params.append(",\"value\":[");
+        params.append(m_batch);
+        params.append("]}");
+        // using Notifications::Progress here would require to split out the *RequestType aliases
+        m_response.sendNotificationText("$/progress", params);
+        m_batch.clear();
+        m_batchSize = 0;
+    }
+
+    void finish()
+    {
+        if (m_finished)
+            return;
+        m_finished = true;
+        if (isStreaming()) {
+            flush();
+            m_response.sendResponse(ResultType(PartialResultType()));
+        } else {
+            m_response.sendResponse(ResultType(std::move(m_items)));
+        }
+    }
+
+private:
+    Response m_response;
+    QByteArray m_tokenText; // json of the partialResultToken, null if not streaming
+    QByteArray m_batch; // json of the pending items, separated by commas
+    qsizetype m_batchSize = 0;
+    QElapsedTimer m_batchTimer;
+    PartialResultType m_items; // collected items when not streaming
+    qsizetype m_maxItems = 100;
+    qsizetype m_maxBytes = 64 * 1024;
+    std::chrono::milliseconds m_maxDelay = std::chrono::milliseconds(50);
+    bool m_finished = false;
+};
+
+} // namespace QLspSpecification
+QT_END_NAMESPACE
+#endif // QLSPPARTIALRESULTSTREAMER_P_H
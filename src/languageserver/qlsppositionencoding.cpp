@@ -0,0 +1,118 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qlsppositionencoding_p.h"
+#include "qlspascii_p.h"
+
+QT_BEGIN_NAMESPACE
+
+using namespace QLspSpecification;
+using QLspAscii::isAsciiWord;
+
+/*!
+\internal
+\enum QLspPositionEncoding
+
+The code units counted by the character of a Position. Before LSP 3.17 positions always use
+UTF-16. From 3.17 the client lists the encodings it supports in
+general.positionEncodings of its capabilities, and the server answers with the one it chose in
+the positionEncoding of its capabilities.
+
+Documents are kept in UTF-8, so with QLspPositionEncoding::Utf8 the character is a byte offset
+in the line and positions need no conversion.
+*/
+
+QByteArray qLspPositionEncodingName(QLspPositionEncoding encoding)
+{
+    switch (encoding) {
+    case QLspPositionEncoding::Utf8:
+        return QByteArrayLiteral("utf-8");
+    case QLspPositionEncoding::Utf32:
+        return QByteArrayLiteral("utf-32");
+    case QLspPositionEncoding::Utf16:
+        break;
+    }
+    return QByteArrayLiteral("utf-16");
+}
+
+std::optional<QLspPositionEncoding> qLspPositionEncodingFromName(QByteArrayView name)
+{
+    if (name == "utf-16")
+        return QLspPositionEncoding::Utf16;
+    if (name == "utf-8")
+        return QLspPositionEncoding::Utf8;
+    if (name == "utf-32")
+        return QLspPositionEncoding::Utf32;
+    return std::nullopt;
+}
+
+/*!
+\internal
+Returns the first of the encodings in supported (in the order preferred by the server) that the
+client listed in its capabilities, or UTF-16, that all clients support.
+QLanguageServerProtocol calls it for the initialize request, and sends the result back in
+ServerCapabilities::positionEncoding.
+*/
+QLspPositionEncoding qLspNegotiatePositionEncoding(const ClientCapabilities &capabilities,
+                                                   const QList<QLspPositionEncoding> &supported)
+{
+    if (!capabilities.general || !capabilities.general->positionEncodings)
+        return QLspPositionEncoding::Utf16;
+    const QList<QByteArray> &clientEncodings = *capabilities.general->positionEncodings;
+    for (QLspPositionEncoding encoding : supported) {
+        if (clientEncodings.contains(qLspPositionEncodingName(encoding)))
+            return encoding;
+    }
+    return QLspPositionEncoding::Utf16;
+}
+
+/*!
+\internal
+Counts the code units of utf8, skipping eight ASCII bytes at a time.
+*/
+qsizetype qLspPositionUnits(QByteArrayView utf8, QLspPositionEncoding encoding)
+{
+    if (encoding == QLspPositionEncoding::Utf8)
+        return utf8.size();
+    const qsizetype surrogateUnits = (encoding == QLspPositionEncoding::Utf16) ? 2 : 1;
+    qsizetype units = 0;
+    const char *it = utf8.data();
+    const char *end = it + utf8.size();
+    while (it != end) {
+        if (end - it >= 8 && isAsciiWord(it)) {
+            units += 8;
+            it += 8;
+            continue;
+        }
+        const uchar c = uchar(*it++);
+        if ((c & 0xc0) != 0x80) // not a continuation byte
+            units += (c >= 0xf0) ? surrogateUnits : 1;
+    }
+    return units;
+}
+
+qsizetype qLspPositionBytes(QByteArrayView utf8, qsizetype units, QLspPositionEncoding encoding)
+{
+    if (encoding == QLspPositionEncoding::Utf8)
+        return qBound(qsizetype(0), units, utf8.size());
+    const qsizetype surrogateUnits = (encoding == QLspPositionEncoding::Utf16) ? 2 : 1;
+    const char *begin = utf8.data();
+    const char *end = begin + utf8.size();
+    const char *it = begin;
+    while (it != end && units > 0) {
+        if (units >= 8 && end - it >= 8 && isAsciiWord(it)) {
+            units -= 8;
+            it += 8;
+            continue;
+        }
+        const uchar c = uchar(*it);
+        const qsizetype length = (c < 0x80) ? 1 : (c < 0xe0) ? 2 : (c < 0xf0) ? 3 : 4;
+        if (length > end - it)
+            return utf8.size();
+        units -= (length == 4) ? surrogateUnits : 1;
+        it += length;
+    }
+    return it - begin;
+}
+
+QT_END_NAMESPACE
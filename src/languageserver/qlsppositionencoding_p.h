@@ -0,0 +1,48 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QLSPPOSITIONENCODING_P_H
+#define QLSPPOSITIONENCODING_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtLanguageServer/qtlanguageserverglobal.h>
+#include <QtLanguageServer/private/qlanguageserverspectypes_p.h>
+#include <QtCore/QByteArray>
+#include <QtCore/QByteArrayView>
+#include <QtCore/QList>
+
+#include <optional>
+
+QT_BEGIN_NAMESPACE
+
+// the code units counted by the character of a Position
+enum class QLspPositionEncoding { Utf16, Utf8, Utf32 };
+
+Q_LANGUAGESERVER_EXPORT QByteArray qLspPositionEncodingName(QLspPositionEncoding encoding);
+Q_LANGUAGESERVER_EXPORT std::optional<QLspPositionEncoding>
+qLspPositionEncodingFromName(QByteArrayView name);
+Q_LANGUAGESERVER_EXPORT QLspPositionEncoding qLspNegotiatePositionEncoding(
+        const QLspSpecification::ClientCapabilities &capabilities,
+        const QList<QLspPositionEncoding> &supported = { QLspPositionEncoding::Utf8,
+                                                         QLspPositionEncoding::Utf16 });
+
+// the code units of the UTF-8 text utf8
+Q_LANGUAGESERVER_EXPORT qsizetype qLspPositionUnits(QByteArrayView utf8,
+                                                    QLspPositionEncoding encoding);
+// the bytes at the start of utf8 taking units code units, or the size of utf8 if it is shorter
+Q_LANGUAGESERVER_EXPORT qsizetype qLspPositionBytes(QByteArrayView utf8, qsizetype units,
+                                                    QLspPositionEncoding encoding);
+
+QT_END_NAMESPACE
+
+#endif // QLSPPOSITIONENCODING_P_H
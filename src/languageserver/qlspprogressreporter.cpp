@@ -0,0 +1,191 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qlspprogressreporter_p.h"
+#include "qlspnotifysignals_p.h"
+
+#include <QtCore/QPointer>
+
+#include <utility>
+
+QT_BEGIN_NAMESPACE
+
+using namespace QLspSpecification;
+
+/*!
+\internal
+\class QLspProgressReporter
+\brief Reports the progress of a long running task of the server to the client
+
+The reporter owns the progress token. If no token was set with setToken (for example the
+workDoneToken of a request), begin() asks the client to create one with
+window/workDoneProgress/create, and sends the progress only once the client acknowledged it.
+
+Updates passed to report() are merged, and sent at most maxReportsPerSecond() times per second,
+unless the percentage changed by at least percentageStep() since the last one sent. A merged
+update that was held back is sent when the interval elapses. end() drops pending updates and
+always sends the end notification, the destructor calls it if needed.
+
+window/workDoneProgress/cancel notifications for the token set isCancelled() and emit
+cancelled(), connect them with connectCancel() or pass them to handleCancel().
+*/
+
+QLspProgressReporter::QLspProgressReporter(QLanguageServerProtocol *protocol, QObject *parent)
+    : QObject(parent), m_protocol(protocol)
+{
+    m_reportTimer.setSingleShot(true);
+    connect(&m_reportTimer, &QTimer::timeout, this, &QLspProgressReporter::sendPendingReport);
+}
+
+QLspProgressReporter::~QLspProgressReporter()
+{
+    if (m_state == State::Running)
+        end();
+}
+
+void QLspProgressReporter::setToken(const ProgressToken &token)
+{
+    Q_ASSERT(m_state == State::Idle);
+    m_token = token;
+}
+
+void QLspProgressReporter::begin(const QByteArray &title, bool cancellable,
+                                 const std::optional<QByteArray> &message,
+                                 const std::optional<int> &percentage)
+{
+    Q_ASSERT(m_state == State::Idle);
+    m_begin.kind = "begin";
+    m_begin.title = title;
+    if (cancellable)
+        m_begin.cancellable = true;
+    m_begin.message = message;
+    m_begin.percentage = percentage;
+    if (m_token) {
+        m_state = State::Running;
+        sendBegin();
+        return;
+    }
+
+    m_token = m_protocol->newProgressToken();
+    m_state = State::Creating;
+    WorkDoneProgressCreateParams params;
+    params.token = *m_token;
+    QPointer<QLspProgressReporter> self(this);
+    m_protocol->requestWorkDoneProgressCreate(
+            params,
+            [self]() {
+                if (!self || self->m_state != State::Creating)
+                    return;
+                self->m_state = State::Running;
+                self->sendBegin();
+                if (self->m_endRequested)
+                    self->sendEnd();
+                else
+                    self->sendPendingReport();
+            },
+            [self](const ResponseError &error) {
+                qCWarning(lspLog) << "Client refused to create a progress:"
+                                  << QString::fromUtf8(error.message);
+                if (self)
+                    self->m_state = State::Failed;
+            });
+}
+
+void QLspProgressReporter::report(const std::optional<QByteArray> &message,
+                                  const std::optional<int> &percentage)
+{
+    if (m_endRequested || m_state == State::Ended || m_state == State::Failed)
+        return;
+    if (message)
+        m_pendingMessage = message;
+    if (percentage)
+        m_pendingPercentage = percentage;
+    m_hasPendingReport = true;
+    if (m_state != State::Running)
+        return;
+
+    const bool percentageChanged = m_pendingPercentage && m_percentageStep > 0
+            && (!m_lastSentPercentage
+                || qAbs(*m_pendingPercentage - *m_lastSentPercentage) >= m_percentageStep);
+    const qint64 sinceLastSent = m_lastSent.elapsed();
+    if (percentageChanged || sinceLastSent >= reportInterval())
+        sendPendingReport();
+    else if (!m_reportTimer.isActive())
+        m_reportTimer.start(int(reportInterval() - sinceLastSent));
+}
+
+void QLspProgressReporter::end(const std::optional<QByteArray> &message)
+{
+    if (m_endRequested || m_state == State::Ended || m_state == State::Failed)
+        return;
+    m_endRequested = true;
+    m_end.kind = "end";
+    m_end.message = message;
+    if (m_state == State::Idle)
+        m_state = State::Ended; // nothing was sent
+    else if (m_state == State::Running)
+        sendEnd();
+}
+
+bool QLspProgressReporter::handleCancel(const WorkDoneProgressCancelParams &params)
+{
+    if (!m_token || params.token != *m_token)
+        return false;
+    if (!m_cancelled) {
+        m_cancelled = true;
+        emit cancelled();
+    }
+    return true;
+}
+
+void QLspProgressReporter::connectCancel(QLspNotifySignals *notifySignals)
+{
+    connect(notifySignals, &QLspNotifySignals::receivedWorkDoneProgressCancelNotification, this,
+            [this](const WorkDoneProgressCancelParams &params) { handleCancel(params); });
+}
+
+void QLspProgressReporter::sendBegin()
+{
+    m_protocol->typedRpc()->sendNotification(
+            QByteArray(Notifications::ProgressMethod),
+            ProgressNotificationParams<WorkDoneProgressBegin> { *m_token, m_begin });
+    m_lastSentPercentage = m_begin.percentage;
+    m_lastSent.start();
+}
+
+void QLspProgressReporter::sendPendingReport()
+{
+    if (!m_hasPendingReport || m_state != State::Running)
+        return;
+    m_reportTimer.stop();
+    WorkDoneProgressReport report;
+    report.kind = "report";
+    report.message = std::exchange(m_pendingMessage, std::nullopt);
+    report.percentage = std::exchange(m_pendingPercentage, std::nullopt);
+    m_hasPendingReport = false;
+    m_protocol->typedRpc()->sendNotification(
+            QByteArray(Notifications::ProgressMethod),
+            ProgressNotificationParams<WorkDoneProgressReport> { *m_token, report });
+    if (report.percentage)
+        m_lastSentPercentage = report.percentage;
+    m_lastSent.start();
+}
+
+void QLspProgressReporter::sendEnd()
+{
+    m_reportTimer.stop();
+    m_pendingMessage.reset();
+    m_pendingPercentage.reset();
+    m_hasPendingReport = false;
+    m_protocol->typedRpc()->sendNotification(
+            QByteArray(Notifications::ProgressMethod),
+            ProgressNotificationParams<WorkDoneProgressEnd> { *m_token, m_end });
+    m_state = State::Ended;
+}
+
+int QLspProgressReporter::reportInterval() const
+{
+    return m_maxReportsPerSecond > 0 ? 1000 / m_maxReportsPerSecond : 0;
+}
+
+QT_END_NAMESPACE
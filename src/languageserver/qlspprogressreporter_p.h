@@ -0,0 +1,93 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QLSPPROGRESSREPORTER_P_H
+#define QLSPPROGRESSREPORTER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtLanguageServer/private/qlanguageserverprotocol_p.h>
+#include <QtCore/QByteArray>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QObject>
+#include <QtCore/QTimer>
+
+#include <optional>
+
+QT_BEGIN_NAMESPACE
+
+class QLspNotifySignals;
+
+class Q_LANGUAGESERVER_EXPORT QLspProgressReporter : public QObject
+{
+    Q_OBJECT
+public:
+    enum class State { Idle, Creating, Running, Ended, Failed };
+    Q_ENUM(State)
+
+    QLspProgressReporter(QLanguageServerProtocol *protocol, QObject *parent = nullptr);
+    ~QLspProgressReporter() override;
+
+    // uses a token sent by the client (workDoneToken), instead of asking the client to create one
+    void setToken(const QLspSpecification::ProgressToken &token);
+    std::optional<QLspSpecification::ProgressToken> token() const { return m_token; }
+
+    int maxReportsPerSecond() const { return m_maxReportsPerSecond; }
+    void setMaxReportsPerSecond(int maxReports) { m_maxReportsPerSecond = maxReports; }
+    int percentageStep() const { return m_percentageStep; }
+    void setPercentageStep(int step) { m_percentageStep = step; }
+
+    void begin(const QByteArray &title, bool cancellable = false,
+               const std::optional<QByteArray> &message = std::nullopt,
+               const std::optional<int> &percentage = std::nullopt);
+    void report(const std::optional<QByteArray> &message,
+                const std::optional<int> &percentage = std::nullopt);
+    void end(const std::optional<QByteArray> &message = std::nullopt);
+
+    State state() const { return m_state; }
+    bool isCancelled() const { return m_cancelled; }
+
+    // returns true if params refer to this progress
+    bool handleCancel(const QLspSpecification::WorkDoneProgressCancelParams &params);
+    void connectCancel(QLspNotifySignals *notifySignals);
+
+signals:
+    void cancelled();
+
+private:
+    void sendBegin();
+    void sendPendingReport();
+    void sendEnd();
+    int reportInterval() const;
+
+    QLanguageServerProtocol *m_protocol;
+    std::optional<QLspSpecification::ProgressToken> m_token;
+    State m_state = State::Idle;
+    bool m_cancelled = false;
+    bool m_endRequested = false;
+    int m_maxReportsPerSecond = 10;
+    int m_percentageStep = 5;
+
+    QLspSpecification::WorkDoneProgressBegin m_begin;
+    QLspSpecification::WorkDoneProgressEnd m_end;
+    // merged updates not sent yet
+    std::optional<QByteArray> m_pendingMessage;
+    std::optional<int> m_pendingPercentage;
+    bool m_hasPendingReport = false;
+    std::optional<int> m_lastSentPercentage;
+    QElapsedTimer m_lastSent;
+    QTimer m_reportTimer;
+};
+
+QT_END_NAMESPACE
+
+#endif // QLSPPROGRESSREPORTER_P_H
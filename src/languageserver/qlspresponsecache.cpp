@@ -0,0 +1,188 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qlspresponsecache_p.h"
+#include "qlspnotifysignals_p.h"
+
+#include <QtCore/QCache>
+#include <QtCore/QHash>
+#include <QtCore/QObject>
+#include <QtCore/QSet>
+
+QT_BEGIN_NAMESPACE
+
+using namespace QLspSpecification;
+
+/*!
+\internal
+\class QLspResponseCache
+\brief Caches the results of idempotent requests on open documents
+
+Editors send requests like textDocument/hover, documentSymbol, foldingRange, documentLink,
+codeLens or semanticTokens/full again and again (on focus or scroll changes) also when the
+document did not change. Handlers wrapped with cached() store the json text of their result,
+keyed by the document uri, the method and the json text of the params, together with the
+document version. A later identical request on the same version gets the stored json back without
+calling the handler.
+
+The cache has to know the document versions: connect it to the didOpen, didChange and didClose
+notifications with connectNotifications(), or call documentOpened(), documentChanged() and
+documentClosed(). A change or close drops all the results for that document.
+
+The results are kept in a QCache, whose cost is the size of the json text of the params and
+of the result.
+*/
+
+class QLspResponseCachePrivate
+{
+public:
+    struct Key
+    {
+        QByteArray uri;
+        QByteArray method;
+        QByteArray paramsText;
+        quint64 paramsHash; // only used for hashing and to reject mismatches quickly
+
+        friend bool operator==(const Key &a, const Key &b) noexcept
+        {
+            return a.paramsHash == b.paramsHash && a.method == b.method && a.uri == b.uri
+                    && a.paramsText == b.paramsText;
+        }
+        friend size_t qHash(const Key &key, size_t seed = 0) noexcept
+        {
+            return qHashMulti(seed, key.uri, key.method, key.paramsHash);
+        }
+    };
+
+    struct Entry
+    {
+        int version;
+        QByteArray resultText;
+    };
+
+    void invalidate(const QByteArray &uri)
+    {
+        // avoids scanning all entries when nothing was cached for uri
+        if (!urisWithEntries.remove(uri))
+            return;
+        const QList<Key> keys = entries.keys();
+        for (const Key &key : keys) {
+            if (key.uri == uri)
+                entries.remove(key);
+        }
+    }
+
+    void documentChanged(const QByteArray &uri, int version)
+    {
+        invalidate(uri);
+        versions.insert(uri, version);
+    }
+
+    void documentClosed(const QByteArray &uri)
+    {
+        invalidate(uri);
+        versions.remove(uri);
+    }
+
+    QCache<Key, Entry> entries { 4 * 1024 * 1024 };
+    QHash<QByteArray, int> versions;
+    QSet<QByteArray> urisWithEntries;
+};
+
+QLspResponseCache::QLspResponseCache() : d(std::make_shared<QLspResponseCachePrivate>()) { }
+
+QLspResponseCache::~QLspResponseCache() = default;
+
+qsizetype QLspResponseCache::maxCost() const
+{
+    return d->entries.maxCost();
+}
+
+void QLspResponseCache::setMaxCost(qsizetype maxCost)
+{
+    d->entries.setMaxCost(maxCost);
+}
+
+qsizetype QLspResponseCache::size() const
+{
+    return d->entries.size();
+}
+
+void QLspResponseCache::clear()
+{
+    d->entries.clear();
+    d->urisWithEntries.clear();
+}
+
+void QLspResponseCache::documentOpened(const QByteArray &uri, int version)
+{
+    d->documentChanged(uri, version);
+}
+
+void QLspResponseCache::documentChanged(const QByteArray &uri, int version)
+{
+    d->documentChanged(uri, version);
+}
+
+void QLspResponseCache::documentClosed(const QByteArray &uri)
+{
+    d->documentClosed(uri);
+}
+
+std::optional<int> QLspResponseCache::documentVersion(const QByteArray &uri) const
+{
+    return documentVersion(d.get(), uri);
+}
+
+void QLspResponseCache::connectNotifications(QLspNotifySignals *notifySignals)
+{
+    QObject::connect(notifySignals, &QLspNotifySignals::receivedDidOpenTextDocumentNotification,
+                     notifySignals, [d = d](const DidOpenTextDocumentParams &params) {
+                         d->documentChanged(params.textDocument.uri, params.textDocument.version);
+                     });
+    QObject::connect(notifySignals, &QLspNotifySignals::receivedDidChangeTextDocumentNotification,
+                     notifySignals, [d = d](const DidChangeTextDocumentParams &params) {
+                         d->documentChanged(params.textDocument.uri, params.textDocument.version);
+                     });
+    QObject::connect(notifySignals, &QLspNotifySignals::receivedDidCloseTextDocumentNotification,
+                     notifySignals, [d = d](const DidCloseTextDocumentParams &params) {
+                         d->documentClosed(params.textDocument.uri);
+                     });
+}
+
+std::optional<int> QLspResponseCache::documentVersion(QLspResponseCachePrivate *d,
+                                                      const QByteArray &uri)
+{
+    auto it = d->versions.constFind(uri);
+    if (it == d->versions.constEnd())
+        return std::nullopt;
+    return it.value();
+}
+
+std::optional<QByteArray> QLspResponseCache::lookup(QLspResponseCachePrivate *d,
+                                                    const QByteArray &uri,
+                                                    const QByteArray &method,
+                                                    const QByteArray &paramsText,
+                                                    quint64 paramsHash, int version)
+{
+    const QLspResponseCachePrivate::Entry *entry = d->entries.object(
+            QLspResponseCachePrivate::Key { uri, method, paramsText, paramsHash });
+    if (!entry || entry->version != version)
+        return std::nullopt;
+    return entry->resultText;
+}
+
+void QLspResponseCache::insert(QLspResponseCachePrivate *d, const QByteArray &uri,
+                               const QByteArray &method, const QByteArray &paramsText,
+                               quint64 paramsHash, int version, const QByteArray &resultText)
+{
+    // the document changed while the result was computed
+    if (documentVersion(d, uri) != version || resultText.isNull())
+        return;
+    if (d->entries.insert(QLspResponseCachePrivate::Key { uri, method, paramsText, paramsHash },
+                          new QLspResponseCachePrivate::Entry { version, resultText },
+                          paramsText.size() + resultText.size()))
+        d->urisWithEntries.insert(uri);
+}
+
+QT_END_NAMESPACE
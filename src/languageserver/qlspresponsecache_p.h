@@ -0,0 +1,128 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QLSPRESPONSECACHE_P_H
+#define QLSPRESPONSECACHE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtLanguageServer/qtlanguageserverglobal.h>
+#include <QtLanguageServer/private/qlanguageserverprespectypes_p.h>
+#include <QtJsonRpc/private/qtypedjsontextwriter_p.h>
+#include <QtCore/QByteArray>
+#include <QtCore/QHashFunctions>
+
+#include <memory>
+#include <optional>
+#include <utility>
+
+class tst_QLanguageServer;
+
+QT_BEGIN_NAMESPACE
+
+class QLspNotifySignals;
+class QLspResponseCachePrivate;
+
+class Q_LANGUAGESERVER_EXPORT QLspResponseCache
+{
+    Q_DISABLE_COPY_MOVE(QLspResponseCache)
+public:
+    QLspResponseCache();
+    ~QLspResponseCache();
+
+    // total size of the cached json results, in bytes
+    qsizetype maxCost() const;
+    void setMaxCost(qsizetype maxCost);
+    qsizetype size() const;
+    void clear();
+
+    // the document versions, only requests on open documents are cached
+    void documentOpened(const QByteArray &uri, int version);
+    void documentChanged(const QByteArray &uri, int version);
+    void documentClosed(const QByteArray &uri);
+    std::optional<int> documentVersion(const QByteArray &uri) const;
+    void connectNotifications(QLspNotifySignals *notifySignals);
+
+    template<typename Handler>
+    auto cached(Handler handler);
+
+private:
+    friend class ::tst_QLanguageServer;
+
+    // the json text of the params without workDoneToken, and its hash
+    template<typename Params>
+    static std::pair<QByteArray, quint64> normalizedParams(Params params)
+    {
+        if constexpr (QLspSpecification::HasWorkDoneToken<Params>::value)
+            params.workDoneToken.reset();
+        QByteArray paramsText = QTypedJson::toJsonText(params);
+        const quint64 paramsHash = qHash(paramsText);
+        return { std::move(paramsText), paramsHash };
+    }
+
+    // the wrapped handlers share the private data, so they can outlive the cache
+    static std::optional<int> documentVersion(QLspResponseCachePrivate *d, const QByteArray &uri);
+    static std::optional<QByteArray> lookup(QLspResponseCachePrivate *d, const QByteArray &uri,
+                                            const QByteArray &method,
+                                            const QByteArray &paramsText, quint64 paramsHash,
+                                            int version);
+    static void insert(QLspResponseCachePrivate *d, const QByteArray &uri,
+                       const QByteArray &method, const QByteArray &paramsText,
+                       quint64 paramsHash, int version, const QByteArray &resultText);
+
+    std::shared_ptr<QLspResponseCachePrivate> d;
+};
+
+/*!
+ * \internal
+ * Wraps a request handler so that the results it sends are cached, and sent again for the
+ * same request (method and params without workDoneToken) on the same version of the document.
+ * Requests with a partialResultToken and on documents that are not open are not cached.
+ * A result is stored only if the document did not change while it was computed.
+ *
+ * \code
+ * protocol.registerHoverRequestHandler(cache.cached(hoverHandler));
+ * \endcode
+ */
+template<typename Handler>
+auto QLspResponseCache::cached(Handler handler)
+{
+    return [d = d, handler = std::move(handler)](const QByteArray &method, auto params,
+                                                 auto &&response) {
+        using Params = decltype(params);
+        bool cacheable = true;
+        if constexpr (QLspSpecification::HasPartialResultToken<Params>::value)
+            cacheable = !params.partialResultToken;
+        const QByteArray uri = params.textDocument.uri;
+        const std::optional<int> version = documentVersion(d.get(), uri);
+        if (!cacheable || !version) {
+            handler(method, std::move(params), std::move(response));
+            return;
+        }
+        auto [paramsText, paramsHash] = normalizedParams(params);
+        if (std::optional<QByteArray> resultText =
+                    lookup(d.get(), uri, method, paramsText, paramsHash, *version)) {
+            response.sendSuccessfullResponseText(*resultText);
+            return;
+        }
+        response.setResultTextObserver([d, uri, method, paramsText = std::move(paramsText),
+                                        paramsHash = paramsHash,
+                                        version = *version](const QByteArray &resultText) {
+            insert(d.get(), uri, method, paramsText, paramsHash, version, resultText);
+        });
+        handler(method, std::move(params), std::move(response));
+    };
+}
+
+QT_END_NAMESPACE
+
+#endif // QLSPRESPONSECACHE_P_H
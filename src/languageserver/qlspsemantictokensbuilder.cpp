@@ -0,0 +1,113 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qlspsemantictokensbuilder_p.h"
+
+#include <algorithm>
+#include <utility>
+
+QT_BEGIN_NAMESPACE
+
+using namespace QLspSpecification;
+
+/*!
+\internal
+\class QLspSemanticTokensBuilder
+\brief Builds the data of SemanticTokens from tokens with absolute positions
+
+SemanticTokens::data encodes each token with five ints: its line relative to the line of the
+previous token, its start character (relative to the previous token if on the same line), its
+length, type and modifiers. The builder collects tokens with absolute positions, in any order,
+and encode() sorts them (if needed) and encodes them, in a single pass into one buffer. It has
+to be called after adding tokens, data() and rangeData() only read the encoding, so that an
+encoded builder can be shared by the handlers of several requests.
+
+rangeData() finds the first and last tokens in the range with binary searches over the sorted
+tokens. It copies the encoded data between them, where only the first token has to be made
+absolute, so a viewport request does not encode the tokens again.
+
+The characters are in the negotiated position encoding, the builder does not convert them.
+*/
+
+namespace {
+
+constexpr qsizetype IntsPerToken = 5;
+
+} // namespace
+
+void QLspSemanticTokensBuilder::clear()
+{
+    m_tokens.clear();
+    m_data.clear();
+    m_encoded = true;
+}
+
+void QLspSemanticTokensBuilder::addToken(int line, int startCharacter, int length,
+                                         int tokenType, int tokenModifiers)
+{
+    m_tokens.append(Token { line, startCharacter, length, tokenType, tokenModifiers });
+    m_encoded = false;
+}
+
+QList<int> QLspSemanticTokensBuilder::data() const
+{
+    Q_ASSERT_X(m_encoded, "QLspSemanticTokensBuilder::data", "encode() was not called");
+    return m_data;
+}
+
+QList<int> QLspSemanticTokensBuilder::rangeData(const Range &range) const
+{
+    Q_ASSERT_X(m_encoded, "QLspSemanticTokensBuilder::rangeData", "encode() was not called");
+    // tokens do not overlap, so their ends are sorted like their starts
+    const auto endsBefore = [](const Token &token, const Position &position) {
+        return token.line < position.line
+                || (token.line == position.line
+                    && token.startCharacter + token.length <= position.character);
+    };
+    const auto startsBefore = [](const Token &token, const Position &position) {
+        return token.line < position.line
+                || (token.line == position.line && token.startCharacter < position.character);
+    };
+    const auto first =
+            std::lower_bound(m_tokens.cbegin(), m_tokens.cend(), range.start, endsBefore);
+    const auto last = std::lower_bound(first, m_tokens.cend(), range.end, startsBefore);
+    if (first == last)
+        return {};
+
+    const qsizetype firstIndex = first - m_tokens.cbegin();
+    QList<int> res = m_data.mid(firstIndex * IntsPerToken, (last - first) * IntsPerToken);
+    // the first token is relative to the start of the document
+    res[0] = first->line;
+    res[1] = first->startCharacter;
+    return res;
+}
+
+void QLspSemanticTokensBuilder::encode()
+{
+    if (m_encoded)
+        return;
+    const auto before = [](const Token &a, const Token &b) {
+        return a.line < b.line || (a.line == b.line && a.startCharacter < b.startCharacter);
+    };
+    // the tokens are often added in order
+    if (!std::is_sorted(m_tokens.cbegin(), m_tokens.cend(), before))
+        std::sort(m_tokens.begin(), m_tokens.end(), before);
+
+    m_data.resize(m_tokens.size() * IntsPerToken);
+    int *out = m_data.data();
+    int line = 0;
+    int startCharacter = 0;
+    for (const Token &token : std::as_const(m_tokens)) {
+        *out++ = token.line - line;
+        *out++ = (token.line == line) ? token.startCharacter - startCharacter
+                                      : token.startCharacter;
+        *out++ = token.length;
+        *out++ = token.tokenType;
+        *out++ = token.tokenModifiers;
+        line = token.line;
+        startCharacter = token.startCharacter;
+    }
+    m_encoded = true;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,62 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QLSPSEMANTICTOKENSBUILDER_P_H
+#define QLSPSEMANTICTOKENSBUILDER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtLanguageServer/qtlanguageserverglobal.h>
+#include <QtLanguageServer/private/qlanguageserverspectypes_p.h>
+#include <QtCore/QList>
+
+QT_BEGIN_NAMESPACE
+
+class Q_LANGUAGESERVER_EXPORT QLspSemanticTokensBuilder
+{
+public:
+    QLspSemanticTokensBuilder() = default;
+
+    void reserve(qsizetype size) { m_tokens.reserve(size); }
+    qsizetype size() const { return m_tokens.size(); }
+    void clear();
+    // tokens can be added in any order, but must not overlap
+    void addToken(int line, int startCharacter, int length, int tokenType,
+                  int tokenModifiers = 0);
+
+    // sorts and encodes the tokens added since the last call, before data() and rangeData()
+    void encode();
+    bool isEncoded() const { return m_encoded; }
+
+    // the relative encoding of SemanticTokens::data
+    QList<int> data() const;
+    // the data of the tokens intersecting range, for textDocument/semanticTokens/range
+    QList<int> rangeData(const QLspSpecification::Range &range) const;
+
+private:
+    struct Token
+    {
+        int line;
+        int startCharacter;
+        int length;
+        int tokenType;
+        int tokenModifiers;
+    };
+
+    QList<Token> m_tokens; // sorted by encode()
+    QList<int> m_data;
+    bool m_encoded = true;
+};
+
+QT_END_NAMESPACE
+
+#endif // QLSPSEMANTICTOKENSBUILDER_P_H
@@ -0,0 +1,136 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qlspsemantictokenscache_p.h"
+#include "qlspnotifysignals_p.h"
+
+#include <QtCore/QObject>
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+QT_BEGIN_NAMESPACE
+
+using namespace QLspSpecification;
+
+/*!
+\internal
+\class QLspSemanticTokensCache
+\brief Answers textDocument/semanticTokens/full/delta requests with the edits since the last
+result
+
+full() and delta() remember the last token array sent for each document under a new resultId.
+When a delta request refers to that resultId, delta() sends only the edits transforming the old
+array in the new one: the common prefix and suffix are skipped (comparing blocks of ints with
+memcmp), and the remaining part is replaced with a single edit. If the previous result is not
+known anymore, or if the edit would not be smaller than the whole array, it sends the full
+tokens instead.
+
+The arrays are kept in a QCache, whose cost is their size in bytes. Call documentClosed(), or
+connect the didClose notifications with connectNotifications(), to drop them.
+
+\code
+protocol.registerSemanticTokensDeltaRequestHandler(
+        [&cache](const QByteArray &, const SemanticTokensDeltaParams &params,
+                 SemanticTokensDeltaResponseType &&response) {
+            response.sendResponse(cache.delta(params.textDocument.uri, params.previousResultId,
+                                              computeTokens(params.textDocument.uri)));
+        });
+\endcode
+*/
+
+namespace {
+
+// compare this many ints at once, and look at single ints only in a block that differs
+constexpr qsizetype CompareBlock = 64;
+
+qsizetype commonPrefix(const int *a, const int *b, qsizetype size)
+{
+    qsizetype i = 0;
+    while (size - i >= CompareBlock && std::memcmp(a + i, b + i, CompareBlock * sizeof(int)) == 0)
+        i += CompareBlock;
+    while (i < size && a[i] == b[i])
+        ++i;
+    return i;
+}
+
+// the common suffix of the arrays ending at aEnd and bEnd, of at most size ints
+qsizetype commonSuffix(const int *aEnd, const int *bEnd, qsizetype size)
+{
+    qsizetype i = 0;
+    while (size - i >= CompareBlock) {
+        const qsizetype next = i + CompareBlock;
+        if (std::memcmp(aEnd - next, bEnd - next, CompareBlock * sizeof(int)) != 0)
+            break;
+        i = next;
+    }
+    while (i < size && aEnd[-i - 1] == bEnd[-i - 1])
+        ++i;
+    return i;
+}
+
+} // namespace
+
+SemanticTokens QLspSemanticTokensCache::full(const QByteArray &uri, QList<int> data)
+{
+    SemanticTokens tokens;
+    tokens.resultId = remember(uri, data);
+    tokens.data = std::move(data);
+    return tokens;
+}
+
+Responses::SemanticTokensDeltaResultType
+QLspSemanticTokensCache::delta(const QByteArray &uri, const QByteArray &previousResultId,
+                               QList<int> data)
+{
+    const Entry *previous = m_entries.object(uri);
+    if (!previous || previous->resultId != previousResultId)
+        return full(uri, std::move(data));
+
+    SemanticTokensDelta res;
+    res.edits = edits(previous->data, data);
+    // an edit costs its start and deleteCount besides its data
+    qsizetype deltaSize = 0;
+    for (const SemanticTokensEdit &edit : std::as_const(res.edits))
+        deltaSize += 2 + (edit.data ? edit.data->size() : 0);
+    if (deltaSize >= data.size())
+        return full(uri, std::move(data));
+    res.resultId = remember(uri, std::move(data));
+    return res;
+}
+
+void QLspSemanticTokensCache::connectNotifications(QLspNotifySignals *notifySignals)
+{
+    QObject::connect(notifySignals, &QLspNotifySignals::receivedDidCloseTextDocumentNotification,
+                     &m_context, [this](const DidCloseTextDocumentParams &params) {
+                         documentClosed(params.textDocument.uri);
+                     });
+}
+
+QList<SemanticTokensEdit> QLspSemanticTokensCache::edits(const QList<int> &oldData,
+                                                         const QList<int> &newData)
+{
+    const qsizetype minSize = std::min(oldData.size(), newData.size());
+    const qsizetype prefix = commonPrefix(oldData.constData(), newData.constData(), minSize);
+    if (prefix == oldData.size() && prefix == newData.size())
+        return {};
+    const qsizetype suffix = commonSuffix(oldData.constData() + oldData.size(),
+                                          newData.constData() + newData.size(), minSize - prefix);
+    SemanticTokensEdit edit;
+    edit.start = int(prefix);
+    edit.deleteCount = int(oldData.size() - prefix - suffix);
+    if (newData.size() > prefix + suffix)
+        edit.data = newData.mid(prefix, newData.size() - prefix - suffix);
+    return { edit };
+}
+
+QByteArray QLspSemanticTokensCache::remember(const QByteArray &uri, QList<int> data)
+{
+    const QByteArray resultId = QByteArray::number(++m_lastResultId);
+    const qsizetype cost = data.size() * qsizetype(sizeof(int));
+    m_entries.insert(uri, new Entry { resultId, std::move(data) }, cost);
+    return resultId;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,71 @@
+// Copyright (C) 2025 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QLSPSEMANTICTOKENSCACHE_P_H
+#define QLSPSEMANTICTOKENSCACHE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtLanguageServer/qtlanguageserverglobal.h>
+#include <QtLanguageServer/private/qlanguageserverspec_p.h>
+#include <QtCore/QByteArray>
+#include <QtCore/QCache>
+#include <QtCore/QList>
+#include <QtCore/QObject>
+
+QT_BEGIN_NAMESPACE
+
+class QLspNotifySignals;
+
+class Q_LANGUAGESERVER_EXPORT QLspSemanticTokensCache
+{
+    Q_DISABLE_COPY_MOVE(QLspSemanticTokensCache)
+public:
+    QLspSemanticTokensCache() = default;
+
+    // total size of the remembered token arrays, in bytes
+    qsizetype maxCost() const { return m_entries.maxCost(); }
+    void setMaxCost(qsizetype maxCost) { m_entries.setMaxCost(maxCost); }
+    qsizetype size() const { return m_entries.size(); }
+    void clear() { m_entries.clear(); }
+
+    // the result of textDocument/semanticTokens/full, remembered for later deltas
+    QLspSpecification::SemanticTokens full(const QByteArray &uri, QList<int> data);
+    // the result of textDocument/semanticTokens/full/delta
+    QLspSpecification::Responses::SemanticTokensDeltaResultType
+    delta(const QByteArray &uri, const QByteArray &previousResultId, QList<int> data);
+    void documentClosed(const QByteArray &uri) { m_entries.remove(uri); }
+    void connectNotifications(QLspNotifySignals *notifySignals);
+
+    // the edits transforming oldData in newData, a single edit without the common prefix and
+    // suffix, none if they are equal
+    static QList<QLspSpecification::SemanticTokensEdit> edits(const QList<int> &oldData,
+                                                              const QList<int> &newData);
+
+private:
+    struct Entry
+    {
+        QByteArray resultId;
+        QList<int> data;
+    };
+
+    QByteArray remember(const QByteArray &uri, QList<int> data);
+
+    QCache<QByteArray, Entry> m_entries { 16 * 1024 * 1024 };
+    quint64 m_lastResultId = 0;
+    // context of the notification connections, destroyed first, which disconnects them
+    QObject m_context;
+};
+
+QT_END_NAMESPACE
+
+#endif // QLSPSEMANTICTOKENSCACHE_P_H
@@ -22,6 +22,7 @@ public:
     using EchoHandler = std::function<void(const QByteArray &)>;
 
     void sendMessage(const QJsonDocument &message) final;
+    void sendRawMessage(const QByteArray &json) final;
     void receiveData(const QByteArray &bytes) final;
 
     void setEchoHandler(const EchoHandler &handler) { m_messageHandler = handler; }
@@ -75,6 +76,18 @@ public:
                        const ResponseHandler &handler) final;
 };
 
+class RawSumHandler : public QJsonRpcProtocol::MessageHandler
+{
+public:
+    void handleRequest(const QJsonRpcProtocol::Request &request,
+                       const ResponseHandler &handler) final;
+    void handleNotification(const QJsonRpcProtocol::Notification &notification) final;
+    bool acceptsRawParams() const final { return true; }
+
+    QByteArray lastRawParams;
+    int numNotifications = 0;
+};
+
 class tst_QJsonRpcProtocol : public QObject
 {
     Q_OBJECT
@@ -100,6 +113,9 @@ private slots:
 
     void badResponses();
 
+    void rawParams();
+    void rawMessages();
+
 private:
     EchoTransport transport;
     QJsonRpcProtocol protocol;
@@ -113,6 +129,7 @@ tst_QJsonRpcProtocol::tst_QJsonRpcProtocol()
     protocol.setMessageHandler("update", new UpdateHandler);
     protocol.setMessageHandler("get_data", new GetDataHandler);
     protocol.setMessageHandler("notify_hello", new UpdateHandler);
+    protocol.setMessageHandler("raw_sum", new RawSumHandler);
 }
 
 void tst_QJsonRpcProtocol::specRequests_data()
@@ -529,6 +546,98 @@ void tst_QJsonRpcProtocol::badResponses()
     protocol.setProtocolErrorHandler(nullptr);
 }
 
+void tst_QJsonRpcProtocol::rawParams()
+{
+    RawSumHandler *handler =
+            static_cast<RawSumHandler *>(protocol.messageHandler(QStringLiteral("raw_sum")));
+    QVERIFY(handler != nullptr);
+
+    int responses = 0;
+    transport.setEchoHandler([&](const QByteArray &received) {
+        QJsonDocument expected = sortDocument(
+                QJsonDocument::fromJson(R"({"jsonrpc": "2.0", "result": 6, "id": "a"})"));
+        QCOMPARE(sortDocument(QJsonDocument::fromJson(received)), expected);
+        ++responses;
+    });
+    transport.receiveData(
+            R"({"id": "a", "params": [1, 2, 3 ], "method": "raw_sum", "jsonrpc": "2.0"})");
+    QTRY_COMPARE(responses, 1);
+    QCOMPARE(handler->lastRawParams, QByteArray("[1, 2, 3 ]"));
+
+    transport.setEchoHandler([](const QByteArray &received) { QFAIL(received); });
+    transport.receiveData(R"({"jsonrpc": "2.0", "method": "raw_sum", "params": {"a": [4]}})");
+    QCOMPARE(handler->numNotifications, 1);
+    QCOMPARE(handler->lastRawParams, QByteArray(R"({"a": [4]})"));
+
+    // params are not set at all if missing
+    transport.receiveData(R"({"jsonrpc": "2.0", "method": "raw_sum"})");
+    QCOMPARE(handler->numNotifications, 2);
+    QVERIFY(handler->lastRawParams.isNull());
+
+    // invalid messages still get the usual error responses
+    responses = 0;
+    transport.setEchoHandler([&](const QByteArray &received) {
+        QJsonDocument expected = sortDocument(QJsonDocument::fromJson(
+                R"({"jsonrpc": "2.0", "error": {"code": -32700, "message": "Parse error"},
+                    "id": null})"));
+        QCOMPARE(sortDocument(QJsonDocument::fromJson(received)), expected);
+        ++responses;
+    });
+    transport.receiveData(R"({"jsonrpc": "2.0", "method": "raw_sum", "params": [1, 2}, "id": 3)");
+    QTRY_COMPARE(responses, 1);
+
+    // also when only the params are invalid, in ways that a lenient tokenizer could miss
+    transport.receiveData(R"({"jsonrpc": "2.0", "method": "raw_sum", "params": ["\x"], "id": 3})");
+    QTRY_COMPARE(responses, 2);
+    transport.receiveData(R"({"jsonrpc": "2.0", "method": "raw_sum", "params": [01], "id": 3})");
+    QTRY_COMPARE(responses, 3);
+    transport.receiveData("{\"jsonrpc\": \"2.0\", \"method\": \"raw_sum\", "
+                          "\"params\": [\"\xc0\xaf\"], \"id\": 3}");
+    QTRY_COMPARE(responses, 4);
+
+    transport.setEchoHandler(nullptr);
+}
+
+void tst_QJsonRpcProtocol::rawMessages()
+{
+    QList<QByteArray> sent;
+    transport.setEchoHandler([&](const QByteArray &received) { sent.append(received); });
+
+    // raw params and results are embedded in the message text as they are
+    protocol.sendNotification(QJsonRpcProtocol::Notification {
+            QStringLiteral("notify_hello"), QJsonValue::Undefined,
+            QByteArray(R"({"text":"\u00e9 \n"})") });
+    QCOMPARE(sent.size(), 1);
+    QCOMPARE(sent.last(),
+             QByteArray(R"({"jsonrpc":"2.0","method":"notify_hello",)"
+                        R"("params":{"text":"\u00e9 \n"}})"));
+
+    protocol.sendRequest(QJsonRpcProtocol::Request { QStringLiteral("raw-request"),
+                                                     QStringLiteral("sum"), QJsonValue::Undefined,
+                                                     QByteArray("[1,2]") },
+                         [](const QJsonRpcProtocol::Response &) {});
+    QCOMPARE(sent.size(), 2);
+    QCOMPARE(sent.last(),
+             QByteArray(R"({"id":"raw-request","jsonrpc":"2.0","method":"sum","params":[1,2]})"));
+
+    transport.receiveData(
+            R"({"jsonrpc": "2.0", "method": "raw_sum", "params": [1, 2], "id": "b"})");
+    QTRY_COMPARE(sent.size(), 3);
+    QCOMPARE(sent.last(), QByteArray(R"({"id":"b","jsonrpc":"2.0","result":3})"));
+
+    // errors have a data member only if there is raw data
+    transport.receiveData(R"({"jsonrpc": "2.0", "method": "raw_sum", "params": {}, "id": "c"})");
+    QTRY_COMPARE(sent.size(), 4);
+    QCOMPARE(sent.last(),
+             QByteArray(R"({"error":{"code":-32602,"message":"Invalid Parameters"},)"
+                        R"("id":"c","jsonrpc":"2.0"})"));
+    QJsonParseError parseError;
+    QJsonDocument::fromJson(sent.last(), &parseError);
+    QCOMPARE(parseError.error, QJsonParseError::NoError);
+
+    transport.setEchoHandler(nullptr);
+}
+
 void tst_QJsonRpcProtocol::testHttpMessagesSplits_data()
 {
     static const QByteArray payload1 = "{\"some\":\"json\"}";
@@ -694,14 +803,48 @@ void GetDataHandler::handleRequest(const QJsonRpcProtocol::Request &request,
     });
 }
 
+void RawSumHandler::handleRequest(const QJsonRpcProtocol::Request &request,
+                                  const ResponseHandler &handler)
+{
+    lastRawParams = request.rawParams;
+    const QJsonDocument params = QJsonDocument::fromJson(request.rawParams);
+    if (!params.isArray()) {
+        // an error without data, even if rawData is not null
+        QJsonRpcProtocol::Response response = error(QJsonRpcProtocol::ErrorCode::InvalidParams);
+        response.rawData = QByteArray("");
+        return handler(response);
+    }
+    double sum = 0;
+    const QJsonArray values = params.array();
+    for (const QJsonValue &value : values)
+        sum += value.toDouble();
+    QJsonRpcProtocol::Response response;
+    response.rawData = QByteArray::number(sum);
+    handler(response);
+}
+
+void RawSumHandler::handleNotification(const QJsonRpcProtocol::Notification &notification)
+{
+    lastRawParams = notification.rawParams;
+    ++numNotifications;
+}
+
 void EchoTransport::sendMessage(const QJsonDocument &message)
 {
     if (m_messageHandler)
         m_messageHandler(message.toJson(QJsonDocument::Compact));
 }
 
+void EchoTransport::sendRawMessage(const QByteArray &json)
+{
+    if (m_messageHandler)
+        m_messageHandler(json);
+}
+
 void EchoTransport::receiveData(const QByteArray &bytes)
 {
+    if (auto handler = rawMessageHandler(); handler && handler(bytes))
+        return;
     QJsonParseError error = QJsonParseError();
     const QJsonDocument doc = QJsonDocument::fromJson(bytes, &error);
     messageHandler()(doc, error);
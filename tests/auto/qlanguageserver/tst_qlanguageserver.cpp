@@ -6,6 +6,18 @@
 #include <QtJsonRpc/private/qjsonrpcprotocol_p.h>
 #include <QtLanguageServer/private/qlanguageserverjsonrpctransport_p.h>
 #include <QtLanguageServer/private/qlanguageserverprotocol_p.h>
+#include <QtLanguageServer/private/qlsppartialresultstreamer_p.h>
+#include <QtLanguageServer/private/qlspprogressreporter_p.h>
+#include <QtLanguageServer/private/qlspresponsecache_p.h>
+#include <QtLanguageServer/private/qlspdocumentstore_p.h>
+#include <QtLanguageServer/private/qlsplineindex_p.h>
+#include <QtLanguageServer/private/qlsppositionencoding_p.h>
+#include <QtLanguageServer/private/qlspsemantictokenscache_p.h>
+#include <QtLanguageServer/private/qlspsemantictokensbuilder_p.h>
+#include <QtLanguageServer/private/qlspdiagnosticspublisher_p.h>
+#include <QtLanguageServer/private/qlspdiagnosticreports_p.h>
+#include <QtLanguageServer/private/qlspcompletioncache_p.h>
+#include <QtLanguageServer/private/qlspnotifysignals_p.h>
 
 #include <QtCore/qjsonarray.h>
 #include <QtCore/qjsonobject.h>
@@ -164,6 +176,19 @@ private slots:
 
     void clientRegisterCapability();
     void setRequestHandler();
+    void movedRequestParams();
+    void partialResults();
+    void aggregatedPartialResults();
+    void progressReporter();
+    void responseCache();
+    void documentStore();
+    void lineIndex();
+    void positionEncoding();
+    void semanticTokensDelta();
+    void semanticTokensBuilder();
+    void diagnosticsPublisher();
+    void pullDiagnostics();
+    void completionCache();
 
 private:
     void logOrShowMessage(const QString &method);
@@ -753,6 +778,829 @@ void tst_QLanguageServer::setRequestHandler()
     QCOMPARE(response.data, QTypedJson::toJsonValue(locations));
 }
 
+void tst_QLanguageServer::movedRequestParams()
+{
+    TestRig test;
+
+    // handlers can take the decoded parameters by rvalue reference and keep them
+    QLspSpecification::ReferenceParams kept;
+    test.protocol.registerReferenceRequestHandler(
+            [&kept](const QByteArray &, QLspSpecification::ReferenceParams &&params,
+                    QLspSpecification::LSPPartialResponse<
+                            std::variant<QList<QLspSpecification::Location>, std::nullptr_t>,
+                            QList<QLspSpecification::Location>> &&result) {
+                kept = std::move(params);
+                result.sendResponse(nullptr);
+            });
+
+    test.open();
+    test.initialize();
+
+    QLspSpecification::ReferenceParams params;
+    params.textDocument.uri = "file:///a.qml";
+    params.position.line = 3;
+    QJsonRpcProtocol::Response response;
+    sendAndWaitJsonRpc(&test.client,
+                       { 4, "textDocument/references", QTypedJson::toJsonValue(params) },
+                       [&](const QJsonRpcProtocol::Response &received) { response = received; });
+    QVERIFY(response.errorCode.isUndefined());
+    QCOMPARE(kept.textDocument.uri, QByteArray("file:///a.qml"));
+    QCOMPARE(kept.position.line, 3);
+}
+
+void tst_QLanguageServer::partialResults()
+{
+    using Responses::ReferenceResponseType;
+    TestRig test;
+    test.protocol.registerReferenceRequestHandler(
+            [](const QByteArray &, const ReferenceParams &params,
+               ReferenceResponseType &&response) {
+                QLspPartialResultStreamer<ReferenceResponseType> streamer(std::move(response));
+                streamer.setMaxItems(2);
+                streamer.setMaxDelay(std::chrono::milliseconds(-1));
+                for (int i = 0; i < 5; ++i) {
+                    Location location;
+                    location.uri = params.textDocument.uri;
+                    location.range.start.line = i;
+                    location.range.end.line = i;
+                    streamer.append(location);
+                }
+            });
+
+    QList<QJsonValue> progress;
+    test.client.setMessageHandler(
+            "$/progress",
+            new NotificationHandler([&](const QJsonRpcProtocol::Notification &notification) {
+                progress.append(notification.params);
+            }));
+
+    test.open();
+    test.initialize();
+
+    // with a partialResultToken the items are sent in batches, and the response is empty
+    ReferenceParams params;
+    params.textDocument.uri = "file:///a.qml";
+    params.partialResultToken = QByteArray("refs");
+    QJsonRpcProtocol::Response response;
+    sendAndWaitJsonRpc(&test.client,
+                       { 5, "textDocument/references", QTypedJson::toJsonValue(params) },
+                       [&](const QJsonRpcProtocol::Response &received) { response = received; });
+    QVERIFY(response.errorCode.isUndefined());
+    QCOMPARE(response.data, QJsonValue(QJsonArray()));
+    QCOMPARE(progress.size(), 3);
+    int line = 0;
+    for (const QJsonValue &p : std::as_const(progress)) {
+        QCOMPARE(p[u"token"_s], QJsonValue(u"refs"_s));
+        const QJsonArray value = p[u"value"_s].toArray();
+        QCOMPARE(value.size(), line < 4 ? 2 : 1);
+        for (const QJsonValue &location : value)
+            QCOMPARE(location[u"range"_s][u"start"_s][u"line"_s].toInt(), line++);
+    }
+    QCOMPARE(line, 5);
+
+    // without it everything is in the response
+    progress.clear();
+    params.partialResultToken.reset();
+    sendAndWaitJsonRpc(&test.client,
+                       { 6, "textDocument/references", QTypedJson::toJsonValue(params) },
+                       [&](const QJsonRpcProtocol::Response &received) { response = received; });
+    QVERIFY(response.errorCode.isUndefined());
+    QCOMPARE(response.data.toArray().size(), 5);
+    QVERIFY(progress.isEmpty());
+}
+
+void tst_QLanguageServer::aggregatedPartialResults()
+{
+    TestRig test;
+    test.open();
+
+    // the other side sends two partial results, an unrelated progress, and the final response
+    QJsonValue token;
+    test.client.setMessageHandler(
+            "textDocument/references",
+            new RequestHandler([&](const QJsonRpcProtocol::Request &request) {
+                token = request.params[u"partialResultToken"_s];
+                auto location = [](int line) {
+                    const QJsonObject position { { u"line"_s, line }, { u"character"_s, 0 } };
+                    const QJsonObject range { { u"start"_s, position }, { u"end"_s, position } };
+                    return QJsonObject { { u"uri"_s, u"file:///a.qml"_s }, { u"range"_s, range } };
+                };
+                auto progress = [&](const QJsonValue &progressToken, const QJsonValue &value) {
+                    const QJsonObject params { { u"token"_s, progressToken },
+                                               { u"value"_s, value } };
+                    test.client.sendNotification({ u"$/progress"_s, params });
+                };
+                progress(token, QJsonArray { location(0), location(1) });
+                progress(u"other"_s, QJsonObject { { u"kind"_s, u"end"_s } });
+                progress(token, QJsonArray { location(2) });
+                return QJsonRpcProtocol::Response { request.id, QJsonArray { location(3) },
+                                                    QJsonValue::Undefined, QString() };
+            }));
+
+    // progress with other tokens goes to the progress notification handler
+    QList<QByteArray> otherTokens;
+    test.protocol.registerProgressNotificationHandler(
+            [&](const QByteArray &, ProgressNotificationParams<QJsonValue> params) {
+                otherTokens.append(std::get<QByteArray>(params.token));
+                QCOMPARE(params.value[u"kind"_s], QJsonValue(u"end"_s));
+            });
+
+    QList<int> partialLines;
+    QList<int> resultLines;
+    bool finished = false;
+    ReferenceParams params;
+    params.textDocument.uri = "file:///a.qml";
+    test.protocol.requestReference(
+            params,
+            [&](const QList<Location> &partial) {
+                QVERIFY(resultLines.isEmpty());
+                for (const Location &l : partial)
+                    partialLines.append(l.range.start.line);
+            },
+            [&](const std::variant<QList<Location>, std::nullptr_t> &result) {
+                QCOMPARE(result.index(), std::size_t(0));
+                for (const Location &l : std::get<QList<Location>>(result))
+                    resultLines.append(l.range.start.line);
+                finished = true;
+            });
+    QTRY_VERIFY(finished);
+    QVERIFY(token.isString());
+    QCOMPARE(partialLines, QList<int>({ 0, 1, 2 }));
+    QCOMPARE(resultLines, QList<int>({ 0, 1, 2, 3 }));
+    QCOMPARE(otherTokens, QList<QByteArray>({ QByteArray("other") }));
+}
+
+void tst_QLanguageServer::progressReporter()
+{
+    TestRig test;
+    test.open();
+
+    QJsonValue createdToken;
+    test.client.setMessageHandler(
+            "window/workDoneProgress/create",
+            new RequestHandler([&](const QJsonRpcProtocol::Request &request) {
+                createdToken = request.params[u"token"_s];
+                return QJsonRpcProtocol::Response { request.id, QJsonValue::Null,
+                                                    QJsonValue::Undefined, QString() };
+            }));
+    QList<QJsonValue> progress;
+    test.client.setMessageHandler(
+            "$/progress",
+            new NotificationHandler([&](const QJsonRpcProtocol::Notification &notification) {
+                progress.append(notification.params);
+            }));
+    auto kind = [&](qsizetype i) { return progress.at(i)[u"value"_s][u"kind"_s].toString(); };
+
+    // updates sent before the client created the token are merged away by end
+    {
+        QLspProgressReporter reporter(&test.protocol);
+        reporter.begin("Indexing");
+        QCOMPARE(reporter.state(), QLspProgressReporter::State::Creating);
+        for (int i = 0; i < 100; ++i)
+            reporter.report(std::nullopt, i);
+        reporter.end("done");
+        QTRY_COMPARE(reporter.state(), QLspProgressReporter::State::Ended);
+    }
+    QTRY_COMPARE(progress.size(), 2);
+    QVERIFY(createdToken.isString());
+    QCOMPARE(progress.at(0)[u"token"_s], createdToken);
+    QCOMPARE(kind(0), u"begin"_s);
+    QCOMPARE(progress.at(0)[u"value"_s][u"title"_s], QJsonValue(u"Indexing"_s));
+    QCOMPARE(kind(1), u"end"_s);
+    QCOMPARE(progress.at(1)[u"value"_s][u"message"_s], QJsonValue(u"done"_s));
+
+    // with a token from the client, reports are sent on percentage steps and then rate limited
+    progress.clear();
+    QLspProgressReporter reporter(&test.protocol);
+    reporter.setToken(QByteArray("work"));
+    reporter.setMaxReportsPerSecond(1);
+    reporter.setPercentageStep(20);
+    reporter.begin("Indexing", true);
+    for (int i = 0; i < 100; ++i)
+        reporter.report(std::nullopt, i);
+
+    QSignalSpy cancelled(&reporter, &QLspProgressReporter::cancelled);
+    WorkDoneProgressCancelParams cancel;
+    cancel.token = QByteArray("other");
+    QVERIFY(!reporter.handleCancel(cancel));
+    cancel.token = QByteArray("work");
+    QVERIFY(reporter.handleCancel(cancel));
+    QVERIFY(reporter.isCancelled());
+    QCOMPARE(cancelled.size(), 1);
+
+    reporter.end();
+    QTRY_VERIFY(!progress.isEmpty() && kind(progress.size() - 1) == u"end"_s);
+    QCOMPARE(kind(0), u"begin"_s);
+    QCOMPARE(progress.at(0)[u"value"_s][u"cancellable"_s], QJsonValue(true));
+    QVERIFY(progress.size() >= 7); // begin, 0%, 20%, 40%, 60%, 80%, end
+    QVERIFY(progress.size() < 20);
+    for (const QJsonValue &p : std::as_const(progress))
+        QCOMPARE(p[u"token"_s], QJsonValue(u"work"_s));
+}
+
+void tst_QLanguageServer::responseCache()
+{
+    TestRig test;
+    QLspResponseCache cache;
+    int calls = 0;
+    test.protocol.registerFoldingRangeRequestHandler(
+            cache.cached([&calls](const QByteArray &, const FoldingRangeParams &,
+                                  Responses::FoldingRangeResponseType &&response) {
+                FoldingRange range;
+                range.startLine = ++calls;
+                range.endLine = 10;
+                response.sendResponse(QList<FoldingRange>({ range }));
+            }));
+
+    test.open();
+    test.initialize();
+
+    int id = 1;
+    auto request = [&](const QByteArray &uri, std::optional<int> workDoneToken = {}) {
+        FoldingRangeParams params;
+        params.textDocument.uri = uri;
+        if (workDoneToken)
+            params.workDoneToken = *workDoneToken;
+        QJsonValue result;
+        sendAndWaitJsonRpc(&test.client,
+                           { ++id, "textDocument/foldingRange", QTypedJson::toJsonValue(params) },
+                           [&](const QJsonRpcProtocol::Response &response) {
+                               result = response.data;
+                           });
+        return result[0][u"startLine"_s].toInt();
+    };
+
+    // only open documents are cached, the workDoneToken does not matter
+    QCOMPARE(request("file:///a.qml"), 1);
+    QCOMPARE(request("file:///a.qml"), 2);
+    cache.documentOpened("file:///a.qml", 1);
+    QCOMPARE(request("file:///a.qml", 7), 3);
+    QCOMPARE(request("file:///a.qml"), 3);
+    QCOMPARE(request("file:///a.qml", 8), 3);
+    QCOMPARE(calls, 3);
+    QCOMPARE(cache.size(), 1);
+
+    // a change of the document drops its results
+    cache.documentChanged("file:///a.qml", 2);
+    QCOMPARE(cache.size(), 0);
+    QCOMPARE(request("file:///a.qml"), 4);
+    QCOMPARE(request("file:///a.qml"), 4);
+    cache.documentClosed("file:///a.qml");
+    QCOMPARE(request("file:///a.qml"), 5);
+    QVERIFY(!cache.documentVersion("file:///a.qml"));
+    // the params text is compared, not only its hash
+    cache.documentOpened("file:///b.qml", 1);
+    QLspResponseCache::insert(cache.d.get(), "file:///b.qml", "textDocument/hover",
+                              R"({"line":1})", 42, 1, "1");
+    QVERIFY(!QLspResponseCache::lookup(cache.d.get(), "file:///b.qml", "textDocument/hover",
+                                       R"({"line":2})", 42, 1));
+    QCOMPARE(QLspResponseCache::lookup(cache.d.get(), "file:///b.qml", "textDocument/hover",
+                                       R"({"line":1})", 42, 1)
+                     .value_or(QByteArray()),
+             QByteArray("1"));
+}
+
+void tst_QLanguageServer::documentStore()
+{
+    QLspDocumentStore store;
+    DidOpenTextDocumentParams open;
+    open.textDocument.uri = "file:///a.qml";
+    open.textDocument.languageId = "qml";
+    open.textDocument.version = 1;
+    open.textDocument.text = "import QtQuick\nItem {\n}\n";
+    store.open(open);
+    QVERIFY(store.contains("file:///a.qml"));
+    QVERIFY(!store.snapshot("file:///b.qml").isValid());
+
+    int version = 1;
+    auto change = [&](int startLine, int startCharacter, int endLine, int endCharacter,
+                      const QByteArray &text) {
+        DidChangeTextDocumentParams params;
+        params.textDocument.uri = "file:///a.qml";
+        params.textDocument.version = ++version;
+        TextDocumentContentChangeEvent event;
+        event.range = Range { Position { startLine, startCharacter },
+                              Position { endLine, endCharacter } };
+        event.text = text;
+        params.contentChanges.append(event);
+        return store.change(params);
+    };
+
+    const QLspDocumentSnapshot first = store.snapshot("file:///a.qml");
+    QCOMPARE(first.lineCount(), 4);
+    QCOMPARE(first.line(1), QByteArray("Item {"));
+    QCOMPARE(first.languageId(), QByteArray("qml"));
+
+    QVERIFY(change(1, 6, 1, 6, "\n    width: 10"));
+    QVERIFY(change(0, 7, 0, 14, "QtQml"));
+    const QLspDocumentSnapshot second = store.snapshot("file:///a.qml");
+    QCOMPARE(second.version(), 3);
+    QCOMPARE(second.text(), QByteArray("import QtQml\nItem {\n    width: 10\n}\n"));
+    QCOMPARE(second.line(2), QByteArray("    width: 10"));
+    // snapshots keep their content
+    QCOMPARE(first.text(), QByteArray("import QtQuick\nItem {\n}\n"));
+    QCOMPARE(first.version(), 1);
+
+    // characters are UTF-16 code units
+    QVERIFY(change(2, 11, 2, 13, "\"\u00e9\U0001F600x\""));
+    QCOMPARE(store.snapshot("file:///a.qml").line(2),
+             QByteArray("    width: \"\u00e9\U0001F600x\""));
+    QVERIFY(change(2, 13, 2, 15, ""));
+    QCOMPARE(store.snapshot("file:///a.qml").line(2), QByteArray("    width: \"\u00e9x\""));
+
+    // edits in the middle of a large document
+    DidChangeTextDocumentParams full;
+    full.textDocument.uri = "file:///a.qml";
+    full.textDocument.version = ++version;
+    TextDocumentContentChangeEvent replaceAll;
+    for (int i = 0; i < 10000; ++i)
+        replaceAll.text += "line " + QByteArray::number(i) + "\n";
+    full.contentChanges.append(replaceAll);
+    QVERIFY(store.change(full));
+    QCOMPARE(store.snapshot("file:///a.qml").lineCount(), 10001);
+    for (int i = 0; i < 100; ++i)
+        QVERIFY(change(5000, 5, 5000, 5, "x"));
+    QVERIFY(change(2000, 0, 8000, 0, ""));
+    const QLspDocumentSnapshot large = store.snapshot("file:///a.qml");
+    QCOMPARE(large.lineCount(), 4001);
+    QCOMPARE(large.line(1999), QByteArray("line 1999"));
+    QCOMPARE(large.line(2000), QByteArray("line 8000"));
+    QByteArray expected;
+    for (int i = 0; i < 10000; ++i) {
+        if (i < 2000 || i >= 8000)
+            expected += "line " + QByteArray::number(i) + "\n";
+    }
+    QCOMPARE(large.text(), expected);
+
+    DidCloseTextDocumentParams close;
+    close.textDocument.uri = "file:///a.qml";
+    store.close(close);
+    QVERIFY(!store.contains("file:///a.qml"));
+    QVERIFY(!change(0, 0, 0, 0, "x"));
+
+    // the notifications are followed, and a destroyed store is disconnected
+    QLspNotifySignals notifySignals;
+    {
+        QLspDocumentStore connected;
+        connected.connectNotifications(&notifySignals);
+        emit notifySignals.receivedDidOpenTextDocumentNotification(open);
+        QVERIFY(connected.contains("file:///a.qml"));
+        emit notifySignals.receivedDidCloseTextDocumentNotification(close);
+        QVERIFY(!connected.contains("file:///a.qml"));
+    }
+    emit notifySignals.receivedDidOpenTextDocumentNotification(open);
+}
+
+void tst_QLanguageServer::lineIndex()
+{
+    // line 1 has an e with acute accent (2 bytes, 1 unit) and a smiley (4 bytes, 2 units)
+    const QByteArray text("import QtQuick\r\n"
+                          "Text { text: \"\u00e9\U0001F600 and more text\" }\n\n");
+    QLspLineIndex index(text);
+    QCOMPARE(index.lineCount(), 4);
+    QVERIFY(index.isAsciiLine(0));
+    QVERIFY(!index.isAsciiLine(1));
+    QCOMPARE(index.lineStart(1), 16);
+    QCOMPARE(index.lineEnd(0), 14);
+    QCOMPARE(index.lineAt(15), 0);
+    QCOMPARE(index.lineAt(16), 1);
+
+    auto position = [](int line, int character) { return Position { line, character }; };
+    QCOMPARE(index.offsetAt(position(0, 7)), 7);
+    QCOMPARE(index.offsetAt(position(0, 100)), 14);
+    const qsizetype quote = index.lineStart(1) + 13;
+    QCOMPARE(index.offsetAt(position(1, 14)), quote + 1);
+    QCOMPARE(index.offsetAt(position(1, 15)), quote + 3);
+    QCOMPARE(index.offsetAt(position(1, 17)), quote + 7);
+    QCOMPARE(index.offsetAt(position(1, 21)), quote + 11);
+    QCOMPARE(index.offsetAt(position(10, 0)), text.size());
+    QCOMPARE(index.positionAt(quote + 7).character, 17);
+    QCOMPARE(index.positionAt(text.size()).line, 3);
+
+    // bulk conversions give the same results, sorted or not
+    const QList<Position> positions = { position(0, 0),  position(0, 7),  position(1, 2),
+                                        position(1, 15), position(1, 17), position(1, 30),
+                                        position(2, 0),  position(1, 14), position(3, 0) };
+    const QList<qsizetype> offsets = index.offsetsAt(positions);
+    QCOMPARE(offsets.size(), positions.size());
+    for (int i = 0; i < positions.size(); ++i)
+        QCOMPARE(offsets.at(i), index.offsetAt(positions.at(i)));
+    const QList<Position> converted = index.positionsAt(offsets);
+    for (int i = 0; i < offsets.size(); ++i) {
+        QCOMPARE(converted.at(i).line, positions.at(i).line);
+        QCOMPARE(converted.at(i).character, positions.at(i).character);
+    }
+
+    QLspLineIndex empty;
+    QCOMPARE(empty.lineCount(), 1);
+    QCOMPARE(empty.offsetAt(position(0, 3)), 0);
+}
+
+void tst_QLanguageServer::positionEncoding()
+{
+    // the server picks its preferred encoding among the ones of the client, utf-16 by default
+    ClientCapabilities capabilities;
+    QCOMPARE(qLspNegotiatePositionEncoding(capabilities), QLspPositionEncoding::Utf16);
+    capabilities.general = GeneralClientCapabilities();
+    capabilities.general->positionEncodings = QList<QByteArray>({ "utf-32", "utf-8", "utf-16" });
+    QCOMPARE(qLspNegotiatePositionEncoding(capabilities), QLspPositionEncoding::Utf8);
+    QCOMPARE(qLspNegotiatePositionEncoding(capabilities, { QLspPositionEncoding::Utf32 }),
+             QLspPositionEncoding::Utf32);
+    capabilities.general->positionEncodings = QList<QByteArray>({ "utf-16" });
+    QCOMPARE(qLspNegotiatePositionEncoding(capabilities), QLspPositionEncoding::Utf16);
+    QCOMPARE(QTypedJson::toJsonValue(capabilities)[u"general"_s][u"positionEncodings"_s][0],
+             QJsonValue(u"utf-16"_s));
+
+    // the members that GeneralClientCapabilities does not model are kept
+    const QJsonObject staleRequestSupport({ { u"cancel"_s, true } });
+    const QJsonObject general({ { u"positionEncodings"_s, QJsonArray({ u"utf-8"_s }) },
+                                { u"staleRequestSupport"_s, staleRequestSupport } });
+    ClientCapabilities decoded;
+    QTypedJson::Reader reader(QJsonObject({ { u"general"_s, general } }));
+    QTypedJson::doWalk(reader, decoded);
+    QVERIFY(!reader.hasErrors());
+    QVERIFY(decoded.general);
+    QCOMPARE(qLspNegotiatePositionEncoding(decoded), QLspPositionEncoding::Utf8);
+    QCOMPARE(decoded.general->extraFields,
+             QJsonObject({ { u"staleRequestSupport"_s, staleRequestSupport } }));
+
+    ServerCapabilities serverCapabilities;
+    serverCapabilities.positionEncoding = qLspPositionEncodingName(QLspPositionEncoding::Utf8);
+    QCOMPARE(QTypedJson::toJsonValue(serverCapabilities)[u"positionEncoding"_s],
+             QJsonValue(u"utf-8"_s));
+    QCOMPARE(qLspPositionEncodingFromName("utf-32").value_or(QLspPositionEncoding::Utf16),
+             QLspPositionEncoding::Utf32);
+    QVERIFY(!qLspPositionEncodingFromName("utf-7"));
+
+    // the protocol negotiates the encoding in the initialize request, and sends it back
+    {
+        TestRig test;
+        test.open();
+        QCOMPARE(test.protocol.positionEncoding(), QLspPositionEncoding::Utf16);
+        InitializeParams params;
+        params.capabilities = capabilities;
+        params.capabilities.general->positionEncodings = QList<QByteArray>({ "utf-8" });
+        QJsonValue result;
+        sendAndWaitJsonRpc(&test.client, { 0, "initialize", QTypedJson::toJsonValue(params) },
+                           [&](const QJsonRpcProtocol::Response &response) {
+                               result = response.data;
+                           });
+        QCOMPARE(test.protocol.positionEncoding(), QLspPositionEncoding::Utf8);
+        QCOMPARE(result[u"capabilities"_s][u"positionEncoding"_s], QJsonValue(u"utf-8"_s));
+    }
+
+    // an e with acute accent (2 bytes) and a smiley (4 bytes)
+    const QByteArray text("a\u00e9\U0001F600b\n");
+    QLspLineIndex index(text);
+    QCOMPARE(index.offsetAt(Position { 0, 4 }), 7);
+    index.setPositionEncoding(QLspPositionEncoding::Utf8);
+    QCOMPARE(index.offsetAt(Position { 0, 3 }), 3);
+    QCOMPARE(index.positionAt(7).character, 7);
+    index.setPositionEncoding(QLspPositionEncoding::Utf32);
+    QCOMPARE(index.offsetAt(Position { 0, 3 }), 7);
+    QCOMPARE(index.positionAt(7).character, 3);
+
+    QLspDocumentStore store;
+    store.setPositionEncoding(QLspPositionEncoding::Utf8);
+    DidOpenTextDocumentParams open;
+    open.textDocument.uri = "file:///a.qml";
+    open.textDocument.text = text;
+    store.open(open);
+    DidChangeTextDocumentParams params;
+    params.textDocument.uri = "file:///a.qml";
+    TextDocumentContentChangeEvent event;
+    event.range = Range { Position { 0, 7 }, Position { 0, 8 } };
+    event.text = "c";
+    params.contentChanges.append(event);
+    QVERIFY(store.change(params));
+    const QLspDocumentSnapshot snapshot = store.snapshot("file:///a.qml");
+    QCOMPARE(snapshot.text(), QByteArray("a\u00e9\U0001F600c\n"));
+    QCOMPARE(QLspLineIndex(snapshot).positionEncoding(), QLspPositionEncoding::Utf8);
+}
+
+void tst_QLanguageServer::semanticTokensDelta()
+{
+    auto apply = [](QList<int> data, const QList<SemanticTokensEdit> &edits) {
+        for (const SemanticTokensEdit &edit : edits) {
+            data.remove(edit.start, edit.deleteCount);
+            if (edit.data)
+                data.insert(edit.start, edit.data->size(), 0);
+            for (int i = 0; edit.data && i < edit.data->size(); ++i)
+                data[edit.start + i] = edit.data->at(i);
+        }
+        return data;
+    };
+
+    QList<int> tokens;
+    for (int i = 0; i < 1000; ++i)
+        tokens.append(i % 7);
+    QCOMPARE(QLspSemanticTokensCache::edits(tokens, tokens).size(), 0);
+    QList<int> inserted = tokens;
+    inserted.insert(500, 5, 9);
+    QList<SemanticTokensEdit> edits = QLspSemanticTokensCache::edits(tokens, inserted);
+    QCOMPARE(edits.size(), 1);
+    QCOMPARE(edits.first().deleteCount, 0);
+    QCOMPARE(apply(tokens, edits), inserted);
+    QCOMPARE(apply(inserted, QLspSemanticTokensCache::edits(inserted, tokens)), tokens);
+    QCOMPARE(apply(tokens, QLspSemanticTokensCache::edits(tokens, {})), QList<int>());
+
+    QLspSemanticTokensCache cache;
+    const SemanticTokens full = cache.full("file:///a.qml", tokens);
+    QVERIFY(full.resultId);
+    QCOMPARE(full.data, tokens);
+
+    QList<int> changed = tokens;
+    changed[700] = 42;
+    auto result = cache.delta("file:///a.qml", *full.resultId, changed);
+    QVERIFY(std::holds_alternative<SemanticTokensDelta>(result));
+    const SemanticTokensDelta delta = std::get<SemanticTokensDelta>(result);
+    QCOMPARE(delta.edits.size(), 1);
+    QCOMPARE(delta.edits.first().start, 700);
+    QCOMPARE(delta.edits.first().deleteCount, 1);
+    QCOMPARE(apply(tokens, delta.edits), changed);
+    QVERIFY(delta.resultId && *delta.resultId != *full.resultId);
+
+    // an unknown previous result, or a delta bigger than the tokens, give the full tokens
+    result = cache.delta("file:///a.qml", *full.resultId, tokens);
+    QVERIFY(std::holds_alternative<SemanticTokens>(result));
+    const QByteArray lastResultId = *std::get<SemanticTokens>(result).resultId;
+    QList<int> different;
+    for (int i = 0; i < 1000; ++i)
+        different.append(i % 5 + 10);
+    result = cache.delta("file:///a.qml", lastResultId, different);
+    QVERIFY(std::holds_alternative<SemanticTokens>(result));
+    QCOMPARE(std::get<SemanticTokens>(result).data, different);
+
+    cache.documentClosed("file:///a.qml");
+    QCOMPARE(cache.size(), 0);
+
+    // didClose drops the tokens, and a destroyed cache is disconnected
+    QLspNotifySignals notifySignals;
+    DidCloseTextDocumentParams close;
+    close.textDocument.uri = "file:///a.qml";
+    {
+        QLspSemanticTokensCache connected;
+        connected.connectNotifications(&notifySignals);
+        connected.full("file:///a.qml", tokens);
+        QCOMPARE(connected.size(), 1);
+        emit notifySignals.receivedDidCloseTextDocumentNotification(close);
+        QCOMPARE(connected.size(), 0);
+    }
+    emit notifySignals.receivedDidCloseTextDocumentNotification(close);
+}
+
+void tst_QLanguageServer::semanticTokensBuilder()
+{
+    QLspSemanticTokensBuilder builder;
+    builder.addToken(5, 4, 3, 2);
+    builder.addToken(0, 0, 6, 1);
+    builder.addToken(5, 10, 2, 0, 1);
+    builder.addToken(2, 7, 5, 3);
+    QVERIFY(!builder.isEncoded());
+    builder.encode();
+    QVERIFY(builder.isEncoded());
+    QCOMPARE(builder.data(),
+             QList<int>({ 0, 0, 6, 1, 0, 2, 7, 5, 3, 0, 3, 4, 3, 2, 0, 0, 6, 2, 0, 1 }));
+
+    auto range = [](int startLine, int startCharacter, int endLine, int endCharacter) {
+        return Range { Position { startLine, startCharacter }, Position { endLine, endCharacter } };
+    };
+    // the first token of a range is absolute
+    QCOMPARE(builder.rangeData(range(1, 0, 5, 0)), QList<int>({ 2, 7, 5, 3, 0 }));
+    QCOMPARE(builder.rangeData(range(5, 6, 6, 0)), QList<int>({ 5, 4, 3, 2, 0, 0, 6, 2, 0, 1 }));
+    QCOMPARE(builder.rangeData(range(5, 7, 6, 0)), QList<int>({ 5, 10, 2, 0, 1 }));
+    QCOMPARE(builder.rangeData(range(0, 0, 100, 0)), builder.data());
+    QVERIFY(builder.rangeData(range(3, 0, 5, 4)).isEmpty());
+
+    // tokens added later are encoded again
+    builder.addToken(9, 1, 1, 1);
+    builder.encode();
+    QCOMPARE(builder.data().size(), 25);
+    QCOMPARE(builder.data().mid(20), QList<int>({ 4, 1, 1, 1, 0 }));
+    builder.clear();
+    QVERIFY(builder.data().isEmpty());
+}
+
+void tst_QLanguageServer::diagnosticsPublisher()
+{
+    TestRig test;
+    test.open();
+
+    QList<QJsonValue> published;
+    test.client.setMessageHandler(
+            "textDocument/publishDiagnostics",
+            new NotificationHandler([&](const QJsonRpcProtocol::Notification &notification) {
+                published.append(notification.params);
+            }));
+
+    QLspDiagnosticsPublisher publisher(&test.protocol);
+    publisher.setDelay(10);
+    Diagnostic unusedImport;
+    unusedImport.range = Range { Position { 0, 0 }, Position { 0, 14 } };
+    unusedImport.message = "Unused import";
+    Diagnostic unknownType;
+    unknownType.range = Range { Position { 2, 0 }, Position { 2, 4 } };
+    unknownType.message = "Unknown type";
+
+    // a burst of updates of several analyzers gives a single notification
+    publisher.setDiagnostics("compiler", "file:///a.qml", { unknownType });
+    for (int i = 0; i < 5; ++i)
+        publisher.setDiagnostics("qmllint", "file:///a.qml", { unusedImport }, 3);
+    QCOMPARE(publisher.pendingCount(), 1);
+    QTRY_COMPARE(published.size(), 1);
+    QCOMPARE(published.at(0)[u"uri"_s], QJsonValue(u"file:///a.qml"_s));
+    QCOMPARE(published.at(0)[u"version"_s], QJsonValue(3));
+    QCOMPARE(published.at(0)[u"diagnostics"_s].toArray().size(), 2);
+    QCOMPARE(publisher.publishedDiagnostics("file:///a.qml").size(), 2);
+
+    // unchanged diagnostics, and empty ones never published, are not sent
+    publisher.setDiagnostics("qmllint", "file:///a.qml", { unusedImport }, 3);
+    publisher.setDiagnostics("qmllint", "file:///b.qml", {});
+    publisher.flush();
+    QCOMPARE(publisher.pendingCount(), 0);
+
+    // the same diagnostics for another version are sent again, a missing version resets it
+    publisher.setDiagnostics("qmllint", "file:///a.qml", { unusedImport }, 4);
+    publisher.flush();
+    QTRY_COMPARE(published.size(), 2);
+    QCOMPARE(published.at(1)[u"version"_s], QJsonValue(4));
+    QCOMPARE(published.at(1)[u"diagnostics"_s].toArray().size(), 2);
+    publisher.setDiagnostics("qmllint", "file:///a.qml", { unusedImport });
+    publisher.flush();
+    QTRY_COMPARE(published.size(), 3);
+    QVERIFY(published.at(2)[u"version"_s].isUndefined());
+
+    // clearing sends an empty set, once
+    publisher.clearAnalyzer("qmllint");
+    publisher.clearAnalyzer("compiler");
+    publisher.flush();
+    publisher.clearDiagnostics("qmllint", "file:///a.qml");
+    publisher.flush();
+    QTRY_COMPARE(published.size(), 4);
+    QCOMPARE(published.at(3)[u"uri"_s], QJsonValue(u"file:///a.qml"_s));
+    QVERIFY(published.at(3)[u"diagnostics"_s].toArray().isEmpty());
+    QVERIFY(publisher.publishedDiagnostics("file:///a.qml").isEmpty());
+}
+
+void tst_QLanguageServer::pullDiagnostics()
+{
+    QLspDiagnosticReports reports;
+    Diagnostic unusedImport;
+    unusedImport.range = Range { Position { 0, 0 }, Position { 0, 14 } };
+    unusedImport.message = "Unused import";
+    QVERIFY(reports.setDiagnostics("file:///a.qml", { unusedImport }, 2));
+    QVERIFY(!reports.setDiagnostics("file:///a.qml", { unusedImport }, 2));
+    QVERIFY(!reports.setDiagnostics("file:///b.qml", {}));
+    QCOMPARE(reports.size(), 1);
+    const QByteArray resultId = reports.resultId("file:///a.qml");
+    QCOMPARE(resultId, QLspDiagnosticReports::resultIdFor({ unusedImport }));
+
+    TestRig test;
+    test.protocol.registerDocumentDiagnosticRequestHandler(
+            [&reports](const QByteArray &, const DocumentDiagnosticParams &params,
+                       Responses::DocumentDiagnosticResponseType &&response) {
+                response.sendResponse(reports.documentReport(params));
+            });
+    test.open();
+    test.initialize();
+
+    DocumentDiagnosticParams params;
+    params.textDocument.uri = "file:///a.qml";
+    QJsonValue report;
+    sendAndWaitJsonRpc(&test.client,
+                       { 5, "textDocument/diagnostic", QTypedJson::toJsonValue(params) },
+                       [&](const QJsonRpcProtocol::Response &response) { report = response.data; });
+    QCOMPARE(report[u"kind"_s], QJsonValue(u"full"_s));
+    QCOMPARE(report[u"resultId"_s], QJsonValue(QString::fromUtf8(resultId)));
+    QCOMPARE(report[u"items"_s].toArray().size(), 1);
+
+    // the client has the current diagnostics
+    params.previousResultId = resultId;
+    sendAndWaitJsonRpc(&test.client,
+                       { 6, "textDocument/diagnostic", QTypedJson::toJsonValue(params) },
+                       [&](const QJsonRpcProtocol::Response &response) { report = response.data; });
+    QCOMPARE(report[u"kind"_s], QJsonValue(u"unchanged"_s));
+    QVERIFY(report[u"items"_s].isUndefined());
+
+    // a document that lost its diagnostics is reported to the workspace, with empty items
+    WorkspaceDiagnosticParams workspaceParams;
+    workspaceParams.previousResultIds.append(PreviousResultId { "file:///a.qml", resultId });
+    workspaceParams.previousResultIds.append(PreviousResultId { "file:///c.qml", "1234" });
+    WorkspaceDiagnosticReport workspace = reports.workspaceReport(workspaceParams);
+    QCOMPARE(workspace.items.size(), 2);
+    const auto &unchanged =
+            std::get<WorkspaceUnchangedDocumentDiagnosticReport>(workspace.items.at(0));
+    QCOMPARE(unchanged.uri, QByteArray("file:///a.qml"));
+    QCOMPARE(std::get<int>(unchanged.version), 2);
+    const auto &cleared = std::get<WorkspaceFullDocumentDiagnosticReport>(workspace.items.at(1));
+    QCOMPARE(cleared.uri, QByteArray("file:///c.qml"));
+    QVERIFY(cleared.items.isEmpty());
+
+    // diagnostics set without a version are reported without one
+    QVERIFY(!reports.setDiagnostics("file:///a.qml", { unusedImport }));
+    workspace = reports.workspaceReport(workspaceParams);
+    QVERIFY(std::holds_alternative<std::nullptr_t>(
+            std::get<WorkspaceUnchangedDocumentDiagnosticReport>(workspace.items.at(0)).version));
+
+    reports.remove("file:///a.qml");
+    workspace = reports.workspaceReport(WorkspaceDiagnosticParams());
+    QVERIFY(workspace.items.isEmpty());
+}
+
+void tst_QLanguageServer::completionCache()
+{
+    QVERIFY(QLspCompletionCache::score("wid", "width"));
+    QVERIFY(!QLspCompletionCache::score("wdx", "width"));
+    // the start of a word, and camelCase humps, are better matches
+    QVERIFY(*QLspCompletionCache::score("ic", "implicitHeight")
+            < *QLspCompletionCache::score("ih", "implicitHeight"));
+    QVERIFY(*QLspCompletionCache::score("h", "height")
+            > *QLspCompletionCache::score("h", "implicitHeight"));
+
+    QList<CompletionItem> candidates;
+    for (const char *label : { "width", "height", "implicitWidth", "implicitHeight", "visible" }) {
+        CompletionItem item;
+        item.label = label;
+        candidates.append(item);
+    }
+    // the candidates are computed with the cursor after "i", their edits end there
+    const Position wordStart { 4, 8 };
+    candidates[2].textEdit = InsertReplaceEdit { "implicitWidth", Range { wordStart, { 4, 9 } },
+                                                 Range { wordStart, { 4, 12 } } };
+    candidates[3].textEdit = TextEdit { Range { wordStart, { 4, 9 } }, "implicitHeight" };
+    QLspCompletionCache cache;
+    cache.setMaxItems(2);
+    QVERIFY(!cache.complete("file:///a.qml", 1, wordStart, { 4, 9 }, "i"));
+    cache.setCandidates("file:///a.qml", 1, wordStart, candidates);
+    QVERIFY(cache.contains("file:///a.qml", 1, wordStart));
+    QVERIFY(!cache.contains("file:///a.qml", 1, Position { 4, 9 }));
+    QVERIFY(!cache.contains("file:///a.qml", 2, wordStart));
+
+    std::optional<CompletionList> list =
+            cache.complete("file:///a.qml", 1, wordStart, { 4, 9 }, "i");
+    QVERIFY(list);
+    QVERIFY(list->isIncomplete);
+    QCOMPARE(list->items.size(), 2);
+    QCOMPARE(list->items.at(0).label, QByteArray("implicitWidth"));
+    QCOMPARE(list->items.at(0).sortText.value_or(QByteArray()), QByteArray("0"));
+    list = cache.complete("file:///a.qml", 1, wordStart, { 4, 10 }, "iW");
+    QVERIFY(list);
+    QVERIFY(!list->isIncomplete);
+    QCOMPARE(list->items.size(), 1);
+    QCOMPARE(list->items.at(0).label, QByteArray("implicitWidth"));
+
+    // typing in the word keeps the candidates for the next version, and moves the end of
+    // their edits to the cursor
+    DidChangeTextDocumentParams params;
+    params.textDocument.uri = "file:///a.qml";
+    params.textDocument.version = 2;
+    TextDocumentContentChangeEvent typed;
+    typed.range = Range { Position { 4, 9 }, Position { 4, 9 } };
+    typed.text = "m";
+    params.contentChanges.append(typed);
+    cache.documentChanged(params);
+    QCOMPARE(cache.size(), 1);
+    QVERIFY(!cache.complete("file:///a.qml", 1, wordStart, { 4, 10 }, "im"));
+    list = cache.complete("file:///a.qml", 2, wordStart, { 4, 10 }, "im");
+    QVERIFY(list);
+    QVERIFY(!list->isIncomplete);
+    QCOMPARE(list->items.size(), 2);
+    const auto *insertReplace = std::get_if<InsertReplaceEdit>(&*list->items.at(0).textEdit);
+    QVERIFY(insertReplace);
+    QCOMPARE(insertReplace->insert.start.character, 8);
+    QCOMPARE(insertReplace->insert.end.character, 10);
+    QCOMPARE(insertReplace->replace.end.character, 13);
+    const auto *textEdit = std::get_if<TextEdit>(&*list->items.at(1).textEdit);
+    QVERIFY(textEdit);
+    QCOMPARE(textEdit->range.start.character, 8);
+    QCOMPARE(textEdit->range.end.line, 4);
+    QCOMPARE(textEdit->range.end.character, 10);
+
+    // other edits, and changes not following the version of the candidates, drop them
+    params.textDocument.version = 3;
+    params.contentChanges.first().range = Range { Position { 1, 0 }, Position { 1, 0 } };
+    cache.documentChanged(params);
+    QCOMPARE(cache.size(), 0);
+    cache.setCandidates("file:///a.qml", 3, wordStart, candidates);
+    params.contentChanges.first().range = typed.range;
+    cache.documentChanged(params);
+    QCOMPARE(cache.size(), 0);
+
+    // didClose drops the candidates, and a destroyed cache is disconnected
+    QLspNotifySignals notifySignals;
+    DidCloseTextDocumentParams close;
+    close.textDocument.uri = "file:///a.qml";
+    {
+        QLspCompletionCache connected;
+        connected.connectNotifications(&notifySignals);
+        connected.setCandidates("file:///a.qml", 1, wordStart, candidates);
+        QCOMPARE(connected.size(), 1);
+        emit notifySignals.receivedDidCloseTextDocumentNotification(close);
+        QCOMPARE(connected.size(), 0);
+    }
+    emit notifySignals.receivedDidCloseTextDocumentNotification(close);
+}
+
 QTEST_MAIN(tst_QLanguageServer)
 
 #include <tst_qlanguageserver.moc>
@@ -4,13 +4,21 @@
 #define TST_TYPEDJSON_H
 
 #include <QtJsonRpc/private/qtypedjson_p.h>
+#include <QtJsonRpc/private/qtypedcbor_p.h>
+#include <QtJsonRpc/private/qtypedjsonhash_p.h>
+#include <QtJsonRpc/private/qtypedjsonlazy_p.h>
+#include <QtJsonRpc/private/qtypedjsontextreader_p.h>
+#include <QtJsonRpc/private/qtypedjsontextwriter_p.h>
 #include <QtTest/QtTest>
 #include <QCborValue>
 #include <QDebug>
 #include <QLibraryInfo>
 #include <QByteArray>
 
+#include <array>
+#include <map>
 #include <memory>
+#include <vector>
 
 namespace TestSpec {
 
@@ -23,17 +31,42 @@ public:
     template<typename W>
     void walk(W &w)
     {
-        field(w, "line", line);
-        field(w, "character", character);
+        static constexpr QTypedJson::FieldName fieldNames[] = { "line", "character" };
+        field(w, fieldNames[0], line);
+        field(w, fieldNames[1], character);
     }
 };
 
+class StrictPosition : public Position
+{
+public:
+    static constexpr QTypedJson::ObjectOptions jsonObjectOptions =
+            QTypedJson::ObjectOption::WarnExtra;
+};
+
 class Range
 {
 public:
     Position start = {};
     Position end = {};
 
+    template<typename W>
+    void walk(W &w)
+    {
+        static constexpr QTypedJson::FieldName fieldNames[] = { "start", "end" };
+        field(w, fieldNames[0], start);
+        field(w, fieldNames[1], end);
+    }
+};
+
+using ProgressToken = std::variant<int, QByteArray>;
+
+class LazyRange
+{
+public:
+    QTypedJson::Lazy<Position> start = {};
+    Position end = {};
+
     template<typename W>
     void walk(W &w)
     {
@@ -42,7 +75,27 @@ public:
     }
 };
 
-using ProgressToken = std::variant<int, QByteArray>;
+class Containers
+{
+public:
+    std::vector<int> data = {};
+    QVarLengthArray<Position, 4> positions = {};
+    std::array<int, 2> pair = {};
+    QMap<QByteArray, QList<Position>> changes = {};
+    std::map<QString, int> counts = {};
+    QHash<QByteArray, bool> flags = {};
+
+    template<typename W>
+    void walk(W &w)
+    {
+        field(w, "data", data);
+        field(w, "positions", positions);
+        field(w, "pair", pair);
+        field(w, "changes", changes);
+        field(w, "counts", counts);
+        field(w, "flags", flags);
+    }
+};
 
 class ReferenceContext
 {
@@ -158,12 +211,88 @@ public:
         field(w, "documentChanges", documentChanges);
     }
 };
+class CreateFile
+{
+public:
+    QByteArray kind = {};
+    QByteArray uri = {};
+    static constexpr QTypedJson::Discriminator jsonDiscriminator = { "kind", "create" };
+
+    template<typename W>
+    void walk(W &w)
+    {
+        field(w, "kind", kind);
+        field(w, "uri", uri);
+    }
+};
+class DeleteFile
+{
+public:
+    QByteArray kind = {};
+    QByteArray uri = {};
+    static constexpr QTypedJson::Discriminator jsonDiscriminator = { "kind", "delete" };
+
+    template<typename W>
+    void walk(W &w)
+    {
+        field(w, "kind", kind);
+        field(w, "uri", uri);
+    }
+};
+class FileOperations
+{
+public:
+    QList<std::variant<CreateFile, DeleteFile, TextDocumentEdit, std::nullptr_t>> operations = {};
+
+    template<typename W>
+    void walk(W &w)
+    {
+        field(w, "operations", operations);
+    }
+};
+
+enum class MarkupKind { PlainText, Markdown };
+enum class Severity { Error = 1, Warning = 2 };
+
+class Markup
+{
+public:
+    MarkupKind kind = {};
+    Severity severity = {};
+
+    template<typename W>
+    void walk(W &w)
+    {
+        field(w, "kind", kind);
+        field(w, "severity", severity);
+    }
+};
 } // namespace TestSpec
 
 QT_BEGIN_NAMESPACE
 namespace QTypedJson {
 using namespace Qt::StringLiterals;
 
+template<>
+struct EnumTraits<TestSpec::MarkupKind>
+{
+    static constexpr bool isNumber = false;
+    static constexpr QByteArrayView names[] = {
+        "plaintext",
+        "markdown",
+    };
+    static constexpr EnumEntry<TestSpec::MarkupKind> sortedEntries[] = {
+        { "markdown", TestSpec::MarkupKind::Markdown },
+        { "plaintext", TestSpec::MarkupKind::PlainText },
+    };
+};
+
+template<>
+struct EnumTraits<TestSpec::Severity>
+{
+    static constexpr bool isNumber = true;
+};
+
 class TestTypedJson : public QObject
 {
     Q_OBJECT
@@ -222,6 +351,653 @@ private slots:
         QCOMPARE(value2.position.character, 5);
     }
 
+    void textReader()
+    {
+        QString baseDir = QLatin1String(QT_TYPEDJSON_DATADIR);
+        auto compareReaders = [&baseDir](const QString &name, auto fromJson) {
+            QFile f(baseDir + name);
+            QVERIFY(f.open(QIODevice::ReadOnly));
+            const QByteArray data = f.readAll();
+            auto fromText = fromJson;
+            QTypedJson::Reader r(QJsonDocument::fromJson(data).object());
+            QTypedJson::doWalk(r, fromJson);
+            QTypedJson::TextReader tr(data);
+            QTypedJson::doWalk(tr, fromText);
+            QVERIFY(r.errorMessages().isEmpty());
+            QVERIFY(tr.errorMessages().isEmpty());
+            QCOMPARE(toJsonValue(fromText), toJsonValue(fromJson));
+        };
+        compareReaders(u"/Range.json"_s, TestSpec::Range());
+        compareReaders(u"/ReferenceParams.json"_s, TestSpec::ReferenceParams());
+
+        // escapes are decoded directly to utf8
+        {
+            TestSpec::TextDocumentIdentifier id;
+            QTypedJson::TextReader r(R"({ "uri" : "a\"\\\/\n\u00e9\u20ac\ud83d\ude00" })");
+            QTypedJson::doWalk(r, id);
+            QVERIFY(r.errorMessages().isEmpty());
+            QCOMPARE(id.uri, QString(u"a\"\\/\n\u00e9\u20ac\U0001F600"_s).toUtf8());
+        }
+
+        // missing fields are reported with their path
+        {
+            TestSpec::Range range;
+            QTypedJson::TextReader r(
+                    R"({"start": {"line": 1, "character": 2}, "end": {"line": 3}})");
+            QTypedJson::doWalk(r, range);
+            QCOMPARE(range.start.character, 2);
+            QCOMPARE(range.end.line, 3);
+            QCOMPARE(r.errorMessages().size(), 1);
+            QVERIFY(r.errorMessages().first().contains(u".end.character"_s));
+            r.clearErrorMessages();
+        }
+
+        // variants and lists of variants behave like with Reader
+        {
+            TestSpec::WorkspaceEdit edit;
+            QTypedJson::TextReader r(R"({"documentChanges": [
+                { "textDocument": { "uri": "a" } }, { "line": 5, "character": 6 } ] })");
+            QTypedJson::doWalk(r, edit);
+            QVERIFY(edit.documentChanges);
+            auto list =
+                    std::get<QList<std::variant<TestSpec::TextDocumentEdit, TestSpec::Position>>>(
+                            *edit.documentChanges);
+            QCOMPARE(list.size(), 2);
+            QCOMPARE(std::get<TestSpec::TextDocumentEdit>(list[0]).textDocument.uri,
+                     QByteArray("a"));
+            QCOMPARE(std::get<TestSpec::Position>(list[1]).character, 6);
+        }
+
+        // invalid json is reported
+        {
+            TestSpec::Position pos;
+            QTypedJson::TextReader r(R"({"line": 1,})");
+            QTypedJson::doWalk(r, pos);
+            QVERIFY(!r.errorMessages().isEmpty());
+            r.clearErrorMessages();
+        }
+
+        // the last of duplicate members wins, like in QJsonObject, and the others are not extra
+        {
+            const QByteArray json = R"({"line": 1, "character": 2, "line": 3})";
+            TestSpec::Position pos;
+            QTypedJson::TextReader r(json);
+            QTypedJson::doWalk(r, pos);
+            QVERIFY(r.errorMessages().isEmpty());
+            QCOMPARE(pos.line, QJsonDocument::fromJson(json).object().value(u"line").toInt());
+            QCOMPARE(pos.line, 3);
+            QCOMPARE(pos.character, 2);
+
+            const QTypedJson::JsonTape tape(json);
+            QCOMPARE(tape.toInt(tape.findMember(0, "line"), -1), 3);
+            QCOMPARE(tape.toInt(tape.findMember(0, QTypedJson::FieldName("line")), -1), 3);
+        }
+    }
+
+    void jsonTapeValidation_data()
+    {
+        QTest::addColumn<QByteArray>("json");
+        QTest::addColumn<bool>("valid");
+
+        QTest::newRow("escapes") << QByteArray(R"(["\"\\\/\b\f\n\r\t\u00e9"])") << true;
+        QTest::newRow("invalidEscape") << QByteArray(R"(["a\x"])") << false;
+        QTest::newRow("invalidUnicodeEscape") << QByteArray(R"(["\u00g0"])") << false;
+        QTest::newRow("shortUnicodeEscape") << QByteArray(R"(["\u00"])") << false;
+        QTest::newRow("utf8") << QByteArray("[\"\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80\"]")
+                              << true;
+        QTest::newRow("utf8Continuation") << QByteArray("[\"\x80\"]") << false;
+        QTest::newRow("utf8Truncated") << QByteArray("[\"\xe2\x82\"]") << false;
+        QTest::newRow("utf8Overlong") << QByteArray("[\"\xc0\xaf\"]") << false;
+        QTest::newRow("utf8Surrogate") << QByteArray("[\"\xed\xa0\x80\"]") << false;
+        QTest::newRow("utf8TooLarge") << QByteArray("[\"\xf4\x90\x80\x80\"]") << false;
+        QTest::newRow("utf8InvalidByte") << QByteArray("[\"\xff\"]") << false;
+        QTest::newRow("numbers") << QByteArray("[0, -0, 10, 0.5, -0e1, 1E+2]") << true;
+        QTest::newRow("leadingZero") << QByteArray("[01]") << false;
+        QTest::newRow("negativeLeadingZero") << QByteArray("[-00.5]") << false;
+    }
+
+    void jsonTapeValidation()
+    {
+        QFETCH(QByteArray, json);
+        QFETCH(bool, valid);
+
+        // accepts exactly what QJsonDocument accepts
+        QJsonParseError error;
+        QJsonDocument::fromJson(json, &error);
+        QCOMPARE(error.error == QJsonParseError::NoError, valid);
+
+        const QTypedJson::JsonTape tape(json);
+        QCOMPARE(tape.isValid(), valid);
+        QCOMPARE(tape.errorString().isEmpty(), valid);
+    }
+
+    void textWriter()
+    {
+        QString baseDir = QLatin1String(QT_TYPEDJSON_DATADIR);
+        auto compareWriters = [&baseDir](const QString &name, auto value) {
+            QFile f(baseDir + name);
+            QVERIFY(f.open(QIODevice::ReadOnly));
+            QTypedJson::Reader r(QJsonDocument::fromJson(f.readAll()).object());
+            QTypedJson::doWalk(r, value);
+            QVERIFY(r.errorMessages().isEmpty());
+            QJsonParseError error;
+            const QJsonDocument doc = QJsonDocument::fromJson(toJsonText(value), &error);
+            QCOMPARE(error.error, QJsonParseError::NoError);
+            QCOMPARE(QJsonValue(doc.object()), toJsonValue(value));
+        };
+        compareWriters(u"/Range.json"_s, TestSpec::Range());
+        compareWriters(u"/ReferenceParams.json"_s, TestSpec::ReferenceParams());
+
+        // strings are escaped, utf8 is kept as is, missing optional fields are skipped
+        TestSpec::ReferenceParams params;
+        params.textDocument.uri = QString(u"a\"\\\n\t\u0001\u00e9\U0001F600"_s).toUtf8();
+        params.workDoneToken = 3;
+        QCOMPARE(toJsonText(params),
+                 QByteArray(R"({"textDocument":{"uri":"a\"\\\n\t\u0001)")
+                         + QString(u"\u00e9\U0001F600"_s).toUtf8()
+                         + QByteArray(R"("},"position":{"line":0,"character":0},)"
+                                      R"("workDoneToken":3,)"
+                                      R"("context":{"includeDeclaration":false}})"));
+
+        // an undefined top level value is not written, as toJsonValue returns it as is
+        QVERIFY(toJsonValue(QJsonValue(QJsonValue::Undefined)).isUndefined());
+        QVERIFY(toJsonText(QJsonValue(QJsonValue::Undefined)).isNull());
+        QCOMPARE(toJsonText(QJsonArray({ QJsonValue(QJsonValue::Undefined) })),
+                 QByteArray("[null]"));
+        QCOMPARE(toJsonText(std::optional<int>()), QByteArray("null"));
+        QCOMPARE(toJsonValue(std::optional<int>()), QJsonValue(QJsonValue::Null));
+
+        // invalid utf8 is replaced as QString::fromUtf8 does
+        QCOMPARE(toJsonText(QByteArray("a\xff"
+                                       "b")),
+                 QString(u"\"a\ufffdb\""_s).toUtf8());
+    }
+
+    void cbor()
+    {
+        QString baseDir = QLatin1String(QT_TYPEDJSON_DATADIR);
+        auto roundTrip = [&baseDir](const QString &name, auto value) {
+            QFile f(baseDir + name);
+            QVERIFY(f.open(QIODevice::ReadOnly));
+            QTypedJson::Reader r(QJsonDocument::fromJson(f.readAll()).object());
+            QTypedJson::doWalk(r, value);
+            QVERIFY(r.errorMessages().isEmpty());
+            const QByteArray data = toCbor(value);
+            QVERIFY(data.size() < toJsonText(value).size());
+            QCOMPARE(QCborValue::fromCbor(data).toJsonValue(), toJsonValue(value));
+            decltype(value) decoded;
+            QTypedJson::CborReader cr(data);
+            QTypedJson::doWalk(cr, decoded);
+            QVERIFY(cr.errorMessages().isEmpty());
+            QCOMPARE(toJsonValue(decoded), toJsonValue(value));
+        };
+        roundTrip(u"/Range.json"_s, TestSpec::Range());
+        roundTrip(u"/ReferenceParams.json"_s, TestSpec::ReferenceParams());
+
+        // variants and lists of variants
+        {
+            TestSpec::WorkspaceEdit edit;
+            QTypedJson::Reader r(QJsonDocument::fromJson(R"({"documentChanges": [
+                { "textDocument": { "uri": "a" } }, { "line": 5, "character": 6 } ] })")
+                                         .object());
+            QTypedJson::doWalk(r, edit);
+            QVERIFY(r.errorMessages().isEmpty());
+            TestSpec::WorkspaceEdit decoded;
+            QTypedJson::CborReader cr(toCbor(edit));
+            QTypedJson::doWalk(cr, decoded);
+            QVERIFY(cr.errorMessages().isEmpty());
+            QCOMPARE(toJsonValue(decoded), toJsonValue(edit));
+        }
+
+        // missing fields are reported with their path
+        {
+            QCborMap start;
+            start.insert(u"line"_s, 1);
+            start.insert(u"character"_s, 2);
+            QCborMap end;
+            end.insert(u"line"_s, 3);
+            QCborMap range;
+            range.insert(u"start"_s, start);
+            range.insert(u"end"_s, end);
+            TestSpec::Range decoded;
+            QTypedJson::CborReader cr(range.toCborValue().toCbor());
+            QTypedJson::doWalk(cr, decoded);
+            QCOMPARE(decoded.start.character, 2);
+            QCOMPARE(decoded.end.line, 3);
+            QCOMPARE(cr.errorMessages().size(), 1);
+            QVERIFY(cr.errorMessages().first().contains(u".end.character"_s));
+            cr.clearErrorMessages();
+        }
+
+        // invalid data is reported
+        {
+            TestSpec::Position pos;
+            QTypedJson::CborReader cr(QByteArray("\xa2\x64line", 6));
+            QTypedJson::doWalk(cr, pos);
+            QVERIFY(cr.failed());
+            QVERIFY(cr.errorMessages().first().startsWith(u"Invalid cbor at offset"_s));
+            cr.clearErrorMessages();
+        }
+
+        // indefinite length containers and tags are streamed, trailing data is rejected
+        {
+            QByteArray data;
+            QCborStreamWriter w(&data);
+            w.startMap();
+            w.append(u"character"_s);
+            w.append(QCborTag(1));
+            w.append(2);
+            w.append(u"line"_s);
+            w.append(-1);
+            w.endMap();
+            TestSpec::Position pos;
+            QTypedJson::CborReader cr(data);
+            QTypedJson::doWalk(cr, pos);
+            QVERIFY(cr.errorMessages().isEmpty());
+            QCOMPARE(pos.line, -1);
+            QCOMPARE(pos.character, 2);
+
+            QTypedJson::CborReader garbage(data + '\x01');
+            QTypedJson::doWalk(garbage, pos);
+            QVERIFY(garbage.failed());
+            garbage.clearErrorMessages();
+        }
+    }
+
+    void lazy()
+    {
+        const QByteArray json = R"({"start": {"line": 1, "character": 2}, "end": {"line": 3,
+                                    "character": 4}})";
+        {
+            TestSpec::LazyRange range;
+            QTypedJson::TextReader r(json);
+            doWalk(r, range);
+            QVERIFY(r.errorMessages().isEmpty());
+            QVERIFY(!range.start.isDecoded());
+            QCOMPARE(range.end.character, 4);
+            // undecoded values are written as they are
+            QCOMPARE(toJsonText(range),
+                     QByteArray(R"({"start":{"line": 1, "character": 2},"end":{"line":3,)"
+                                R"("character":4}})"));
+            QCOMPARE(toJsonValue(range), QJsonValue(QJsonDocument::fromJson(json).object()));
+            QCOMPARE(range.start->character, 2);
+            QVERIFY(range.start.isDecoded());
+            range.start->line = 5;
+            QCOMPARE(toJsonText(range), QByteArray(R"({"start":{"line":5,"character":2},)"
+                                                   R"("end":{"line":3,"character":4}})"));
+        }
+        {
+            TestSpec::LazyRange range;
+            QTypedJson::Reader r(QJsonDocument::fromJson(json).object());
+            doWalk(r, range);
+            QVERIFY(r.errorMessages().isEmpty());
+            QVERIFY(!range.start.isDecoded());
+            QCOMPARE(toJsonValue(range), QJsonValue(QJsonDocument::fromJson(json).object()));
+            QCOMPARE(range.start.value().line, 1);
+        }
+        {
+            // missing values decode to the default value
+            TestSpec::LazyRange range;
+            QTypedJson::TextReader r(R"({"end": {"line": 3, "character": 4}})");
+            doWalk(r, range);
+            QVERIFY(!range.start.isDecoded());
+            QCOMPARE(range.start->line, 0);
+        }
+    }
+
+    void containers()
+    {
+        const QByteArray json = R"({"data": [1, 2, 3],
+            "positions": [{"line": 1, "character": 2}, {"line": 3, "character": 4}],
+            "pair": [5, 6], "changes": {"file:///a": [{"line": 7, "character": 8}], "b": []},
+            "counts": {"x": 1, "y": 2}, "flags": {"z": true}})";
+        const QJsonValue expected = QJsonDocument::fromJson(json).object();
+        auto check = [&expected](const TestSpec::Containers &c) {
+            QCOMPARE(c.data, std::vector<int>({ 1, 2, 3 }));
+            QCOMPARE(c.positions.size(), 2);
+            QCOMPARE(c.positions[1].character, 4);
+            QCOMPARE(c.pair[1], 6);
+            QCOMPARE(c.changes.size(), 2);
+            QCOMPARE(c.changes.value("file:///a").first().line, 7);
+            QCOMPARE(c.counts.at(u"y"_s), 2);
+            QCOMPARE(c.flags.value("z"), true);
+            QCOMPARE(toJsonValue(c), expected);
+            QCOMPARE(QJsonDocument::fromJson(toJsonText(c)).object(), expected.toObject());
+        };
+        {
+            TestSpec::Containers c;
+            QTypedJson::Reader r(expected);
+            doWalk(r, c);
+            QVERIFY(r.errorMessages().isEmpty());
+            check(c);
+        }
+        {
+            TestSpec::Containers c;
+            QTypedJson::TextReader r(json);
+            doWalk(r, c);
+            QVERIFY(r.errorMessages().isEmpty());
+            check(c);
+
+            TestSpec::Containers fromCbor;
+            QTypedJson::CborReader cr(toCbor(c));
+            doWalk(cr, fromCbor);
+            QVERIFY(cr.errorMessages().isEmpty());
+            check(fromCbor);
+            QVERIFY(contentEquals(c, fromCbor));
+        }
+        {
+            // std::array is a tuple, its size is checked
+            TestSpec::Containers c;
+            QTypedJson::TextReader r(R"({"pair": [1, 2, 3]})");
+            doWalk(r, c);
+            QCOMPARE(r.errorMessages().size(), 1);
+            r.clearErrorMessages();
+        }
+    }
+
+    void contentHashAndEquality()
+    {
+        QString baseDir = QLatin1String(QT_TYPEDJSON_DATADIR);
+        TestSpec::ReferenceParams a;
+        TestSpec::ReferenceParams b;
+        testT(baseDir + u"/ReferenceParams.json"_s, a);
+        testT(baseDir + u"/ReferenceParams.json"_s, b);
+        QCOMPARE(contentHash(a), contentHash(b));
+        QVERIFY(contentEquals(a, b));
+
+        b.position.character += 1;
+        QVERIFY(contentHash(a) != contentHash(b));
+        QVERIFY(!contentEquals(a, b));
+        b.position.character -= 1;
+        QVERIFY(contentEquals(a, b));
+
+        // a missing optional field differs from a present one
+        b.workDoneToken = QByteArray();
+        QVERIFY(contentHash(a) != contentHash(b));
+        QVERIFY(!contentEquals(a, b));
+        QVERIFY(!contentEquals(b, a));
+
+        // variants compare their content, not their index
+        TestSpec::WorkspaceEdit e1;
+        TestSpec::WorkspaceEdit e2;
+        e1.documentChanges = QList<TestSpec::TextDocumentEdit>({ TestSpec::TextDocumentEdit() });
+        e2.documentChanges = QList<std::variant<TestSpec::TextDocumentEdit, TestSpec::Position>>(
+                { TestSpec::TextDocumentEdit() });
+        QCOMPARE(contentHash(e1), contentHash(e2));
+        QVERIFY(contentEquals(e1, e2));
+    }
+
+    void validateOnly()
+    {
+        const QJsonObject params =
+                loadJson(QLatin1String(QT_TYPEDJSON_DATADIR) + u"/ReferenceParams.json"_s);
+        QStringList errors;
+        QVERIFY(validate<TestSpec::ReferenceParams>(params, &errors));
+        QVERIFY(errors.isEmpty());
+
+        QJsonObject mistyped = params;
+        mistyped[u"position"_s] = QJsonObject({ { u"line"_s, u"9"_s }, { u"character"_s, 5 } });
+        QVERIFY(!validate<TestSpec::ReferenceParams>(mistyped, &errors));
+        QCOMPARE(errors.size(), 1);
+        QVERIFY(errors.first().contains(u"position.line"_s));
+
+        QJsonObject missing = params;
+        missing.remove(u"context"_s);
+        QVERIFY(!validate<TestSpec::ReferenceParams>(missing, &errors));
+        QCOMPARE(errors.size(), 1);
+        QVERIFY(errors.first().contains(u"context"_s));
+
+        // extra fields are only reported with WarnExtra
+        const QJsonObject extra({ { u"line"_s, 1 }, { u"character"_s, 2 }, { u"column"_s, 3 } });
+        QVERIFY(validate<TestSpec::Position>(extra));
+        QVERIFY(!validate<TestSpec::StrictPosition>(extra, &errors));
+        QVERIFY(errors.first().contains(u"column"_s));
+
+        // every element of a list is checked, and lazy fields are checked too
+        const QJsonArray positions({ QJsonObject({ { u"line"_s, 1 }, { u"character"_s, 2 } }),
+                                     QJsonObject({ { u"line"_s, true }, { u"character"_s, 2 } }) });
+        QVERIFY(!validate<QList<TestSpec::Position>>(positions, &errors));
+        QVERIFY(errors.first().contains(u"1.line"_s));
+        const QJsonObject range({ { u"start"_s, positions.at(1) }, { u"end"_s, positions.at(0) } });
+        QVERIFY(!validate<TestSpec::LazyRange>(range, &errors));
+        QVERIFY(errors.first().contains(u"start.line"_s));
+
+        // enums are checked for their type and name
+        QVERIFY(validate<TestSpec::Markup>(
+                QJsonObject({ { u"kind"_s, u"markdown"_s }, { u"severity"_s, 2 } })));
+        QVERIFY(!validate<TestSpec::Markup>(
+                QJsonObject({ { u"kind"_s, u"html"_s }, { u"severity"_s, 2 } }), &errors));
+        QVERIFY(errors.first().contains(u".kind"_s));
+        QVERIFY(!validate<TestSpec::Markup>(
+                QJsonObject({ { u"kind"_s, u"markdown"_s }, { u"severity"_s, true } }),
+                &errors));
+        QVERIFY(errors.first().contains(u".severity"_s));
+    }
+
+    void errorCollection()
+    {
+        const QJsonObject start({ { u"line"_s, u"x"_s }, { u"character"_s, 1 } });
+        const QJsonObject end({ { u"line"_s, 1 }, { u"character"_s, 2 } });
+        const QJsonObject range({ { u"start"_s, start }, { u"end"_s, end } });
+        {
+            TestSpec::Range value;
+            Reader r(range);
+            doWalk(r, value);
+            QVERIFY(r.hasErrors());
+            QVERIFY(r.failed());
+            QCOMPARE(r.errorMessages(), QStringList({ u".start.line misses value of type int"_s }));
+            r.clearErrorMessages();
+            QVERIFY(!r.hasErrors());
+        }
+        {
+            // without error collection decoding just stops, but still fails
+            TestSpec::Range value;
+            Reader r(range);
+            r.setCollectErrors(false);
+            doWalk(r, value);
+            QVERIFY(r.failed());
+            QVERIFY(r.errorMessages().isEmpty());
+            QCOMPARE(value.start.character, 1);
+            QCOMPARE(value.end.line, 0);
+        }
+        {
+            TestSpec::Range value;
+            Reader r(QJsonObject({ { u"start"_s, end }, { u"end"_s, end } }));
+            r.setCollectErrors(false);
+            doWalk(r, value);
+            QVERIFY(!r.failed());
+            QCOMPARE(value.start.character, 2);
+        }
+        {
+            // messages of failed variants are built only when read
+            QTypedJson::Reader r(QJsonObject({ { u"workDoneToken"_s, true } }));
+            TestSpec::WorkDoneProgressParams params;
+            doWalk(r, params);
+            const QStringList messages = r.errorMessages();
+            QCOMPARE(messages.size(), 5);
+            QCOMPARE(messages.first(), u"All options of variant failed:"_s);
+            QCOMPARE(messages.at(2), u".workDoneToken misses value of type int"_s);
+            QCOMPARE(messages.at(4), u".workDoneToken misses value of type string"_s);
+
+            // TextReader records the same errors
+            QTypedJson::TextReader tr(R"({"workDoneToken": true})");
+            TestSpec::WorkDoneProgressParams textParams;
+            doWalk(tr, textParams);
+            QCOMPARE(tr.errorMessages(), messages);
+            tr.clearErrorMessages();
+            QVERIFY(!tr.hasErrors());
+        }
+        {
+            QTypedJson::TextReader r(QJsonDocument(range).toJson());
+            TestSpec::Range value;
+            doWalk(r, value);
+            QCOMPARE(r.errorMessages(), QStringList({ u".start.line misses value of type int"_s }));
+            r.clearErrorMessages();
+        }
+        {
+            QTypedJson::CborReader r(QCborValue::fromJsonValue(range).toCbor());
+            TestSpec::Range value;
+            doWalk(r, value);
+            QVERIFY(r.failed());
+            QCOMPARE(r.errorMessages(), QStringList({ u".start.line misses value of type int"_s }));
+            r.clearErrorMessages();
+        }
+        {
+            // TextReader and CborReader have the same fast mode
+            QTypedJson::TextReader r(QJsonDocument(range).toJson());
+            r.setCollectErrors(false);
+            TestSpec::Range value;
+            doWalk(r, value);
+            QVERIFY(r.failed());
+            QVERIFY(!r.hasErrors());
+            QCOMPARE(value.start.character, 1);
+
+            QTypedJson::CborReader cr(QCborValue::fromJsonValue(range).toCbor());
+            cr.setCollectErrors(false);
+            TestSpec::Range cborValue;
+            doWalk(cr, cborValue);
+            QVERIFY(cr.failed());
+            QVERIFY(!cr.hasErrors());
+            QCOMPARE(cborValue.start.character, 1);
+        }
+    }
+
+    void enumTraits()
+    {
+        QCOMPARE(enumName(TestSpec::MarkupKind::Markdown), QByteArrayView("markdown"));
+        QVERIFY(enumName(TestSpec::MarkupKind(5)).isNull());
+        QCOMPARE(enumToString(TestSpec::MarkupKind::PlainText), u"plaintext"_s);
+        QCOMPARE(enumToString(TestSpec::MarkupKind(5)), u"5"_s);
+        QCOMPARE(enumToString(TestSpec::Severity::Warning), u"2"_s);
+
+        QCOMPARE(enumFromString<TestSpec::MarkupKind>(u"markdown"_s),
+                 TestSpec::MarkupKind::Markdown);
+        QCOMPARE(enumFromUtf8<TestSpec::MarkupKind>("plaintext"), TestSpec::MarkupKind::PlainText);
+        // the lookup stays case insensitive, and accepts numbers
+        QCOMPARE(enumFromUtf8<TestSpec::MarkupKind>("MarkDown"), TestSpec::MarkupKind::Markdown);
+        QCOMPARE(enumFromString<TestSpec::MarkupKind>(u"PlainText"_s),
+                 TestSpec::MarkupKind::PlainText);
+        QCOMPARE(enumFromUtf8<TestSpec::MarkupKind>("1"), TestSpec::MarkupKind::Markdown);
+        QCOMPARE(enumFromUtf8<TestSpec::MarkupKind>("html"), TestSpec::MarkupKind {});
+        QCOMPARE(enumFromString<TestSpec::Severity>(u"2"_s), TestSpec::Severity::Warning);
+
+        // string enums are written as strings, number enums as numbers
+        TestSpec::Markup markup;
+        markup.kind = TestSpec::MarkupKind::Markdown;
+        markup.severity = TestSpec::Severity::Warning;
+        const QByteArray text = toJsonText(markup);
+        QCOMPARE(text, QByteArray(R"({"kind":"markdown","severity":2})"));
+        QCOMPARE(toJsonValue(markup), QJsonValue(QJsonDocument::fromJson(text).object()));
+
+        TestSpec::Markup fromText;
+        TextReader tr(text);
+        doWalk(tr, fromText);
+        QVERIFY(tr.errorMessages().isEmpty());
+        QCOMPARE(fromText.kind, TestSpec::MarkupKind::Markdown);
+        QCOMPARE(fromText.severity, TestSpec::Severity::Warning);
+
+        TestSpec::Markup fromCbor;
+        CborReader cr(toCbor(markup));
+        doWalk(cr, fromCbor);
+        QVERIFY(cr.errorMessages().isEmpty());
+        QCOMPARE(fromCbor.kind, TestSpec::MarkupKind::Markdown);
+        QCOMPARE(fromCbor.severity, TestSpec::Severity::Warning);
+    }
+
+    void fieldNames()
+    {
+        static constexpr FieldName name("character");
+        QCOMPARE(name.name, "character"_L1);
+        QCOMPARE(name.hash, fieldNameHash("character", 9));
+
+        // fields not visited are reported, whatever their position in the object
+        const QByteArray json = R"({"extra": 1, "line": 1, "other": 2, "character": 2})";
+        {
+            TestSpec::StrictPosition pos;
+            QTypedJson::Reader r(QJsonDocument::fromJson(json).object());
+            doWalk(r, pos);
+            QCOMPARE(pos.line, 1);
+            QCOMPARE(pos.character, 2);
+            QCOMPARE(r.errorMessages().size(), 1);
+            QVERIFY(r.errorMessages().first().contains(u"extra"_s));
+            QVERIFY(r.errorMessages().first().contains(u"other"_s));
+            QVERIFY(!r.errorMessages().first().contains(u"character"_s));
+            r.clearErrorMessages();
+        }
+        {
+            TestSpec::StrictPosition pos;
+            QTypedJson::TextReader r(json);
+            doWalk(r, pos);
+            QCOMPARE(pos.line, 1);
+            QCOMPARE(pos.character, 2);
+            QCOMPARE(r.errorMessages().size(), 1);
+            QVERIFY(r.errorMessages().first().contains(u"other"_s));
+            r.clearErrorMessages();
+        }
+
+        // objects with more members than fit in the inline bitset
+        QJsonObject large({ { u"line"_s, 1 }, { u"character"_s, 2 } });
+        for (int i = 0; i < 100; ++i)
+            large.insert(u"extra%1"_s.arg(i), i);
+        {
+            TestSpec::StrictPosition pos;
+            QTypedJson::TextReader r(QJsonDocument(large).toJson());
+            doWalk(r, pos);
+            QCOMPARE(pos.character, 2);
+            QCOMPARE(r.errorMessages().size(), 1);
+            QVERIFY(r.errorMessages().first().contains(u"extra99"_s));
+            QVERIFY(!r.errorMessages().first().contains(u"character"_s));
+            r.clearErrorMessages();
+        }
+    }
+
+    void variantSelection()
+    {
+        const QList<FieldName> &required = requiredFields<TestSpec::ReferenceParams>();
+        QCOMPARE(required.size(), 3);
+        QCOMPARE(required[0].name, "textDocument"_L1);
+        QCOMPARE(required[1].name, "position"_L1);
+        QCOMPARE(required[2].name, "context"_L1);
+
+        // the discriminator selects between types with the same fields
+        const QByteArray json = R"({"operations": [
+            { "kind": "delete", "uri": "a" }, { "kind": "create", "uri": "b" },
+            { "textDocument": { "uri": "c" } }, null ] })";
+        auto check = [](const TestSpec::FileOperations &ops) {
+            QCOMPARE(ops.operations.size(), 4);
+            QVERIFY(std::holds_alternative<TestSpec::DeleteFile>(ops.operations[0]));
+            QCOMPARE(std::get<TestSpec::DeleteFile>(ops.operations[0]).uri, QByteArray("a"));
+            QVERIFY(std::holds_alternative<TestSpec::CreateFile>(ops.operations[1]));
+            QCOMPARE(std::get<TestSpec::CreateFile>(ops.operations[1]).uri, QByteArray("b"));
+            QVERIFY(std::holds_alternative<TestSpec::TextDocumentEdit>(ops.operations[2]));
+            QVERIFY(std::holds_alternative<std::nullptr_t>(ops.operations[3]));
+        };
+        {
+            TestSpec::FileOperations ops;
+            QTypedJson::Reader r(QJsonDocument::fromJson(json).object());
+            doWalk(r, ops);
+            QVERIFY(r.errorMessages().isEmpty());
+            check(ops);
+        }
+        {
+            TestSpec::FileOperations ops;
+            QTypedJson::TextReader r(json);
+            doWalk(r, ops);
+            QVERIFY(r.errorMessages().isEmpty());
+            check(ops);
+        }
+
+        // when no alternative fits the errors of all of them are reported
+        {
+            TestSpec::FileOperations ops;
+            QTypedJson::Reader r(QJsonDocument::fromJson(R"({"operations": [ 5 ]})").object());
+            doWalk(r, ops);
+            QVERIFY(!r.errorMessages().isEmpty());
+            QCOMPARE(r.errorMessages().first(), u"All options of variant failed:"_s);
+            r.clearErrorMessages();
+        }
+    }
+
     void qtbug124592()
     {
         const QString jsonList{ uR"({